@@ -0,0 +1,168 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <source_location>
+#include <span>
+#include <string>
+#include <thread>
+
+#include "ApiMacro.h"
+#include "SimpleCppLogger/LogAppender.h"
+#include "SimpleCppLogger/LogMessage.h"
+
+namespace SimpleCppLogger
+{
+/**
+ * @enum AsyncOverflowPolicy
+ * @brief Controls what an AsyncAppender does when its queue is full.
+ */
+enum class AsyncOverflowPolicy
+{
+    Block,  ///< The caller waits until the worker has made room.
+    Drop    ///< The message is discarded and counted.
+};
+
+/**
+ * @struct AsyncAppenderOptions
+ * @brief Configuration of an AsyncAppender.
+ */
+struct AsyncAppenderOptions {
+        std::size_t queue_capacity = 8192;  ///< Messages that may wait for the worker.
+        AsyncOverflowPolicy overflow_policy = AsyncOverflowPolicy::Block;
+};
+
+/**
+ * @class AsyncAppender
+ * @brief Decorates another appender with a bounded queue and a dedicated worker thread.
+ *
+ * append() only copies the message into the queue; the worker thread passes queued messages to
+ * the wrapped appender in order. A slow sink therefore no longer delays the logger's other
+ * appenders or the logging threads, as long as the queue has room.
+ *
+ * The decorator's level is the one that filters: it starts with the wrapped appender's level,
+ * and the wrapped appender's own level is opened up to LogLevel::Trace so that level changes
+ * made by the logger through the decorator take effect.
+ */
+class SIMPLECPPLOGGER_API AsyncAppender: public LogAppender
+{
+    public:
+        /**
+         * @brief Wraps the given appender and starts the worker thread.
+         * @param appender The appender to decorate. Must not be null.
+         * @param options The queue configuration.
+         */
+        explicit AsyncAppender(std::shared_ptr<LogAppender> appender,
+                               const AsyncAppenderOptions& options = {});
+
+        /**
+         * @brief Delivers all queued messages and stops the worker thread.
+         */
+        ~AsyncAppender() override;
+
+        AsyncAppender(const AsyncAppender&) = delete;
+        auto operator=(const AsyncAppender&) -> AsyncAppender& = delete;
+
+        /**
+         * @brief Returns the number of messages waiting in the queue.
+         * @return The queue size.
+         */
+        [[nodiscard]] auto get_queue_size() const -> std::size_t;
+
+        /**
+         * @brief Returns the number of messages dropped because the queue was full.
+         * @return The drop count.
+         */
+        [[nodiscard]] auto get_dropped_count() const -> std::uint64_t;
+
+        /**
+         * @brief Returns the decorated appender.
+         * @return The wrapped appender.
+         */
+        [[nodiscard]] auto get_appender() const -> const std::shared_ptr<LogAppender>&;
+
+        /**
+         * @brief Formats the message with the wrapped appender's formatter.
+         *
+         * @param message The log message to format.
+         * @param location The source location of the log message.
+         * @return The formatted text.
+         */
+        [[nodiscard]] auto format(const LogMessage& message,
+                                  const std::source_location& location) const
+            -> std::string override;
+
+        /**
+         * @brief Returns whether the wrapped appender supports preformatted output.
+         */
+        [[nodiscard]] auto supports_preformatted() const -> bool override;
+
+        /**
+         * @brief Queues copies of all records that pass the level check under a single lock.
+         *
+         * @param records The messages to append, with their source locations.
+         */
+        auto append_batch(std::span<const StagedRecord> records) -> void override;
+
+    private:
+        /**
+         * @brief A queued message. Preformatted entries carry their text.
+         */
+        struct Entry {
+                LogMessage message;
+                std::source_location location;
+                std::string formatted;
+                bool preformatted = false;
+        };
+
+        /**
+         * @brief A flush that completes once the first `position` queued entries are delivered.
+         */
+        struct FlushRequest {
+                std::uint64_t position;
+                FlushMode mode;
+                FlushCallback callback;
+        };
+
+        auto internal_append(const LogMessage& message,
+                             const std::source_location& location) -> void override;
+
+        auto internal_append_formatted(const LogMessage& message,
+                                       const std::source_location& location,
+                                       std::string&& formatted) -> void override;
+
+        /**
+         * @brief Flushes the wrapped appender once every message queued so far has been passed
+         * to it.
+         *
+         * @param callback Passed on to the wrapped appender's flush.
+         * @param mode Passed on to the wrapped appender's flush.
+         */
+        auto internal_flush(FlushCallback callback, FlushMode mode) -> void override;
+
+        auto enqueue(Entry&& entry) -> void;
+        auto wait_for_space(std::unique_lock<std::mutex>& lock) -> bool;
+        auto run() -> void;
+        auto deliver(std::deque<Entry>& batch) -> void;
+        auto complete_flush_requests(std::unique_lock<std::mutex>& lock) -> void;
+
+        std::shared_ptr<LogAppender> m_appender;
+        AsyncAppenderOptions m_options;
+
+        mutable std::mutex m_mutex;
+        std::condition_variable m_not_empty;
+        std::condition_variable m_not_full;
+        std::deque<Entry> m_queue;
+        std::deque<FlushRequest> m_flush_requests;
+        std::uint64_t m_queued = 0;     ///< Entries ever queued.
+        std::uint64_t m_delivered = 0;  ///< Entries ever passed to the wrapped appender.
+        std::uint64_t m_dropped = 0;
+        bool m_stopping = false;
+        std::thread m_worker;
+};
+
+}  // namespace SimpleCppLogger
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <source_location>
+#include <vector>
+
+#include "ApiMacro.h"
+#include "SimpleCppLogger/LogMessage.h"
+#include "SimpleCppLogger/StagingBuffer.h"
+
+namespace SimpleCppLogger
+{
+/**
+ * @class BacktraceBuffer
+ * @brief A bounded ring that keeps the most recent unformatted log messages.
+ *
+ * LoggerContext stores messages below its level here while backtrace mode is enabled and
+ * delivers them ahead of the next Error or Fatal message. When the ring is full, the oldest
+ * record is overwritten. The ring is shared by all threads of a context, so a dump shows the
+ * recent history of the whole process in logging order.
+ */
+class SIMPLECPPLOGGER_API BacktraceBuffer
+{
+    public:
+        /**
+         * @brief Constructs a buffer with the given capacity.
+         * @param capacity The maximum number of records kept (0 keeps nothing).
+         */
+        explicit BacktraceBuffer(std::size_t capacity = 0);
+
+        BacktraceBuffer(const BacktraceBuffer&) = delete;
+        auto operator=(const BacktraceBuffer&) -> BacktraceBuffer& = delete;
+
+        /**
+         * @brief Stores a record, overwriting the oldest one if the buffer is full.
+         * @param message The message to store.
+         * @param location The source location of the message.
+         */
+        auto push(LogMessage&& message, const std::source_location& location) -> void;
+
+        /**
+         * @brief Moves all stored records, oldest first, to the end of the given vector and
+         * empties the buffer.
+         *
+         * @param out The vector to append to.
+         * @return The number of records moved.
+         */
+        auto take_all(std::vector<StagedRecord>& out) -> std::size_t;
+
+        /**
+         * @brief Discards all records and changes the capacity.
+         * @param capacity The new capacity.
+         */
+        auto reset(std::size_t capacity) -> void;
+
+        /**
+         * @brief Returns the maximum number of records kept.
+         * @return The capacity.
+         */
+        [[nodiscard]] auto get_capacity() const -> std::size_t;
+
+        /**
+         * @brief Returns the number of stored records.
+         * @return The number of records.
+         */
+        [[nodiscard]] auto size() const -> std::size_t;
+
+    private:
+        mutable std::mutex m_mutex;
+        std::vector<StagedRecord> m_records;
+        std::size_t m_capacity;
+        std::size_t m_next = 0;  ///< Slot written by the next push once the ring is full.
+        std::uint64_t m_sequence = 0;
+};
+
+}  // namespace SimpleCppLogger
@@ -0,0 +1,150 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <source_location>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "ApiMacro.h"
+#include "SimpleCppLogger/LogAppender.h"
+#include "SimpleCppLogger/LogLevel.h"
+
+namespace SimpleCppLogger
+{
+/**
+ * @enum ConsoleFlushPolicy
+ * @brief Controls when a BatchedConsoleAppender hands its pending lines to the kernel.
+ */
+enum class ConsoleFlushPolicy
+{
+    EveryMessage,  ///< Each message is written with a single system call as soon as it arrives.
+    Batched        ///< Messages are coalesced and written together with writev.
+};
+
+/**
+ * @struct ConsoleOutputOptions
+ * @brief Configuration of a BatchedConsoleAppender.
+ */
+struct ConsoleOutputOptions {
+        ConsoleFlushPolicy flush_policy = ConsoleFlushPolicy::EveryMessage;
+        std::size_t max_batch_records = 64;       ///< Batched: flush once this many are pending.
+        std::size_t max_batch_bytes = 64 * 1024;  ///< Batched: flush once this many bytes pend.
+        LogLevel flush_level = LogLevel::Error;   ///< Batched: messages at or above flush at once.
+        int stdout_fd = 1;                        ///< Descriptor for Trace, Debug and Info.
+        int stderr_fd = 2;                        ///< Descriptor for Warning, Error and Fatal.
+};
+
+/**
+ * @class BatchedConsoleAppender
+ * @brief A console appender that writes directly to the stdout/stderr file descriptors.
+ *
+ * Unlike ConsoleAppender, this appender bypasses std::cout/std::cerr and their per-line
+ * flushes. Formatted lines are written with one system call per message or, with
+ * ConsoleFlushPolicy::Batched, coalesced into writev calls. The relative order of lines is
+ * preserved across both descriptors.
+ *
+ * If no formatter is given, a SimpleFormatter is used that only emits ANSI color codes when
+ * both descriptors refer to a terminal.
+ */
+class SIMPLECPPLOGGER_API BatchedConsoleAppender: public LogAppender
+{
+    public:
+        /**
+         * @brief Constructs a BatchedConsoleAppender object.
+         *
+         * @param options The output configuration.
+         * @param formatter The LogFormatter to use, or nullptr for a TTY-aware SimpleFormatter.
+         */
+        explicit BatchedConsoleAppender(const ConsoleOutputOptions& options = {},
+                                        const std::shared_ptr<LogFormatter>& formatter = nullptr);
+
+        /**
+         * @brief Writes all pending lines and destroys the appender.
+         */
+        ~BatchedConsoleAppender() override;
+
+        BatchedConsoleAppender(const BatchedConsoleAppender&) = delete;
+        auto operator=(const BatchedConsoleAppender&) -> BatchedConsoleAppender& = delete;
+
+        /**
+         * @brief Returns the number of lines waiting to be written.
+         * @return The number of pending lines.
+         */
+        [[nodiscard]] auto get_pending_count() const -> std::size_t;
+
+        /**
+         * @brief Returns whether the given file descriptor refers to a terminal.
+         * @param fd The file descriptor to check.
+         * @return True if fd is a terminal, false otherwise.
+         */
+        [[nodiscard]] static auto is_terminal(int fd) -> bool;
+
+        /**
+         * @brief Returns true; preformatted text is written unchanged.
+         */
+        [[nodiscard]] auto supports_preformatted() const -> bool override;
+
+        /**
+         * @brief Formats the batch into one buffer per run of lines for the same descriptor and
+         * writes each run with a single system call.
+         *
+         * Pending lines are written first, so the order is preserved. The flush policy does not
+         * apply; the batch is written before the call returns.
+         *
+         * @param records The messages to append, with their source locations.
+         */
+        auto append_batch(std::span<const StagedRecord> records) -> void override;
+
+    private:
+        /**
+         * @brief A formatted line waiting to be written, including its trailing newline.
+         */
+        struct PendingLine {
+                int fd;
+                std::string text;
+        };
+
+        /**
+         * @brief Formats the message and writes or queues it according to the flush policy.
+         *
+         * @param message The log message to append.
+         * @param location The source location of the log message.
+         */
+        auto internal_append(const LogMessage& message,
+                             const std::source_location& location) -> void override;
+
+        /**
+         * @brief Writes or queues already formatted text according to the flush policy.
+         *
+         * @param message The log message to append.
+         * @param location The source location of the log message.
+         * @param formatted The formatted text without a trailing newline.
+         */
+        auto internal_append_formatted(const LogMessage& message,
+                                       const std::source_location& location,
+                                       std::string&& formatted) -> void override;
+
+        /**
+         * @brief Writes all pending lines to their file descriptors.
+         *
+         * @param callback Called with true once the lines are written.
+         * @param mode Ignored; console descriptors are not synced.
+         */
+        auto internal_flush(FlushCallback callback, FlushMode mode) -> void override;
+
+        /**
+         * @brief Writes all pending lines. The caller must hold m_mutex.
+         */
+        auto flush_locked() -> void;
+
+        [[nodiscard]] auto select_fd(LogLevel level) const -> int;
+
+        ConsoleOutputOptions m_options;
+        mutable std::mutex m_mutex;
+        std::vector<PendingLine> m_pending;
+        std::size_t m_pending_bytes = 0;
+};
+}  // namespace SimpleCppLogger
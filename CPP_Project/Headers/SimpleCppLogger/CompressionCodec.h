@@ -0,0 +1,94 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "ApiMacro.h"
+
+namespace SimpleCppLogger
+{
+/**
+ * @enum CompressionType
+ * @brief The compression formats built into the library.
+ */
+enum class CompressionType
+{
+    Zlib,  ///< gzip members (zlib); readable with zcat.
+    Zstd,  ///< Zstandard frames; readable with zstdcat.
+    Lz4    ///< LZ4 frames; readable with lz4cat.
+};
+
+/**
+ * @class CompressionCodec
+ * @brief Compresses log output in independent frames.
+ *
+ * Every call to compress() produces one self-contained frame. A file made of concatenated
+ * frames is a valid stream of the codec's format, so the standard command line tools can read
+ * it, and a reader can start decompressing at any frame boundary.
+ *
+ * A codec instance may keep compression state between calls and must only be used by one
+ * thread at a time. Custom codecs can be passed to FileAppender directly.
+ */
+class SIMPLECPPLOGGER_API CompressionCodec
+{
+    public:
+        virtual ~CompressionCodec() = default;
+
+        /**
+         * @brief Returns the name of the codec, e.g. "zlib".
+         */
+        [[nodiscard]] virtual auto get_name() const -> std::string_view = 0;
+
+        /**
+         * @brief Returns the usual file name extension of the format, e.g. ".gz".
+         */
+        [[nodiscard]] virtual auto get_file_extension() const -> std::string_view = 0;
+
+        /**
+         * @brief Compresses the input into one frame and appends it to out.
+         *
+         * @param input The data to compress.
+         * @param out The string the frame is appended to.
+         * @return True on success, false if the data could not be compressed.
+         */
+        virtual auto compress(std::string_view input, std::string& out) -> bool = 0;
+
+        /**
+         * @brief Decompresses one or more concatenated frames and appends the data to out.
+         *
+         * @param input Complete frames as produced by compress().
+         * @param out The string the data is appended to.
+         * @return True on success, false if the input is not a sequence of complete frames.
+         */
+        virtual auto decompress(std::string_view input, std::string& out) -> bool = 0;
+
+        /**
+         * @brief Returns whether the library was built with support for the given format.
+         * @param type The compression format.
+         * @return True if create() returns a codec for the format.
+         */
+        [[nodiscard]] static auto is_available(CompressionType type) -> bool;
+
+        /**
+         * @brief Creates a codec for one of the built-in formats.
+         *
+         * @param type The compression format.
+         * @param level The compression level, or 0 for the format's default.
+         * @return The codec, or nullptr if the library was built without the format.
+         */
+        [[nodiscard]] static auto create(CompressionType type, int level = 0)
+            -> std::unique_ptr<CompressionCodec>;
+
+        /**
+         * @brief Creates a built-in codec by the name that its get_name() returns.
+         *
+         * @param name The codec name, e.g. "zlib".
+         * @param level The compression level, or 0 for the format's default.
+         * @return The codec, or nullptr if the name is unknown or the format is not built in.
+         */
+        [[nodiscard]] static auto create(std::string_view name, int level = 0)
+            -> std::unique_ptr<CompressionCodec>;
+};
+
+}  // namespace SimpleCppLogger
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <span>
+
 #include "ApiMacro.h"
 #include "SimpleCppLogger/LogAppender.h"
 #include "SimpleCppLogger/SimpleFormatter.h"
@@ -12,6 +14,7 @@ namespace SimpleCppLogger
  *
  * This class is responsible for appending log messages to the console.
  * It uses a provided LogFormatter to format the log messages before outputting them.
+ * Lines on std::cout are buffered by the stream; call flush() to write them out.
  */
 class SIMPLECPPLOGGER_API ConsoleAppender: public LogAppender
 {
@@ -27,6 +30,19 @@ class SIMPLECPPLOGGER_API ConsoleAppender: public LogAppender
         explicit ConsoleAppender(
             const std::shared_ptr<LogFormatter>& formatter = std::make_shared<SimpleFormatter>());
 
+        /**
+         * @brief Returns true; preformatted text is written unchanged.
+         */
+        [[nodiscard]] auto supports_preformatted() const -> bool override;
+
+        /**
+         * @brief Formats the batch into one buffer per output stream and writes each buffer at
+         * once.
+         *
+         * @param records The messages to append, with their source locations.
+         */
+        auto append_batch(std::span<const StagedRecord> records) -> void override;
+
     private:
         /**
          * @brief Appends the specified log message to the console.
@@ -38,5 +54,25 @@ class SIMPLECPPLOGGER_API ConsoleAppender: public LogAppender
          */
         auto internal_append(const LogMessage& message,
                              const std::source_location& location) -> void override;
+
+        /**
+         * @brief Outputs already formatted text to std::cout or std::cerr depending on the log
+         * level.
+         *
+         * @param message The log message to append to the console.
+         * @param location The source location of the log message.
+         * @param formatted The formatted text.
+         */
+        auto internal_append_formatted(const LogMessage& message,
+                                       const std::source_location& location,
+                                       std::string&& formatted) -> void override;
+
+        /**
+         * @brief Flushes std::cout and std::cerr.
+         *
+         * @param callback Called with true if both streams are still good.
+         * @param mode Ignored; the console cannot be synced to disk.
+         */
+        auto internal_flush(FlushCallback callback, FlushMode mode) -> void override;
 };
 }  // namespace SimpleCppLogger
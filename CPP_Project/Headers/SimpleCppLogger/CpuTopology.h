@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include "ApiMacro.h"
+
+namespace SimpleCppLogger
+{
+/**
+ * @class CpuTopology
+ * @brief Maps CPUs to NUMA nodes and pins threads to CPUs.
+ *
+ * On Linux the mapping is read from /sys/devices/system/node once. Elsewhere, or if the
+ * information is not available, all CPUs reported by std::thread::hardware_concurrency() belong
+ * to node 0.
+ */
+class SIMPLECPPLOGGER_API CpuTopology
+{
+    public:
+        /**
+         * @brief Returns the topology of the machine, loading it on first use.
+         * @return The shared topology.
+         */
+        [[nodiscard]] static auto get() -> const CpuTopology&;
+
+        /**
+         * @brief Builds a topology from an explicit CPU-to-node table.
+         * @param node_of_cpu The node of every CPU, indexed by CPU number.
+         */
+        explicit CpuTopology(std::vector<std::size_t> node_of_cpu);
+
+        /**
+         * @brief Returns the number of CPUs, which is one past the highest CPU number.
+         * @return The CPU count.
+         */
+        [[nodiscard]] auto get_cpu_count() const -> std::size_t;
+
+        /**
+         * @brief Returns the number of NUMA nodes.
+         * @return The node count, at least 1.
+         */
+        [[nodiscard]] auto get_node_count() const -> std::size_t;
+
+        /**
+         * @brief Returns the node of a CPU.
+         * @param cpu The CPU number.
+         * @return The node, or 0 for an unknown CPU.
+         */
+        [[nodiscard]] auto get_node_of_cpu(int cpu) const -> std::size_t;
+
+        /**
+         * @brief Returns the CPUs of a node in ascending order.
+         * @param node The node.
+         * @return The CPUs, or an empty span for an unknown node.
+         */
+        [[nodiscard]] auto get_cpus_of_node(std::size_t node) const -> std::span<const int>;
+
+        /**
+         * @brief Returns the CPU the calling thread is running on.
+         * @return The CPU number, or -1 if it cannot be determined.
+         */
+        [[nodiscard]] static auto get_current_cpu() -> int;
+
+        /**
+         * @brief Restricts the calling thread to the given CPUs.
+         * @param cpus The allowed CPUs.
+         * @return True on success, false if pinning is not supported or failed.
+         */
+        static auto pin_current_thread(std::span<const int> cpus) -> bool;
+
+    private:
+        std::vector<std::size_t> m_node_of_cpu;
+        std::vector<std::vector<int>> m_cpus_of_node;
+};
+
+}  // namespace SimpleCppLogger
@@ -0,0 +1,316 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <source_location>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "ApiMacro.h"
+#include "SimpleCppLogger/CompressionCodec.h"
+#include "SimpleCppLogger/IoUring.h"
+#include "SimpleCppLogger/LogAppender.h"
+#include "SimpleCppLogger/LogIndex.h"
+#include "SimpleCppLogger/LogLevel.h"
+#include "SimpleCppLogger/SimpleFormatter.h"
+
+namespace SimpleCppLogger
+{
+/**
+ * @struct FileAppenderOptions
+ * @brief Configuration of a FileAppender.
+ */
+struct FileAppenderOptions {
+        bool append = true;  ///< Append to an existing file instead of truncating it.
+        std::shared_ptr<CompressionCodec> codec;  ///< Compresses each frame; nullptr for text.
+        std::size_t frame_size = 1024 * 1024;     ///< Buffered bytes that complete a frame.
+        std::chrono::milliseconds flush_interval{1000};  ///< Longest wait for a frame.
+        LogLevel flush_level = LogLevel::Error;  ///< Records at this level complete the frame.
+        bool write_index = false;  ///< Write a sidecar index (see LogIndexWriter).
+        std::size_t index_block_records = 1024;  ///< Indexed: records that complete a frame.
+        std::size_t index_bloom_bytes = 1024;    ///< Indexed: Bloom filter size per frame.
+        std::chrono::milliseconds sync_interval{0};  ///< Least time between syncs; 0: on demand.
+        LogLevel durable_level = LogLevel::Count;    ///< Records at this level wait for a sync.
+        bool io_uring = false;          ///< Linux: write through io_uring instead of write(2).
+        std::size_t io_uring_depth = 8;  ///< io_uring: frames in flight at once.
+        std::uint64_t preallocate_size = 0;  ///< Linux: bytes to reserve ahead with fallocate.
+        bool direct_io = false;  ///< Linux: bypass the page cache with O_DIRECT.
+};
+
+/**
+ * @class FileAppender
+ * @brief A log appender that writes formatted lines to a file from a dedicated writer thread.
+ *
+ * Logging threads only append the formatted line to an in-memory frame. The frame is complete
+ * when it reaches frame_size or when a record at or above flush_level arrives; the writer thread
+ * also takes it when its oldest line has waited for flush_interval. The writer compresses each
+ * frame with the configured codec, if any, and writes it with a single system call, so
+ * compression never runs on a logging thread.
+ *
+ * Compressed frames are self-contained, so the file can be read with the codec's standard tools
+ * (e.g. zcat for CompressionType::Zlib). If the writer falls behind by more than four frames of
+ * text, logging threads wait for it instead of buffering without limit. The destructor writes
+ * all buffered lines. flush() completes the pending frame right away and resolves once the
+ * writer has written it, after syncing the file for FlushMode::Durable.
+ *
+ * Syncs are group commits. With a sync_interval, the writer syncs everything written so far at
+ * most once per interval, which bounds the loss on a crash to about one interval. A logging
+ * thread that appends a record at or above durable_level waits until a sync covers the record,
+ * and so do durable flushes; all records written within the same interval share one sync.
+ * Inside a DurableWaitScope, such as the one LoggerContext opens while it calls its appenders,
+ * the thread waits when the scope ends instead.
+ *
+ * With io_uring on Linux, the writer thread copies each frame into one of io_uring_depth
+ * registered buffers and submits a positional write without waiting for it, so a slow disk
+ * no longer stalls it in write(2); syncs are submitted as fdatasync operations that run after
+ * all earlier writes. A second thread reaps the completions and retires the frames in order. If
+ * io_uring is not available, the appender falls back to write(2).
+ *
+ * With preallocate_size on Linux, extents are reserved with fallocate (FALLOC_FL_KEEP_SIZE) in
+ * steps of that size before writes reach them, which saves the filesystem a metadata update per
+ * write and keeps the file contiguous; the file size still grows only with its content, so
+ * readers and later appends never see the reservation. With preallocate_size or direct_io,
+ * write(2) output is staged in a page-aligned buffer and written in whole pages; the last partial
+ * page is written at the end of each batch and rewritten with the next one. direct_io opens the
+ * file with O_DIRECT, so log output does not evict other processes' data from the page cache;
+ * io_uring is then not used, and filesystems without O_DIRECT get cached writes. With O_DIRECT
+ * the partial page is padded with zeros, which the destructor truncates.
+ *
+ * With write_index, every frame is also described in the sidecar file get_index_path(path):
+ * its offset and size, the time range and levels of its records and a Bloom filter of its
+ * tokens. Frames then also end after index_block_records records, so that LogIndexReader can
+ * skip to the frames of a time range or those that may contain a token.
+ */
+class SIMPLECPPLOGGER_API FileAppender: public LogAppender
+{
+    public:
+        /**
+         * @brief Opens the file and starts the writer thread.
+         *
+         * @param path The file to write to.
+         * @param options The frame and compression configuration.
+         * @param formatter The LogFormatter to use; defaults to a SimpleFormatter without colors.
+         */
+        explicit FileAppender(const std::string& path, const FileAppenderOptions& options = {},
+                              const std::shared_ptr<LogFormatter>& formatter =
+                                  std::make_shared<SimpleFormatter>(false));
+
+        /**
+         * @brief Writes all buffered lines, stops the writer thread and closes the file.
+         */
+        ~FileAppender() override;
+
+        FileAppender(const FileAppender&) = delete;
+        auto operator=(const FileAppender&) -> FileAppender& = delete;
+
+        /**
+         * @brief Returns whether the file could be opened.
+         * @return True if records are written to the file.
+         */
+        [[nodiscard]] auto is_open() const -> bool;
+
+        /**
+         * @brief Returns the path of the file.
+         * @return The file path.
+         */
+        [[nodiscard]] auto get_path() const -> const std::string&;
+
+        /**
+         * @brief Returns whether the sidecar index is written.
+         * @return True if write_index is set and the index file could be opened.
+         */
+        [[nodiscard]] auto is_index_open() const -> bool;
+
+        /**
+         * @brief Returns the number of text bytes handed to the writer thread.
+         * @return The uncompressed size of all written frames.
+         */
+        [[nodiscard]] auto get_input_bytes() const -> std::uint64_t;
+
+        /**
+         * @brief Returns the number of bytes written to the file.
+         * @return The written size, after compression.
+         */
+        [[nodiscard]] auto get_written_bytes() const -> std::uint64_t;
+
+        /**
+         * @brief Returns the number of frames written to the file.
+         * @return The frame count.
+         */
+        [[nodiscard]] auto get_frame_count() const -> std::uint64_t;
+
+        /**
+         * @brief Returns whether frames are written through io_uring.
+         * @return True if io_uring was requested and is available.
+         */
+        [[nodiscard]] auto is_io_uring_active() const -> bool;
+
+        /**
+         * @brief Returns the number of times the file was synced to disk.
+         * @return The sync count.
+         */
+        [[nodiscard]] auto get_sync_count() const -> std::uint64_t;
+
+        /**
+         * @brief Returns true; preformatted text is written unchanged.
+         */
+        [[nodiscard]] auto supports_preformatted() const -> bool override;
+
+        /**
+         * @brief Formats all records that pass the level check and adds them to the frame under
+         * a single lock.
+         *
+         * If any of the records is at or above durable_level, waits until the batch is synced.
+         *
+         * @param records The messages to append, with their source locations.
+         */
+        auto append_batch(std::span<const StagedRecord> records) -> void override;
+
+    private:
+        /**
+         * @brief What the index needs to know about the records of the pending frame.
+         */
+        struct FrameStats {
+                std::uint32_t record_count = 0;
+                std::uint32_t level_mask = 0;
+                std::int64_t first_timestamp = 0;
+                std::int64_t last_timestamp = 0;
+        };
+
+        /**
+         * @brief The text of a frame and its index statistics.
+         */
+        struct Frame {
+                std::string text;
+                FrameStats stats;
+        };
+
+        /**
+         * @brief A flush that completes once the first `frame` completed frames are written.
+         */
+        struct FlushRequest {
+                std::uint64_t frame;
+                std::uint64_t write_errors;  ///< m_write_errors when the flush was requested.
+                std::uint64_t sync_errors;   ///< m_sync_errors when the flush was requested.
+                FlushMode mode;
+                FlushCallback callback;
+        };
+
+        /**
+         * @brief A frame in flight through io_uring. Slot i holds the frames whose sequence
+         * number is i modulo io_uring_depth.
+         */
+        struct WriteSlot {
+                std::span<char> buffer;  ///< The registered buffer of this slot.
+                std::string overflow;    ///< Holds frames that do not fit into the buffer.
+                std::span<const char> data;
+                std::uint64_t offset = 0;
+                std::size_t written = 0;
+                std::size_t text_size = 0;
+                LogIndexBlock block;
+                bool failed = false;
+                bool completed = false;
+        };
+
+        auto internal_append(const LogMessage& message,
+                             const std::source_location& location) -> void override;
+
+        auto internal_append_formatted(const LogMessage& message,
+                                       const std::source_location& location,
+                                       std::string&& formatted) -> void override;
+
+        /**
+         * @brief Completes the pending frame and calls the callback once the writer thread has
+         * written it, and synced the file for FlushMode::Durable.
+         *
+         * @param callback Called with false if a frame could not be written or synced.
+         * @param mode Whether the file has to be synced as well.
+         */
+        auto internal_flush(FlushCallback callback, FlushMode mode) -> void override;
+
+        auto add_line(std::unique_lock<std::mutex>& lock, std::string_view text,
+                      const LogMessage& message) -> bool;
+        auto complete_frame() -> void;
+        auto add_flush_request(FlushCallback callback, FlushMode mode) -> void;
+        auto wait_until_durable(std::unique_lock<std::mutex>& lock) -> void;
+        auto run() -> void;
+        auto wait_for_work(std::unique_lock<std::mutex>& lock) -> void;
+        [[nodiscard]] auto is_sync_wanted() const -> bool;
+        auto sync(std::unique_lock<std::mutex>& lock) -> void;
+        auto complete_flush_requests(std::unique_lock<std::mutex>& lock) -> void;
+        auto write_frame(const Frame& frame, std::string& compressed) -> bool;
+        auto write_all(std::string_view data) -> bool;
+        auto make_index_block(const Frame& frame, std::uint64_t offset,
+                              std::size_t stored_size) const -> LogIndexBlock;
+        auto start_io_uring() -> bool;
+        auto submit_frame(const Frame& frame, std::string& compressed) -> void;
+        [[nodiscard]] auto is_io_in_flight() const -> bool;
+        auto finish_write(std::uint64_t sequence, int result) -> void;
+        auto finish_sync(int result) -> void;
+        auto run_reaper() -> void;
+        auto start_staging() -> bool;
+        auto stage(std::string_view data) -> bool;
+        auto write_stage() -> bool;
+        auto write_at(const char* data, std::size_t size, std::uint64_t offset) -> bool;
+        auto reserve(std::uint64_t end) -> void;
+
+        std::string m_path;
+        FileAppenderOptions m_options;
+        int m_fd = -1;
+        std::uint64_t m_file_offset = 0;
+        std::uint64_t m_allocated_end = 0;  ///< End of the extents reserved with fallocate.
+        bool m_direct_io = false;           ///< The file is open with O_DIRECT.
+        bool m_trim_on_close = false;       ///< O_DIRECT padding follows m_file_offset.
+        std::unique_ptr<char[]> m_stage_memory;
+        std::span<char> m_stage;            ///< Page-aligned staging buffer, or empty.
+        std::size_t m_stage_size = 0;       ///< Staged bytes, starting at m_stage_offset.
+        std::size_t m_stage_written = 0;    ///< Staged bytes already in the file.
+        std::uint64_t m_stage_offset = 0;   ///< Page-aligned file offset of the stage.
+        std::vector<LogIndexBlock> m_staged_blocks;  ///< Index entries of unwritten frames.
+        std::unique_ptr<LogIndexWriter> m_index;
+
+        std::mutex m_mutex;
+        std::condition_variable m_wake;
+        std::condition_variable m_space;
+        Frame m_pending;
+        std::chrono::steady_clock::time_point m_pending_since;
+        std::deque<Frame> m_completed;
+        std::size_t m_completed_bytes = 0;
+        std::uint64_t m_completed_frames = 0;  ///< Frames ever completed.
+        std::uint64_t m_written_frames = 0;    ///< Frames ever taken by the writer and written.
+        std::uint64_t m_write_errors = 0;
+        std::uint64_t m_synced_frames = 0;  ///< Frames covered by the last sync.
+        std::uint64_t m_sync_errors = 0;
+        std::chrono::steady_clock::time_point m_next_sync;
+        std::deque<FlushRequest> m_flush_requests;
+        bool m_writer_signaled = false;  ///< A flush request arrived or writes completed.
+        bool m_stopping = false;
+        std::uint64_t m_submitted_frames = 0;  ///< io_uring: frames handed to the ring.
+        std::uint64_t m_sync_target = 0;       ///< io_uring: frames the sync in flight covers.
+        bool m_sync_in_flight = false;
+
+        std::atomic<std::uint64_t> m_input_bytes{0};
+        std::atomic<std::uint64_t> m_written_bytes{0};
+        std::atomic<std::uint64_t> m_frame_count{0};
+        std::atomic<std::uint64_t> m_sync_count{0};
+        std::thread m_writer;
+
+        std::unique_ptr<IoUring> m_ring;
+        std::mutex m_ring_mutex;  ///< Serializes submissions and guards the slots.
+        std::unique_ptr<char[]> m_slot_memory;
+        std::vector<WriteSlot> m_slots;
+        bool m_buffers_registered = false;
+        std::uint64_t m_retired_frames = 0;  ///< io_uring: frames retired, guarded by the slots.
+        std::thread m_reaper;
+};
+
+}  // namespace SimpleCppLogger
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ApiMacro.h"
+#include "SimpleCppLogger/LogAppender.h"
+#include "SimpleCppLogger/LogLevel.h"
+#include "SimpleCppLogger/StagingBuffer.h"
+
+namespace SimpleCppLogger
+{
+/**
+ * @struct FormattingTask
+ * @brief A chunk of records together with the appenders they are destined for.
+ *
+ * The submitter fills records, appenders and levels; the pipeline assigns the sequence number
+ * and fills formatted[appender][record] for every appender that supports preformatted output
+ * and every record that passes the appender's level. All other entries stay empty.
+ */
+struct FormattingTask {
+        std::uint64_t sequence = 0;
+        std::vector<StagedRecord> records;
+        std::vector<std::shared_ptr<LogAppender>> appenders;
+        std::vector<LogLevel> levels;  ///< Appender levels when the task was created.
+        std::vector<std::vector<std::string>> formatted;
+};
+
+/**
+ * @class FormattingPipeline
+ * @brief Formats tasks on a pool of worker threads and writes them strictly in submission order.
+ *
+ * submit() tags each task with the next sequence number. Any idle worker formats it; finished
+ * tasks wait until all earlier ones are written, and a single writer thread hands them to the
+ * writer function one at a time. Formatting therefore scales with the number of workers while
+ * the output order stays identical to the submission order.
+ */
+class SIMPLECPPLOGGER_API FormattingPipeline
+{
+    public:
+        /**
+         * @brief Emits a formatted task. Called on the writer thread only.
+         */
+        using Writer = std::function<void(FormattingTask& task)>;
+
+        /**
+         * @brief Starts the worker threads and the writer thread.
+         *
+         * @param worker_count The number of formatting threads (at least one).
+         * @param max_pending_tasks The number of submitted but unwritten tasks at which
+         * submit() blocks.
+         * @param writer The function that emits formatted tasks.
+         */
+        FormattingPipeline(std::size_t worker_count, std::size_t max_pending_tasks, Writer writer);
+
+        /**
+         * @brief Writes all submitted tasks and joins the threads.
+         */
+        ~FormattingPipeline();
+
+        FormattingPipeline(const FormattingPipeline&) = delete;
+        auto operator=(const FormattingPipeline&) -> FormattingPipeline& = delete;
+
+        /**
+         * @brief Queues a task for formatting, blocking while too many tasks are pending.
+         * @param task The task to format and write.
+         */
+        auto submit(FormattingTask&& task) -> void;
+
+        /**
+         * @brief Blocks until every task submitted so far has been written.
+         */
+        auto wait_idle() -> void;
+
+        /**
+         * @brief Returns the number of formatting threads.
+         * @return The worker count.
+         */
+        [[nodiscard]] auto get_worker_count() const -> std::size_t;
+
+        /**
+         * @brief Fills task.formatted for all appenders that support preformatted output.
+         * @param task The task to format.
+         */
+        static auto format_task(FormattingTask& task) -> void;
+
+    private:
+        auto run_worker() -> void;
+        auto run_writer() -> void;
+
+        Writer m_writer;
+        std::size_t m_max_pending;
+
+        std::mutex m_mutex;
+        std::condition_variable m_work_cv;
+        std::condition_variable m_written_cv;
+        std::condition_variable m_state_cv;
+        std::deque<std::unique_ptr<FormattingTask>> m_queue;
+        std::map<std::uint64_t, std::unique_ptr<FormattingTask>> m_finished;
+        std::uint64_t m_next_sequence = 0;
+        std::uint64_t m_next_to_write = 0;
+        bool m_stopping = false;
+
+        std::vector<std::thread> m_workers;
+        std::thread m_writer_thread;
+};
+
+}  // namespace SimpleCppLogger
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+
+#include "ApiMacro.h"
+
+namespace SimpleCppLogger
+{
+/**
+ * @struct IoUringCompletion
+ * @brief The result of one submitted operation.
+ */
+struct IoUringCompletion {
+        std::uint64_t user_data = 0;  ///< The value passed when the operation was prepared.
+        int result = 0;               ///< Bytes written, 0 for fsync and nop, or -errno.
+};
+
+/**
+ * @class IoUring
+ * @brief A minimal io_uring instance for asynchronous file writes, using the raw system calls.
+ *
+ * Operations are prepared into the submission queue and handed to the kernel with submit(); the
+ * kernel then performs them without blocking the submitting thread, and wait() returns their
+ * completions. Preparing and submitting must be serialized by the caller, and only one thread
+ * may call wait(), but the two may run on different threads.
+ *
+ * io_uring is only used on Linux 5.6 or later and only if the process may create rings (seccomp
+ * filters often forbid it in containers). Otherwise is_open() returns false and the caller has to
+ * fall back to write(2).
+ */
+class SIMPLECPPLOGGER_API IoUring
+{
+    public:
+        /**
+         * @brief Creates a ring.
+         * @param entries The size of the submission queue; rounded up to a power of two.
+         */
+        explicit IoUring(unsigned entries);
+
+        /**
+         * @brief Unmaps and closes the ring. Operations still in flight are completed by the
+         * kernel, but their completions are lost.
+         */
+        ~IoUring();
+
+        IoUring(const IoUring&) = delete;
+        auto operator=(const IoUring&) -> IoUring& = delete;
+
+        /**
+         * @brief Returns whether the ring could be created.
+         * @return True if operations can be submitted.
+         */
+        [[nodiscard]] auto is_open() const -> bool;
+
+        /**
+         * @brief Registers buffers with the kernel so that writes from them skip the per-call
+         * page pinning. Buffer i is addressed as fixed buffer i by prepare_write().
+         *
+         * @param buffers The buffers to register; they must stay valid until the ring is closed.
+         * @return True if the buffers were registered.
+         */
+        auto register_buffers(std::span<const std::span<char>> buffers) -> bool;
+
+        /**
+         * @brief Prepares a positional write.
+         *
+         * @param fd The file to write to.
+         * @param data The bytes to write; they must stay valid until the write completes.
+         * @param offset The file offset to write at.
+         * @param user_data Returned with the completion.
+         * @param fixed_buffer The registered buffer that contains data, or -1.
+         * @return False if the submission queue is full.
+         */
+        auto prepare_write(int fd, std::span<const char> data, std::uint64_t offset,
+                           std::uint64_t user_data, int fixed_buffer = -1) -> bool;
+
+        /**
+         * @brief Prepares an fdatasync that starts only after all previously submitted
+         * operations have completed.
+         *
+         * @param fd The file to sync.
+         * @param user_data Returned with the completion.
+         * @return False if the submission queue is full.
+         */
+        auto prepare_sync(int fd, std::uint64_t user_data) -> bool;
+
+        /**
+         * @brief Prepares an operation that does nothing but complete, e.g. to wake a thread
+         * blocked in wait().
+         *
+         * @param user_data Returned with the completion.
+         * @return False if the submission queue is full.
+         */
+        auto prepare_nop(std::uint64_t user_data) -> bool;
+
+        /**
+         * @brief Hands all prepared operations to the kernel.
+         * @return True if they were all submitted.
+         */
+        auto submit() -> bool;
+
+        /**
+         * @brief Blocks until an operation completes.
+         * @param completion Receives the completion.
+         * @return False if waiting failed.
+         */
+        auto wait(IoUringCompletion& completion) -> bool;
+
+    private:
+        class Impl;
+        std::unique_ptr<Impl> m_impl;
+};
+
+}  // namespace SimpleCppLogger
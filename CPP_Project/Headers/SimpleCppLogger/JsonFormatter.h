@@ -0,0 +1,53 @@
+#pragma once
+
+#include <source_location>
+#include <string>
+#include <string_view>
+
+#include "ApiMacro.h"
+#include "SimpleCppLogger/LogFormatter.h"
+
+namespace SimpleCppLogger
+{
+/**
+ * @class JsonFormatter
+ * @brief A log formatter that renders each log message as a single-line JSON object.
+ *
+ * The object contains the timestamp (ISO 8601, UTC), the level, the category (if any), the
+ * message and, if available, the file, line and function of the source location. String values
+ * are escaped with a vectorized scan (AVX2 or SSE2 when the target supports it, scalar
+ * otherwise), so messages without characters that need escaping are copied in bulk.
+ */
+class SIMPLECPPLOGGER_API JsonFormatter: public LogFormatter
+{
+    public:
+        /**
+         * @brief Constructs a JsonFormatter object.
+         */
+        JsonFormatter() = default;
+
+        /**
+         * @brief Formats the log message as a JSON object without a trailing newline.
+         *
+         * @param log_message The log message to format.
+         * @param location The source location of the log message.
+         * @return The formatted log message as a std::string.
+         */
+        [[nodiscard]] auto format(
+            const LogMessage& log_message,
+            const std::source_location& location = std::source_location::current()) const
+            -> std::string override;
+
+        /**
+         * @brief Appends the JSON-escaped form of the given text to the output string.
+         *
+         * Quotes, backslashes and control characters are escaped; all other bytes (including
+         * UTF-8 sequences) are copied unchanged. No surrounding quotes are added.
+         *
+         * @param out The string to append to.
+         * @param text The text to escape.
+         */
+        static auto append_escaped(std::string& out, std::string_view text) -> void;
+};
+
+}  // namespace SimpleCppLogger
@@ -1,15 +1,59 @@
 #pragma once
 
+#include <functional>
+#include <future>
 #include <memory>
 #include <source_location>
+#include <span>
 #include <string>
+#include <vector>
 
 #include "ApiMacro.h"
 #include "SimpleCppLogger/LogFormatter.h"
 #include "SimpleCppLogger/LogMessage.h"
+#include "SimpleCppLogger/StagingBuffer.h"
 
 namespace SimpleCppLogger
 {
+/**
+ * @enum FlushMode
+ * @brief How far a flush pushes the records logged before it.
+ */
+enum class FlushMode
+{
+    Written,  ///< Handed to the operating system (written to the file, stream or socket).
+    Durable   ///< Also synced to stable storage, for appenders that write to a file.
+};
+
+/**
+ * @brief Receives the result of a flush: true if every record reached the requested state.
+ */
+using FlushCallback = std::function<void(bool success)>;
+
+/**
+ * @class DurableWaitScope
+ * @brief Defers the durable waits of appenders called on this thread to the end of the scope.
+ *
+ * An appender that makes its caller wait until a record is synced (e.g. FileAppender with a
+ * durable_level) passes the wait to wait_for_durable(). Inside a scope, the wait happens when the
+ * scope is destroyed instead, so a caller that appends under a lock can release the lock first
+ * and other threads can join the same sync. Scopes nest; each waits for its own records.
+ */
+class SIMPLECPPLOGGER_API DurableWaitScope
+{
+    public:
+        DurableWaitScope();
+        ~DurableWaitScope();
+        DurableWaitScope(const DurableWaitScope&) = delete;
+        auto operator=(const DurableWaitScope&) -> DurableWaitScope& = delete;
+
+        static auto wait_for_durable(std::future<bool> result) -> void;
+
+    private:
+        DurableWaitScope* m_outer;
+        std::vector<std::future<bool>> m_pending;
+};
+
 /**
  * @class LogAppender
  * @brief An abstract base class for log appenders.
@@ -25,6 +69,75 @@ class SIMPLECPPLOGGER_API LogAppender
 
         auto append(const LogMessage& message,
                     const std::source_location& location = std::source_location::current()) -> void;
+
+        /**
+         * @brief Appends a log message that has already been formatted with format().
+         *
+         * Used by backends that format on worker threads. The level check is the same as in
+         * append(). Appenders that do not support preformatted output ignore the text and
+         * format the message themselves.
+         *
+         * @param message The log message to append.
+         * @param location The source location of the log message.
+         * @param formatted The result of format() for this message.
+         */
+        auto append_formatted(const LogMessage& message, const std::source_location& location,
+                              std::string&& formatted) -> void;
+
+        /**
+         * @brief Appends a batch of log messages in order.
+         *
+         * Called by backends that deliver many records at once. The default implementation calls
+         * append() for each record. Sinks can override it to format the whole batch into one
+         * buffer and write it at once; overrides must apply the same level check as append().
+         *
+         * @param records The messages to append, with their source locations.
+         */
+        virtual auto append_batch(std::span<const StagedRecord> records) -> void;
+
+        /**
+         * @brief Formats a log message with this appender's formatter.
+         *
+         * Does not modify the appender and may be called from any thread.
+         *
+         * @param message The log message to format.
+         * @param location The source location of the log message.
+         * @return The formatted text, or the raw message text if no formatter is set.
+         */
+        [[nodiscard]] virtual auto format(const LogMessage& message,
+                                          const std::source_location& location) const
+            -> std::string;
+
+        /**
+         * @brief Returns whether the appender writes text produced by format() unchanged.
+         *
+         * Only for such appenders is it worth formatting on another thread.
+         *
+         * @return True if append_formatted() uses the given text, false otherwise.
+         */
+        [[nodiscard]] virtual auto supports_preformatted() const -> bool;
+
+        /**
+         * @brief Flushes everything appended before the call.
+         *
+         * @param mode Whether the records only have to be written or also synced to disk.
+         * @return A future that becomes ready once the records have reached the requested state;
+         * its value is false if any of them could not be written or synced.
+         */
+        [[nodiscard]] auto flush(FlushMode mode = FlushMode::Written) -> std::future<bool>;
+
+        /**
+         * @brief Flushes everything appended before the call and reports the result to a
+         * callback.
+         *
+         * The callback runs on the calling thread if the appender writes synchronously, or on
+         * its writer thread otherwise. It must not block on a flush of the same appender.
+         *
+         * @param callback Called exactly once with the result.
+         * @param mode Whether the records only have to be written or also synced to disk.
+         */
+        auto flush(FlushCallback callback, FlushMode mode = FlushMode::Written) -> void;
+
         auto set_formatter(const std::shared_ptr<LogFormatter>& formatter) -> void;
         auto set_log_level(LogLevel level) -> void;
         [[nodiscard]] auto get_log_level() const -> LogLevel;
@@ -46,5 +159,30 @@ class SIMPLECPPLOGGER_API LogAppender
          */
         virtual auto internal_append(const LogMessage& message,
                                      const std::source_location& location) -> void = 0;
+
+        /**
+         * @brief Appends a preformatted log message.
+         *
+         * Called by append_formatted() after the level check. The default implementation
+         * discards the text and calls internal_append().
+         *
+         * @param message The log message to append.
+         * @param location The source location of the log message.
+         * @param formatted The formatted text.
+         */
+        virtual auto internal_append_formatted(const LogMessage& message,
+                                               const std::source_location& location,
+                                               std::string&& formatted) -> void;
+
+        /**
+         * @brief Flushes everything appended so far and calls the callback once done.
+         *
+         * Called by both flush() overloads. The default implementation is for appenders that
+         * write synchronously and have nothing to flush; it calls the callback with true.
+         *
+         * @param callback Called exactly once with the result.
+         * @param mode Whether the records only have to be written or also synced to disk.
+         */
+        virtual auto internal_flush(FlushCallback callback, FlushMode mode) -> void;
 };
 }  // namespace SimpleCppLogger
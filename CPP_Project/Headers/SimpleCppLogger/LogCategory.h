@@ -0,0 +1,82 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string_view>
+
+#include "ApiMacro.h"
+#include "SimpleCppLogger/LogLevel.h"
+
+namespace SimpleCppLogger
+{
+class LogCategoryRegistry;
+
+/**
+ * @class LogCategory
+ * @brief A lightweight handle to a named logging category.
+ *
+ * Handles are obtained from a LogCategoryRegistry (usually via Logger::get_category) and are
+ * cheap to copy. Each handle refers to the category's threshold slot in the registry, so
+ * is_enabled() is a single atomic load and can be evaluated before a message is built.
+ * A default-constructed handle is invalid and does not filter anything by itself.
+ */
+class SIMPLECPPLOGGER_API LogCategory
+{
+        friend class LogCategoryRegistry;
+
+    public:
+        LogCategory() = default;
+
+        /**
+         * @brief Returns whether the handle refers to a registered category.
+         * @return True if the handle is valid, false otherwise.
+         */
+        [[nodiscard]] auto is_valid() const -> bool
+        {
+            return m_threshold != nullptr;
+        }
+
+        /**
+         * @brief Returns the small integer id of the category within its registry.
+         * @return The category id.
+         */
+        [[nodiscard]] auto get_id() const -> std::uint16_t
+        {
+            return m_id;
+        }
+
+        /**
+         * @brief Returns the name of the category.
+         *
+         * The name is owned by the registry and stays valid for the registry's lifetime.
+         *
+         * @return The category name, or an empty view for an invalid handle.
+         */
+        [[nodiscard]] auto get_name() const -> std::string_view
+        {
+            return m_name;
+        }
+
+        /**
+         * @brief Returns whether messages of the given level pass the category threshold.
+         * @param level The level to check.
+         * @return True if the level is at or above the category threshold or the handle is
+         * invalid, false otherwise.
+         */
+        [[nodiscard]] auto is_enabled(LogLevel level) const -> bool
+        {
+            return m_threshold == nullptr || level >= m_threshold->load(std::memory_order_relaxed);
+        }
+
+    private:
+        LogCategory(std::uint16_t id, std::string_view name,
+                    const std::atomic<LogLevel>* threshold)
+            : m_id(id), m_name(name), m_threshold(threshold)
+        {}
+
+        std::uint16_t m_id = 0;
+        std::string_view m_name;
+        const std::atomic<LogLevel>* m_threshold = nullptr;
+};
+
+}  // namespace SimpleCppLogger
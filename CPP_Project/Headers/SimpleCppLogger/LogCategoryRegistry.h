@@ -0,0 +1,114 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "ApiMacro.h"
+#include "SimpleCppLogger/LogCategory.h"
+#include "SimpleCppLogger/LogLevel.h"
+
+namespace SimpleCppLogger
+{
+/**
+ * @class LogCategoryRegistry
+ * @brief Assigns small integer ids to category names and stores per-category thresholds.
+ *
+ * Every category has an effective threshold in a fixed-size atomic array. Categories without
+ * an explicit level follow the registry's default level, which the owning logger keeps in sync
+ * with its own level. Registration and level changes take a mutex; checking a threshold through
+ * a LogCategory handle does not.
+ *
+ * Id 0 is reserved for the unnamed default category. It always follows the default level and
+ * is returned when the registry is full.
+ */
+class SIMPLECPPLOGGER_API LogCategoryRegistry
+{
+    public:
+        /**
+         * @brief The maximum number of categories, including the default category.
+         */
+        static constexpr std::size_t MaxCategories = 256;
+
+        /**
+         * @brief Constructs a registry whose default level is LogLevel::Debug.
+         */
+        LogCategoryRegistry();
+
+        LogCategoryRegistry(const LogCategoryRegistry&) = delete;
+        auto operator=(const LogCategoryRegistry&) -> LogCategoryRegistry& = delete;
+
+        /**
+         * @brief Returns the category with the given name, registering it on first use.
+         * @param name The category name.
+         * @return A handle to the category, or to the default category if the registry is full.
+         */
+        auto get_or_register(std::string_view name) -> LogCategory;
+
+        /**
+         * @brief Looks up an already registered category.
+         * @param name The category name.
+         * @return A handle to the category, or std::nullopt if it is not registered.
+         */
+        [[nodiscard]] auto find(std::string_view name) const -> std::optional<LogCategory>;
+
+        /**
+         * @brief Sets an explicit threshold for a category.
+         *
+         * Has no effect for the default category or handles from another registry.
+         *
+         * @param category The category to configure.
+         * @param level The threshold to set.
+         */
+        auto set_level(const LogCategory& category, LogLevel level) -> void;
+
+        /**
+         * @brief Removes the explicit threshold so the category follows the default level again.
+         * @param category The category to reset.
+         */
+        auto reset_level(const LogCategory& category) -> void;
+
+        /**
+         * @brief Returns the effective threshold of a category.
+         * @param category The category to query.
+         * @return The explicit threshold if set, otherwise the default level.
+         */
+        [[nodiscard]] auto get_level(const LogCategory& category) const -> LogLevel;
+
+        /**
+         * @brief Sets the level followed by all categories without an explicit threshold.
+         * @param level The default level.
+         */
+        auto set_default_level(LogLevel level) -> void;
+
+        /**
+         * @brief Returns the lowest effective threshold of all categories.
+         * @return The lowest threshold, never higher than the default level.
+         */
+        [[nodiscard]] auto get_lowest_level() const -> LogLevel;
+
+        /**
+         * @brief Returns the number of registered categories, including the default category.
+         * @return The number of categories.
+         */
+        [[nodiscard]] auto size() const -> std::size_t;
+
+    private:
+        [[nodiscard]] auto owns(const LogCategory& category) const -> bool;
+        [[nodiscard]] auto make_handle(std::size_t id) const -> LogCategory;
+
+        mutable std::mutex m_mutex;
+        std::array<std::atomic<LogLevel>, MaxCategories> m_thresholds;
+        std::array<bool, MaxCategories> m_has_override{};
+        std::deque<std::string> m_names;
+        std::unordered_map<std::string_view, std::size_t> m_ids;
+        LogLevel m_default_level;
+};
+
+}  // namespace SimpleCppLogger
@@ -0,0 +1,502 @@
+#pragma once
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <source_location>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "ApiMacro.h"
+#include "SimpleCppLogger/LogCategory.h"
+#include "SimpleCppLogger/LogLevel.h"
+#include "SimpleCppLogger/LoggerContext.h"
+
+/**
+ * @file LogFormat.h
+ * @brief std::format-style formatting used by the LOG_*F macros.
+ *
+ * Format strings follow the std::format syntax: "{}" or "{0}" replacement fields, "{{" and "}}"
+ * escapes and the standard specification [[fill]align][sign][#][0][width][.precision][type].
+ * They are checked against the argument types at compile time, like std::format_string.
+ * Arguments can be bool, char, integers, floating-point numbers, strings and void pointers.
+ *
+ * The formatting does not depend on <format>, which not every supported standard library
+ * provides. Compared to std::format, fill characters are single bytes, widths count bytes,
+ * widths and precisions are at most MaxFormatWidth, and nested widths, locale-specific output
+ * ('L') and '#' for floating-point numbers are not supported.
+ */
+
+namespace SimpleCppLogger
+{
+inline constexpr std::size_t MaxFormatWidth = 4096;
+
+namespace detail
+{
+/**
+ * @enum FormatArgKind
+ * @brief The kinds of arguments a format string can refer to.
+ */
+enum class FormatArgKind
+{
+    None,  ///< The type cannot be formatted.
+    Bool,
+    Char,
+    Signed,
+    Unsigned,
+    Floating,
+    String,
+    Pointer
+};
+
+/**
+ * @struct FormatSpec
+ * @brief A parsed format specification.
+ */
+struct FormatSpec {
+        char fill = ' ';
+        char align = '\0';  ///< '<', '>' or '^'; '\0' for the default of the argument kind.
+        char sign = '-';
+        bool alternate = false;
+        bool zero_pad = false;
+        std::size_t width = 0;
+        int precision = -1;  ///< -1 if none was given.
+        char type = '\0';
+};
+
+/**
+ * @struct FormatArg
+ * @brief A type-erased format argument. Strings are referenced, not copied.
+ */
+struct FormatArg {
+        FormatArgKind kind = FormatArgKind::None;
+        std::int64_t integer = 0;            ///< Bool, Char and Signed.
+        std::uint64_t unsigned_integer = 0;  ///< Unsigned and Pointer.
+        double floating = 0.0;
+        std::string_view text;
+};
+
+/**
+ * @brief Returns the kind of argument a type is formatted as, or None.
+ */
+template <typename T>
+constexpr auto format_arg_kind() -> FormatArgKind
+{
+    if constexpr (std::is_same_v<T, bool>)
+    {
+        return FormatArgKind::Bool;
+    }
+    else if constexpr (std::is_same_v<T, char>)
+    {
+        return FormatArgKind::Char;
+    }
+    else if constexpr (std::is_same_v<T, wchar_t> || std::is_same_v<T, char8_t> ||
+                       std::is_same_v<T, char16_t> || std::is_same_v<T, char32_t>)
+    {
+        return FormatArgKind::None;
+    }
+    else if constexpr (std::is_integral_v<T> && sizeof(T) <= sizeof(std::uint64_t))
+    {
+        return std::is_signed_v<T> ? FormatArgKind::Signed : FormatArgKind::Unsigned;
+    }
+    else if constexpr (std::is_floating_point_v<T>)
+    {
+        return FormatArgKind::Floating;
+    }
+    else if constexpr (std::is_same_v<T, std::nullptr_t> ||
+                       (std::is_pointer_v<T> && std::is_void_v<std::remove_pointer_t<T>>))
+    {
+        return FormatArgKind::Pointer;
+    }
+    else if constexpr (std::is_convertible_v<const T&, std::string_view>)
+    {
+        return FormatArgKind::String;
+    }
+    else
+    {
+        return FormatArgKind::None;
+    }
+}
+
+/**
+ * @brief Wraps an argument for append_format_args().
+ */
+template <typename T>
+auto make_format_arg(const T& value) -> FormatArg
+{
+    constexpr FormatArgKind kind = format_arg_kind<T>();
+    static_assert(kind != FormatArgKind::None,
+                  "This type cannot be formatted by the LOG_*F macros");
+
+    FormatArg arg;
+    arg.kind = kind;
+    if constexpr (kind == FormatArgKind::Char)
+    {
+        arg.integer = static_cast<unsigned char>(value);
+    }
+    else if constexpr (kind == FormatArgKind::Bool || kind == FormatArgKind::Signed)
+    {
+        arg.integer = static_cast<std::int64_t>(value);
+    }
+    else if constexpr (kind == FormatArgKind::Unsigned)
+    {
+        arg.unsigned_integer = static_cast<std::uint64_t>(value);
+    }
+    else if constexpr (kind == FormatArgKind::Floating)
+    {
+        arg.floating = static_cast<double>(value);
+    }
+    else if constexpr (kind == FormatArgKind::String && std::is_pointer_v<T>)
+    {
+        arg.text = value != nullptr ? std::string_view(value) : std::string_view();
+    }
+    else if constexpr (kind == FormatArgKind::String)
+    {
+        arg.text = std::string_view(value);
+    }
+    else if constexpr (std::is_pointer_v<T>)
+    {
+        arg.unsigned_integer = reinterpret_cast<std::uintptr_t>(value);
+    }
+    return arg;
+}
+
+constexpr auto is_format_digit(char c) -> bool
+{
+    return c >= '0' && c <= '9';
+}
+
+constexpr auto is_format_align(char c) -> bool
+{
+    return c == '<' || c == '>' || c == '^';
+}
+
+/**
+ * @brief Parses a number of at most MaxFormatWidth at pos.
+ * @return False if the number is too large.
+ */
+constexpr auto parse_format_number(std::string_view text, std::size_t& pos, std::size_t& value)
+    -> bool
+{
+    value = 0;
+    while (pos < text.size() && is_format_digit(text[pos]))
+    {
+        value = value * 10 + static_cast<std::size_t>(text[pos++] - '0');
+        if (value > MaxFormatWidth)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Parses the text after the ':' of a replacement field.
+ * @return False if the text is not a supported specification.
+ */
+constexpr auto parse_format_spec(std::string_view text, FormatSpec& spec) -> bool
+{
+    std::size_t pos = 0;
+    if (text.size() >= 2 && is_format_align(text[1]))
+    {
+        spec.fill = text[0];
+        spec.align = text[1];
+        pos = 2;
+    }
+    else if (!text.empty() && is_format_align(text[0]))
+    {
+        spec.align = text[0];
+        pos = 1;
+    }
+
+    if (pos < text.size() && (text[pos] == '+' || text[pos] == '-' || text[pos] == ' '))
+    {
+        spec.sign = text[pos++];
+    }
+    if (pos < text.size() && text[pos] == '#')
+    {
+        spec.alternate = true;
+        ++pos;
+    }
+    if (pos < text.size() && text[pos] == '0')
+    {
+        spec.zero_pad = true;
+        ++pos;
+    }
+    if (!parse_format_number(text, pos, spec.width))
+    {
+        return false;
+    }
+    if (pos < text.size() && text[pos] == '.')
+    {
+        std::size_t precision = 0;
+        if (++pos == text.size() || !is_format_digit(text[pos]) ||
+            !parse_format_number(text, pos, precision))
+        {
+            return false;
+        }
+        spec.precision = static_cast<int>(precision);
+    }
+    if (pos < text.size() && std::string_view("aAbBcdeEfFgGopsxX").find(text[pos]) !=
+                                 std::string_view::npos)
+    {
+        spec.type = text[pos++];
+    }
+    return pos == text.size() && spec.fill != '{' && spec.fill != '}';
+}
+
+/**
+ * @brief Checks whether a specification applies to an argument kind.
+ */
+constexpr auto is_valid_format_spec(const FormatSpec& spec, FormatArgKind kind) -> bool
+{
+    const bool integer_type =
+        spec.type != '\0' && std::string_view("bBcdoxX").find(spec.type) != std::string_view::npos;
+    const bool numeric_flags = spec.sign != '-' || spec.alternate || spec.zero_pad;
+
+    switch (kind)
+    {
+    case FormatArgKind::Signed:
+    case FormatArgKind::Unsigned:
+        return (spec.type == '\0' || integer_type) && spec.precision < 0 &&
+               !(spec.type == 'c' && numeric_flags);
+    case FormatArgKind::Bool:
+        if (spec.type == '\0' || spec.type == 's')
+        {
+            return !numeric_flags && spec.precision < 0;
+        }
+        return integer_type && spec.type != 'c' && spec.precision < 0;
+    case FormatArgKind::Char:
+        if (spec.type == '\0' || spec.type == 'c')
+        {
+            return !numeric_flags && spec.precision < 0;
+        }
+        return integer_type && spec.precision < 0;
+    case FormatArgKind::Floating:
+        return (spec.type == '\0' ||
+                std::string_view("aAeEfFgG").find(spec.type) != std::string_view::npos) &&
+               !spec.alternate;
+    case FormatArgKind::String:
+        return (spec.type == '\0' || spec.type == 's') && !numeric_flags;
+    case FormatArgKind::Pointer:
+        return (spec.type == '\0' || spec.type == 'p') && !numeric_flags && spec.precision < 0;
+    case FormatArgKind::None:
+        break;
+    }
+    return false;
+}
+
+/**
+ * @brief Walks a format string and reports its literal text and replacement fields in order.
+ *
+ * @param format The format string.
+ * @param on_text Called with each run of literal text, with escapes resolved.
+ * @param on_field Called with the argument index and specification of each field; returns
+ * false to stop.
+ * @return False if the format string is malformed or on_field returned false.
+ */
+template <typename OnText, typename OnField>
+constexpr auto scan_format(std::string_view format, OnText&& on_text, OnField&& on_field) -> bool
+{
+    enum class Indexing
+    {
+        Unknown,
+        Automatic,
+        Manual
+    };
+
+    Indexing indexing = Indexing::Unknown;
+    std::size_t next_arg = 0;
+    std::size_t pos = 0;
+
+    while (pos < format.size())
+    {
+        const std::size_t brace = format.find_first_of("{}", pos);
+        if (brace == std::string_view::npos)
+        {
+            on_text(format.substr(pos));
+            break;
+        }
+        if (brace > pos)
+        {
+            on_text(format.substr(pos, brace - pos));
+        }
+        if (brace + 1 < format.size() && format[brace + 1] == format[brace])
+        {
+            on_text(format.substr(brace, 1));
+            pos = brace + 2;
+            continue;
+        }
+
+        const std::size_t close = format.find('}', brace + 1);
+        if (format[brace] == '}' || close == std::string_view::npos)
+        {
+            return false;
+        }
+
+        const std::string_view field = format.substr(brace + 1, close - brace - 1);
+        std::size_t id_end = 0;
+        std::size_t index = 0;
+        if (!parse_format_number(field, id_end, index) || field.find('{') != std::string_view::npos)
+        {
+            return false;
+        }
+
+        if (id_end == 0)
+        {
+            if (indexing == Indexing::Manual)
+            {
+                return false;
+            }
+            indexing = Indexing::Automatic;
+            index = next_arg++;
+        }
+        else
+        {
+            if (indexing == Indexing::Automatic || (id_end > 1 && field[0] == '0'))
+            {
+                return false;
+            }
+            indexing = Indexing::Manual;
+        }
+
+        FormatSpec spec;
+        const std::string_view rest = field.substr(id_end);
+        if (!rest.empty() && (rest[0] != ':' || !parse_format_spec(rest.substr(1), spec)))
+        {
+            return false;
+        }
+        if (!on_field(index, spec))
+        {
+            return false;
+        }
+        pos = close + 1;
+    }
+    return true;
+}
+
+/**
+ * @brief Checks a format string against the argument types.
+ */
+template <typename... Args>
+consteval auto is_valid_format(std::string_view format) -> bool
+{
+    constexpr std::array<FormatArgKind, sizeof...(Args)> kinds{
+        format_arg_kind<std::remove_cvref_t<Args>>()...};
+
+    return scan_format(
+        format, [](std::string_view) {},
+        [&kinds](std::size_t index, const FormatSpec& spec) {
+            return index < kinds.size() && is_valid_format_spec(spec, kinds[index]);
+        });
+}
+
+/**
+ * @brief Not constexpr, so calling it from the consteval FormatString constructor turns an
+ * invalid format string into a compile error that names this function.
+ */
+inline auto format_string_is_invalid() -> void {}
+
+/**
+ * @brief Appends the formatted text to a string.
+ *
+ * The format string must have been checked with is_valid_format(); fields that do not match
+ * the arguments are skipped.
+ */
+SIMPLECPPLOGGER_API auto append_format_args(std::string& out, std::string_view format,
+                                            std::span<const FormatArg> args) -> void;
+}  // namespace detail
+
+/**
+ * @class BasicFormatString
+ * @brief A format string that was checked against the argument types at compile time.
+ */
+template <typename... Args>
+class BasicFormatString
+{
+    public:
+        template <typename T>
+            requires std::convertible_to<const T&, std::string_view>
+        consteval BasicFormatString(const T& text): m_text(text)
+        {
+            if (!detail::is_valid_format<Args...>(m_text))
+            {
+                detail::format_string_is_invalid();
+            }
+        }
+
+        [[nodiscard]] constexpr auto get() const -> std::string_view
+        {
+            return m_text;
+        }
+
+    private:
+        std::string_view m_text;
+};
+
+/**
+ * @brief The format string parameter type; the arguments are not deduced from it.
+ */
+template <typename... Args>
+using FormatString = BasicFormatString<std::type_identity_t<Args>...>;
+
+/**
+ * @brief Formats the arguments and appends the text to a string.
+ *
+ * @param out The string to append to.
+ * @param format The format string.
+ * @param args The format arguments.
+ */
+template <typename... Args>
+auto append_format(std::string& out, FormatString<Args...> format, const Args&... args) -> void
+{
+    const std::array<detail::FormatArg, sizeof...(Args)> arguments{
+        detail::make_format_arg(args)...};
+    detail::append_format_args(out, format.get(), arguments);
+}
+
+/**
+ * @brief Formats a message and logs it.
+ *
+ * The text is formatted straight into the string that becomes the message payload and is moved
+ * into the log message.
+ *
+ * @param context The context to log to.
+ * @param level The severity level of the log message.
+ * @param location The source location of the log message.
+ * @param format The format string.
+ * @param args The format arguments.
+ */
+template <typename... Args>
+auto log_format(LoggerContext& context, LogLevel level, const std::source_location& location,
+                FormatString<Args...> format, const Args&... args) -> void
+{
+    std::string message;
+    append_format(message, format, args...);
+    context.log(level, std::move(message), location);
+}
+
+/**
+ * @brief Formats a categorized message and logs it.
+ *
+ * @param context The context the category belongs to.
+ * @param category The category of the log message.
+ * @param level The severity level of the log message.
+ * @param location The source location of the log message.
+ * @param format The format string.
+ * @param args The format arguments.
+ */
+template <typename... Args>
+auto log_format(LoggerContext& context, const LogCategory& category, LogLevel level,
+                const std::source_location& location, FormatString<Args...> format,
+                const Args&... args) -> void
+{
+    std::string message;
+    append_format(message, format, args...);
+    context.log(category, level, std::move(message), location);
+}
+}  // namespace SimpleCppLogger
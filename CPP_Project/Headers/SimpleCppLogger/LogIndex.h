@@ -0,0 +1,187 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "ApiMacro.h"
+#include "SimpleCppLogger/CompressionCodec.h"
+#include "SimpleCppLogger/LogLevel.h"
+#include "SimpleCppLogger/LogMessage.h"
+
+namespace SimpleCppLogger
+{
+/**
+ * @struct LogIndexBlock
+ * @brief Describes one block of a log file: where it is stored and what it may contain.
+ *
+ * A block is one frame written by a FileAppender. Timestamps are nanoseconds since the epoch of
+ * LogMessage::Clock. The Bloom filter holds the tokens of the block's text, where a token is a
+ * maximal run of letters, digits, '_' and non-ASCII bytes.
+ */
+struct SIMPLECPPLOGGER_API LogIndexBlock {
+        std::uint64_t file_offset = 0;   ///< Start of the block in the log file.
+        std::uint64_t stored_size = 0;   ///< Size of the block in the file, after compression.
+        std::uint64_t text_size = 0;     ///< Size of the block's text.
+        std::int64_t first_timestamp = 0;  ///< Earliest record timestamp.
+        std::int64_t last_timestamp = 0;   ///< Latest record timestamp.
+        std::uint32_t record_count = 0;
+        std::uint32_t level_mask = 0;  ///< Bit n is set if a record has level n.
+        std::vector<std::uint64_t> bloom;
+
+        /**
+         * @brief Adds all tokens of the text to the Bloom filter.
+         * @param text The text to tokenize.
+         */
+        auto add_tokens(std::string_view text) -> void;
+
+        /**
+         * @brief Returns whether the block may contain all tokens of the text.
+         * @param text The text to tokenize.
+         * @return False only if one of the tokens is certainly not in the block.
+         */
+        [[nodiscard]] auto may_contain_tokens(std::string_view text) const -> bool;
+
+        /**
+         * @brief Returns whether the block contains a record at or above the given level.
+         * @param level The minimum level.
+         * @return True if such a record exists.
+         */
+        [[nodiscard]] auto has_level_at_least(LogLevel level) const -> bool;
+};
+
+/**
+ * @struct LogIndexQuery
+ * @brief Selects the blocks of an indexed log file that may contain matching records.
+ */
+struct LogIndexQuery {
+        std::optional<LogMessage::Clock::time_point> from;  ///< Earliest timestamp of interest.
+        std::optional<LogMessage::Clock::time_point> to;    ///< Latest timestamp of interest.
+        LogLevel min_level = LogLevel::Trace;  ///< Blocks without such records are skipped.
+        std::string tokens;  ///< Blocks that lack one of these tokens are skipped.
+};
+
+/**
+ * @brief Returns the path of the sidecar index that belongs to a log file.
+ * @param log_path The path of the log file.
+ * @return The log path followed by ".idx".
+ */
+[[nodiscard]] SIMPLECPPLOGGER_API auto get_index_path(const std::string& log_path) -> std::string;
+
+/**
+ * @class LogIndexWriter
+ * @brief Appends block descriptions to a sidecar index file.
+ *
+ * The file starts with a header that records the Bloom filter size and the name of the codec
+ * used for the log file, followed by one fixed-size entry per block in native byte order. When
+ * appending to an index whose header does not match, the index is started over.
+ */
+class SIMPLECPPLOGGER_API LogIndexWriter
+{
+    public:
+        /**
+         * @brief Opens or creates the index file.
+         *
+         * @param path The index file.
+         * @param append Keep the existing entries if the header matches.
+         * @param bloom_bytes Size of each block's Bloom filter, rounded up to 8 bytes.
+         * @param codec_name Name of the log file's codec, or empty for plain text.
+         */
+        LogIndexWriter(const std::string& path, bool append, std::size_t bloom_bytes,
+                       std::string_view codec_name);
+
+        /**
+         * @brief Closes the index file.
+         */
+        ~LogIndexWriter();
+
+        LogIndexWriter(const LogIndexWriter&) = delete;
+        auto operator=(const LogIndexWriter&) -> LogIndexWriter& = delete;
+
+        /**
+         * @brief Returns whether the index file could be opened.
+         * @return True if entries are written.
+         */
+        [[nodiscard]] auto is_open() const -> bool;
+
+        /**
+         * @brief Returns the number of 64-bit words in each block's Bloom filter.
+         * @return The Bloom filter size in words.
+         */
+        [[nodiscard]] auto get_bloom_words() const -> std::size_t;
+
+        /**
+         * @brief Appends the entry of a block and flushes it to the file.
+         * @param block The block; its Bloom filter must have get_bloom_words() words.
+         * @return True on success.
+         */
+        auto write(const LogIndexBlock& block) -> bool;
+
+    private:
+        std::FILE* m_file = nullptr;
+        std::size_t m_bloom_words;
+};
+
+/**
+ * @class LogIndexReader
+ * @brief Loads a sidecar index and selects the blocks that may match a query.
+ *
+ * An incomplete entry at the end of the file, as left by a crash, is ignored.
+ */
+class SIMPLECPPLOGGER_API LogIndexReader
+{
+    public:
+        /**
+         * @brief Loads all entries of the index file.
+         * @param path The index file.
+         */
+        explicit LogIndexReader(const std::string& path);
+
+        /**
+         * @brief Returns whether the index could be loaded.
+         * @return True if the file exists and has a valid header.
+         */
+        [[nodiscard]] auto is_open() const -> bool;
+
+        /**
+         * @brief Returns the name of the codec the log file was written with.
+         * @return The codec name, or an empty view for plain text.
+         */
+        [[nodiscard]] auto get_codec_name() const -> std::string_view;
+
+        /**
+         * @brief Returns all blocks in file order.
+         * @return The blocks.
+         */
+        [[nodiscard]] auto get_blocks() const -> const std::vector<LogIndexBlock>&;
+
+        /**
+         * @brief Returns the blocks that may contain records matching the query.
+         * @param query The time range, level and tokens to look for.
+         * @return The candidate blocks in file order.
+         */
+        [[nodiscard]] auto find(const LogIndexQuery& query) const -> std::vector<LogIndexBlock>;
+
+        /**
+         * @brief Reads the text of a block from the log file.
+         *
+         * @param log_file The log file, opened in binary mode.
+         * @param block The block to read.
+         * @param codec The codec to decompress with, or nullptr for plain text.
+         * @param out The string the text is appended to.
+         * @return True on success.
+         */
+        static auto read_block(std::FILE* log_file, const LogIndexBlock& block,
+                               CompressionCodec* codec, std::string& out) -> bool;
+
+    private:
+        std::string m_codec_name;
+        std::vector<LogIndexBlock> m_blocks;
+        bool m_open = false;
+};
+
+}  // namespace SimpleCppLogger
@@ -1,5 +1,8 @@
 #pragma once
+#include "SimpleCppLogger/LogFormat.h"
 #include "SimpleCppLogger/LogStream.h"
+#include "SimpleCppLogger/Logger.h"
+#include "SimpleCppLogger/WLogStream.h"
 
 #define LOG_DEBUG                                                    \
     ::SimpleCppLogger::LogStream(::SimpleCppLogger::LogLevel::Debug, \
@@ -18,3 +21,178 @@
 #define LOG_TRACE                                                    \
     ::SimpleCppLogger::LogStream(::SimpleCppLogger::LogLevel::Trace, \
                                  std::source_location::current())
+
+/**
+ * @def SIMPLECPPLOGGER_LOG_CATEGORY
+ * @brief Streams a message of the given level into a category.
+ *
+ * The category threshold is checked before the stream is created, so the streamed
+ * expressions are not evaluated for disabled levels.
+ */
+#define SIMPLECPPLOGGER_LOG_CATEGORY(category, level)                                    \
+    if (!(category).is_enabled(::SimpleCppLogger::LogLevel::level))                      \
+    {                                                                                    \
+    }                                                                                    \
+    else                                                                                 \
+        ::SimpleCppLogger::LogStream((category), ::SimpleCppLogger::LogLevel::level,     \
+                                     std::source_location::current())
+
+#define LOG_CAT_TRACE(category)   SIMPLECPPLOGGER_LOG_CATEGORY(category, Trace)
+#define LOG_CAT_DEBUG(category)   SIMPLECPPLOGGER_LOG_CATEGORY(category, Debug)
+#define LOG_CAT_INFO(category)    SIMPLECPPLOGGER_LOG_CATEGORY(category, Info)
+#define LOG_CAT_WARNING(category) SIMPLECPPLOGGER_LOG_CATEGORY(category, Warning)
+#define LOG_CAT_ERROR(category)   SIMPLECPPLOGGER_LOG_CATEGORY(category, Error)
+#define LOG_CAT_FATAL(category)   SIMPLECPPLOGGER_LOG_CATEGORY(category, Fatal)
+
+/**
+ * @def SIMPLECPPLOGGER_LOG_CONTEXT
+ * @brief Streams a message of the given level into a specific LoggerContext.
+ */
+#define SIMPLECPPLOGGER_LOG_CONTEXT(context, level)                              \
+    ::SimpleCppLogger::LogStream((context), ::SimpleCppLogger::LogLevel::level, \
+                                 std::source_location::current())
+
+#define LOG_CTX_TRACE(context)   SIMPLECPPLOGGER_LOG_CONTEXT(context, Trace)
+#define LOG_CTX_DEBUG(context)   SIMPLECPPLOGGER_LOG_CONTEXT(context, Debug)
+#define LOG_CTX_INFO(context)    SIMPLECPPLOGGER_LOG_CONTEXT(context, Info)
+#define LOG_CTX_WARNING(context) SIMPLECPPLOGGER_LOG_CONTEXT(context, Warning)
+#define LOG_CTX_ERROR(context)   SIMPLECPPLOGGER_LOG_CONTEXT(context, Error)
+#define LOG_CTX_FATAL(context)   SIMPLECPPLOGGER_LOG_CONTEXT(context, Fatal)
+
+/**
+ * @def SIMPLECPPLOGGER_LOG_CONTEXT_CATEGORY
+ * @brief Streams a message of the given level into a category of a specific LoggerContext.
+ *
+ * The category must have been obtained from the same context.
+ */
+#define SIMPLECPPLOGGER_LOG_CONTEXT_CATEGORY(context, category, level)                  \
+    if (!(category).is_enabled(::SimpleCppLogger::LogLevel::level))                     \
+    {                                                                                   \
+    }                                                                                   \
+    else                                                                                \
+        ::SimpleCppLogger::LogStream((context), (category),                             \
+                                     ::SimpleCppLogger::LogLevel::level,                \
+                                     std::source_location::current())
+
+#define LOG_CTX_CAT_TRACE(context, category) \
+    SIMPLECPPLOGGER_LOG_CONTEXT_CATEGORY(context, category, Trace)
+#define LOG_CTX_CAT_DEBUG(context, category) \
+    SIMPLECPPLOGGER_LOG_CONTEXT_CATEGORY(context, category, Debug)
+#define LOG_CTX_CAT_INFO(context, category) \
+    SIMPLECPPLOGGER_LOG_CONTEXT_CATEGORY(context, category, Info)
+#define LOG_CTX_CAT_WARNING(context, category) \
+    SIMPLECPPLOGGER_LOG_CONTEXT_CATEGORY(context, category, Warning)
+#define LOG_CTX_CAT_ERROR(context, category) \
+    SIMPLECPPLOGGER_LOG_CONTEXT_CATEGORY(context, category, Error)
+#define LOG_CTX_CAT_FATAL(context, category) \
+    SIMPLECPPLOGGER_LOG_CONTEXT_CATEGORY(context, category, Fatal)
+
+/**
+ * @def SIMPLECPPLOGGER_WLOG
+ * @brief Streams a wide-character message of the given level into the global Logger.
+ *
+ * The level is checked before the stream is created, so filtered wide messages are neither
+ * built nor converted.
+ */
+#define SIMPLECPPLOGGER_WLOG(level)                                                        \
+    if (!::SimpleCppLogger::Logger::get_instance().is_enabled(                             \
+            ::SimpleCppLogger::LogLevel::level))                                           \
+    {                                                                                      \
+    }                                                                                      \
+    else                                                                                   \
+        ::SimpleCppLogger::WLogStream(::SimpleCppLogger::LogLevel::level,                  \
+                                      std::source_location::current())
+
+#define WLOG_TRACE   SIMPLECPPLOGGER_WLOG(Trace)
+#define WLOG_DEBUG   SIMPLECPPLOGGER_WLOG(Debug)
+#define WLOG_INFO    SIMPLECPPLOGGER_WLOG(Info)
+#define WLOG_WARNING SIMPLECPPLOGGER_WLOG(Warning)
+#define WLOG_ERROR   SIMPLECPPLOGGER_WLOG(Error)
+#define WLOG_FATAL   SIMPLECPPLOGGER_WLOG(Fatal)
+
+/**
+ * @def SIMPLECPPLOGGER_WLOG_CATEGORY
+ * @brief Streams a wide-character message of the given level into a category.
+ */
+#define SIMPLECPPLOGGER_WLOG_CATEGORY(category, level)                                     \
+    if (!(category).is_enabled(::SimpleCppLogger::LogLevel::level))                        \
+    {                                                                                      \
+    }                                                                                      \
+    else                                                                                   \
+        ::SimpleCppLogger::WLogStream((category), ::SimpleCppLogger::LogLevel::level,      \
+                                      std::source_location::current())
+
+#define WLOG_CAT_TRACE(category)   SIMPLECPPLOGGER_WLOG_CATEGORY(category, Trace)
+#define WLOG_CAT_DEBUG(category)   SIMPLECPPLOGGER_WLOG_CATEGORY(category, Debug)
+#define WLOG_CAT_INFO(category)    SIMPLECPPLOGGER_WLOG_CATEGORY(category, Info)
+#define WLOG_CAT_WARNING(category) SIMPLECPPLOGGER_WLOG_CATEGORY(category, Warning)
+#define WLOG_CAT_ERROR(category)   SIMPLECPPLOGGER_WLOG_CATEGORY(category, Error)
+#define WLOG_CAT_FATAL(category)   SIMPLECPPLOGGER_WLOG_CATEGORY(category, Fatal)
+
+/**
+ * @def SIMPLECPPLOGGER_LOG_FORMAT
+ * @brief Logs a std::format-style message of the given level into a specific LoggerContext.
+ *
+ * The first variadic argument is the format string, which is checked at compile time (see
+ * LogFormat.h). The level is checked first, so the arguments are not evaluated for disabled
+ * levels.
+ */
+#define SIMPLECPPLOGGER_LOG_FORMAT(context, level, ...)                                   \
+    if (!(context).is_enabled(::SimpleCppLogger::LogLevel::level))                        \
+    {                                                                                     \
+    }                                                                                     \
+    else                                                                                  \
+        ::SimpleCppLogger::log_format((context), ::SimpleCppLogger::LogLevel::level,      \
+                                      std::source_location::current(), __VA_ARGS__)
+
+/**
+ * @def SIMPLECPPLOGGER_LOG_FORMAT_CATEGORY
+ * @brief Logs a std::format-style message of the given level into a category.
+ */
+#define SIMPLECPPLOGGER_LOG_FORMAT_CATEGORY(context, category, level, ...)                \
+    if (!(category).is_enabled(::SimpleCppLogger::LogLevel::level))                       \
+    {                                                                                     \
+    }                                                                                     \
+    else                                                                                  \
+        ::SimpleCppLogger::log_format((context), (category),                              \
+                                      ::SimpleCppLogger::LogLevel::level,                 \
+                                      std::source_location::current(), __VA_ARGS__)
+
+#define LOG_TRACEF(...) \
+    SIMPLECPPLOGGER_LOG_FORMAT(::SimpleCppLogger::Logger::get_instance(), Trace, __VA_ARGS__)
+#define LOG_DEBUGF(...) \
+    SIMPLECPPLOGGER_LOG_FORMAT(::SimpleCppLogger::Logger::get_instance(), Debug, __VA_ARGS__)
+#define LOG_INFOF(...) \
+    SIMPLECPPLOGGER_LOG_FORMAT(::SimpleCppLogger::Logger::get_instance(), Info, __VA_ARGS__)
+#define LOG_WARNINGF(...) \
+    SIMPLECPPLOGGER_LOG_FORMAT(::SimpleCppLogger::Logger::get_instance(), Warning, __VA_ARGS__)
+#define LOG_ERRORF(...) \
+    SIMPLECPPLOGGER_LOG_FORMAT(::SimpleCppLogger::Logger::get_instance(), Error, __VA_ARGS__)
+#define LOG_FATALF(...) \
+    SIMPLECPPLOGGER_LOG_FORMAT(::SimpleCppLogger::Logger::get_instance(), Fatal, __VA_ARGS__)
+
+#define LOG_CAT_TRACEF(category, ...)                                                        \
+    SIMPLECPPLOGGER_LOG_FORMAT_CATEGORY(::SimpleCppLogger::Logger::get_instance(), category, \
+                                        Trace, __VA_ARGS__)
+#define LOG_CAT_DEBUGF(category, ...)                                                        \
+    SIMPLECPPLOGGER_LOG_FORMAT_CATEGORY(::SimpleCppLogger::Logger::get_instance(), category, \
+                                        Debug, __VA_ARGS__)
+#define LOG_CAT_INFOF(category, ...)                                                         \
+    SIMPLECPPLOGGER_LOG_FORMAT_CATEGORY(::SimpleCppLogger::Logger::get_instance(), category, \
+                                        Info, __VA_ARGS__)
+#define LOG_CAT_WARNINGF(category, ...)                                                      \
+    SIMPLECPPLOGGER_LOG_FORMAT_CATEGORY(::SimpleCppLogger::Logger::get_instance(), category, \
+                                        Warning, __VA_ARGS__)
+#define LOG_CAT_ERRORF(category, ...)                                                        \
+    SIMPLECPPLOGGER_LOG_FORMAT_CATEGORY(::SimpleCppLogger::Logger::get_instance(), category, \
+                                        Error, __VA_ARGS__)
+#define LOG_CAT_FATALF(category, ...)                                                        \
+    SIMPLECPPLOGGER_LOG_FORMAT_CATEGORY(::SimpleCppLogger::Logger::get_instance(), category, \
+                                        Fatal, __VA_ARGS__)
+
+#define LOG_CTX_TRACEF(context, ...)   SIMPLECPPLOGGER_LOG_FORMAT(context, Trace, __VA_ARGS__)
+#define LOG_CTX_DEBUGF(context, ...)   SIMPLECPPLOGGER_LOG_FORMAT(context, Debug, __VA_ARGS__)
+#define LOG_CTX_INFOF(context, ...)    SIMPLECPPLOGGER_LOG_FORMAT(context, Info, __VA_ARGS__)
+#define LOG_CTX_WARNINGF(context, ...) SIMPLECPPLOGGER_LOG_FORMAT(context, Warning, __VA_ARGS__)
+#define LOG_CTX_ERRORF(context, ...)   SIMPLECPPLOGGER_LOG_FORMAT(context, Error, __VA_ARGS__)
+#define LOG_CTX_FATALF(context, ...)   SIMPLECPPLOGGER_LOG_FORMAT(context, Fatal, __VA_ARGS__)
@@ -1,6 +1,11 @@
 #pragma once
 
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <string_view>
 
 #include "ApiMacro.h"
 #include "SimpleCppLogger/LogLevel.h"
@@ -10,14 +15,48 @@ namespace SimpleCppLogger
 class SIMPLECPPLOGGER_API LogMessage
 {
     public:
+        using Clock = std::chrono::system_clock;
+
         LogMessage(LogLevel level = LogLevel::Info, std::string message = std::string());
+        LogMessage(LogLevel level, std::string message, std::string_view category);
+        LogMessage(LogLevel level, std::string message, std::string_view category,
+                   std::string file, std::uint32_t line, std::string function);
+        LogMessage(LogLevel level, std::wstring message, std::string_view category = {});
+        LogMessage(const LogMessage&) = default;
+        LogMessage(LogMessage&&) noexcept = default;
+        auto operator=(const LogMessage&) -> LogMessage& = default;
+        auto operator=(LogMessage&&) noexcept -> LogMessage& = default;
         virtual ~LogMessage() = default;
 
         [[nodiscard]] auto get_level() const -> LogLevel;
         [[nodiscard]] auto get_message() const -> const std::string&;
+        [[nodiscard]] auto is_wide() const -> bool;
+        [[nodiscard]] auto get_wide_message() const -> std::wstring_view;
+        [[nodiscard]] auto get_timestamp() const -> Clock::time_point;
+        [[nodiscard]] auto get_category() const -> std::string_view;
+        [[nodiscard]] auto get_file() const -> std::string_view;
+        [[nodiscard]] auto get_line() const -> std::uint32_t;
+        [[nodiscard]] auto get_function() const -> std::string_view;
+        [[nodiscard]] auto has_source_context() const -> bool;
 
     private:
+        /**
+         * @brief A wide payload and its UTF-8 form, which is created on first use. Copies of a
+         * message share the payload, so the conversion happens at most once.
+         */
+        struct WidePayload {
+                std::wstring text;
+                std::once_flag converted;
+                std::string utf8;
+        };
+
         LogLevel m_level;
         std::string m_message;
+        Clock::time_point m_timestamp;
+        std::string_view m_category;
+        std::string m_file;
+        std::uint32_t m_line = 0;
+        std::string m_function;
+        std::shared_ptr<WidePayload> m_wide;
 };
 }  // namespace SimpleCppLogger
@@ -7,16 +7,20 @@
 #include <sstream>
 #include <string>
 
+#include "SimpleCppLogger/LogCategory.h"
 #include "SimpleCppLogger/LogLevel.h"
 
 namespace SimpleCppLogger
 {
+class LoggerContext;
+
 /**
  * @class LogStream
  * @brief Helper class for stream-style logging.
  *
  * This class allows logging messages using the stream operator (<<).
- * The message is sent to the logger when the LogStream object is destroyed.
+ * The message is sent to the logger when the LogStream object is destroyed. Unless a context
+ * is given, the message goes to the global Logger.
  */
 class LogStream
 {
@@ -28,6 +32,34 @@ class LogStream
          */
         LogStream(LogLevel level, std::source_location location = std::source_location::current());
 
+        /**
+         * @brief Constructs a LogStream for a message that belongs to a category.
+         * @param category The category of the message.
+         * @param level The log level.
+         * @param location The source location (defaults to caller location).
+         */
+        LogStream(const LogCategory& category, LogLevel level,
+                  std::source_location location = std::source_location::current());
+
+        /**
+         * @brief Constructs a LogStream that sends its message to the given context.
+         * @param context The logger context that receives the message.
+         * @param level The log level.
+         * @param location The source location (defaults to caller location).
+         */
+        LogStream(LoggerContext& context, LogLevel level,
+                  std::source_location location = std::source_location::current());
+
+        /**
+         * @brief Constructs a LogStream that sends a categorized message to the given context.
+         * @param context The logger context that receives the message.
+         * @param category The category of the message.
+         * @param level The log level.
+         * @param location The source location (defaults to caller location).
+         */
+        LogStream(LoggerContext& context, const LogCategory& category, LogLevel level,
+                  std::source_location location = std::source_location::current());
+
         /**
          * @brief Appends a value to the log message.
          * @tparam T The type of the value.
@@ -54,9 +86,11 @@ class LogStream
         ~LogStream();
 
     private:
+        LoggerContext* m_context;
         LogLevel m_level;
         std::ostringstream m_stream;
         std::source_location m_location;
+        LogCategory m_category;
 };
 
 }  // namespace SimpleCppLogger
@@ -2,15 +2,8 @@
 
 #include <CommonLib/Patterns/Singleton.h>
 
-#include <memory>
-#include <mutex>
-#include <source_location>
-#include <string>
-#include <vector>
-
 #include "ApiMacro.h"
-#include "SimpleCppLogger/LogAppender.h"
-#include "SimpleCppLogger/LogLevel.h"
+#include "SimpleCppLogger/LoggerContext.h"
 
 namespace SimpleCppLogger
 {
@@ -18,70 +11,16 @@ namespace SimpleCppLogger
  * @class Logger
  * @brief A singleton logger for logging messages with various severity levels.
  *
- * This class provides methods to log messages, manage log appenders, and set the log level.
- * It supports thread-safe operations and allows multiple appenders for flexible output.
+ * The process-wide LoggerContext used by the LOG_* macros. It starts with a ConsoleAppender.
+ * Subsystems that need an isolated pipeline can create their own LoggerContext instead.
  */
-class SIMPLECPPLOGGER_API Logger: public CommonLib::Singleton<Logger>
+class SIMPLECPPLOGGER_API Logger: public LoggerContext, public CommonLib::Singleton<Logger>
 {
         friend class CommonLib::Singleton<Logger>;
 
     private:
         Logger();
         ~Logger() override;
-
-        class Impl;
-        std::unique_ptr<Impl> m_impl;
-
-    public:
-        /**
-         * @brief Logs a message with the specified log level and source location.
-         * @param level The severity level of the log message.
-         * @param message The log message content.
-         * @param location The source location of the log message (defaults to caller location).
-         */
-        auto log(LogLevel level, const std::string& message,
-                 const std::source_location& location = std::source_location::current()) -> void;
-
-        /**
-         * @brief Convenience overload to log with explicit context (file, line, function,
-         * category).
-         *
-         * Appends the provided context to the message and forwards to the main log() with a
-         * default-constructed std::source_location to avoid stamping the caller (e.g. adapter)
-         * location.
-         *
-         * @param level The severity level of the log message.
-         * @param message The log message content.
-         * @param file Optional source file path (may be nullptr or empty).
-         * @param line Optional source line number (<= 0 if unknown).
-         * @param function Optional function signature (may be nullptr or empty).
-         * @param category Optional logging category (may be nullptr or empty).
-         */
-        auto log(LogLevel level, const std::string& message, const char* file, int line,
-                 const char* function, const char* category = nullptr) -> void;
-
-        /**
-         * @brief Adds a log appender to the logger.
-         * @param appender The log appender to add.
-         */
-        auto add_appender(const std::shared_ptr<LogAppender>& appender) -> void;
-
-        /**
-         * @brief Removes all log appenders from the logger.
-         */
-        auto clear_appenders() -> void;
-
-        /**
-         * @brief Sets the log level of the logger.
-         * @param level The log level to set.
-         */
-        auto set_log_level(LogLevel level) -> void;
-
-        /**
-         * @brief Returns the current log level of the logger.
-         * @return The current log level.
-         */
-        [[nodiscard]] auto get_log_level() const -> LogLevel;
 };
 
 }  // namespace SimpleCppLogger
@@ -0,0 +1,341 @@
+#pragma once
+
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <source_location>
+#include <string>
+#include <string_view>
+
+#include "ApiMacro.h"
+#include "SimpleCppLogger/LogAppender.h"
+#include "SimpleCppLogger/LogCategory.h"
+#include "SimpleCppLogger/LogLevel.h"
+#include "SimpleCppLogger/StagingBackend.h"
+
+namespace SimpleCppLogger
+{
+/**
+ * @class LoggerContext
+ * @brief An independent logging pipeline with its own appenders, level and categories.
+ *
+ * This class provides methods to log messages, manage log appenders, and set the log level.
+ * It supports thread-safe operations and allows multiple appenders for flexible output.
+ * Each context has its own lock and appender list, so subsystems that log into separate
+ * contexts do not contend with each other. Logger is the process-wide context used by the
+ * LOG_* macros; a new context starts without appenders.
+ *
+ * By default messages are delivered to the appenders on the calling thread. After
+ * start_backend(), each thread stages its messages in a thread-local buffer instead and a
+ * backend thread delivers them in timestamp order (see StagingBackend).
+ *
+ * With enable_backtrace(), messages below the logger level are kept unformatted in a bounded
+ * ring instead of being discarded, and are delivered ahead of the next Error or Fatal message.
+ */
+class SIMPLECPPLOGGER_API LoggerContext
+{
+    public:
+        /**
+         * @brief Constructs a context without appenders and with LogLevel::Debug.
+         */
+        LoggerContext();
+
+        /**
+         * @brief Destroys the context.
+         */
+        virtual ~LoggerContext();
+
+        LoggerContext(const LoggerContext&) = delete;
+        auto operator=(const LoggerContext&) -> LoggerContext& = delete;
+
+        /**
+         * @brief Logs a message with the specified log level and source location.
+         * @param level The severity level of the log message.
+         * @param message The log message content.
+         * @param location The source location of the log message (defaults to caller location).
+         */
+        auto log(LogLevel level, const std::string& message,
+                 const std::source_location& location = std::source_location::current()) -> void;
+
+        /**
+         * @brief Logs a message given as a view. The text is only copied if the level is
+         * enabled.
+         * @param level The severity level of the log message.
+         * @param message The log message content.
+         * @param location The source location of the log message (defaults to caller location).
+         */
+        auto log(LogLevel level, std::string_view message,
+                 const std::source_location& location = std::source_location::current()) -> void;
+
+        /**
+         * @brief Logs a string literal or C string without creating a temporary std::string.
+         * @param level The severity level of the log message.
+         * @param message The log message content (nullptr is treated as empty).
+         * @param location The source location of the log message (defaults to caller location).
+         */
+        auto log(LogLevel level, const char* message,
+                 const std::source_location& location = std::source_location::current()) -> void;
+
+        /**
+         * @brief Logs a message whose text is moved into the log message without a copy.
+         * @param level The severity level of the log message.
+         * @param message The log message content.
+         * @param location The source location of the log message (defaults to caller location).
+         */
+        auto log(LogLevel level, std::string&& message,
+                 const std::source_location& location = std::source_location::current()) -> void;
+
+        /**
+         * @brief Logs a wide-character message.
+         *
+         * The wide text is stored as-is and only converted to UTF-8 when a narrow appender
+         * formats it. Nothing is copied or converted if the level is disabled.
+         *
+         * @param level The severity level of the log message.
+         * @param message The log message content.
+         * @param location The source location of the log message (defaults to caller location).
+         */
+        auto log(LogLevel level, std::wstring_view message,
+                 const std::source_location& location = std::source_location::current()) -> void;
+
+        /**
+         * @brief Logs a wide string literal or C string.
+         * @see log(LogLevel, std::wstring_view, const std::source_location&)
+         */
+        auto log(LogLevel level, const wchar_t* message,
+                 const std::source_location& location = std::source_location::current()) -> void;
+
+        /**
+         * @brief Logs a wide message whose text is moved into the log message.
+         * @see log(LogLevel, std::wstring_view, const std::source_location&)
+         */
+        auto log(LogLevel level, std::wstring&& message,
+                 const std::source_location& location = std::source_location::current()) -> void;
+
+        /**
+         * @brief Convenience overload to log with explicit context (file, line, function,
+         * category).
+         *
+         * The context is passed to the appenders as structured data: the LogMessage carries
+         * the file, line and function, the category is registered like get_category() (so its
+         * threshold applies), and the location is a default-constructed std::source_location
+         * to avoid stamping the caller (e.g. adapter) location. The message text is not
+         * modified.
+         *
+         * @param level The severity level of the log message.
+         * @param message The log message content.
+         * @param file Optional source file path (may be nullptr or empty).
+         * @param line Optional source line number (<= 0 if unknown).
+         * @param function Optional function signature (may be nullptr or empty).
+         * @param category Optional logging category (may be nullptr or empty).
+         */
+        auto log(LogLevel level, const std::string& message, const char* file, int line,
+                 const char* function, const char* category = nullptr) -> void;
+
+        /**
+         * @brief Logs a message that belongs to a category.
+         *
+         * The category threshold replaces the logger level for this message. It is checked
+         * before the message is constructed.
+         *
+         * @param category The category of the log message.
+         * @param level The severity level of the log message.
+         * @param message The log message content.
+         * @param location The source location of the log message (defaults to caller location).
+         */
+        auto log(const LogCategory& category, LogLevel level, const std::string& message,
+                 const std::source_location& location = std::source_location::current()) -> void;
+
+        /**
+         * @brief Logs a categorized message given as a view.
+         * @see log(const LogCategory&, LogLevel, const std::string&, const std::source_location&)
+         */
+        auto log(const LogCategory& category, LogLevel level, std::string_view message,
+                 const std::source_location& location = std::source_location::current()) -> void;
+
+        /**
+         * @brief Logs a categorized string literal or C string.
+         * @see log(const LogCategory&, LogLevel, const std::string&, const std::source_location&)
+         */
+        auto log(const LogCategory& category, LogLevel level, const char* message,
+                 const std::source_location& location = std::source_location::current()) -> void;
+
+        /**
+         * @brief Logs a categorized message whose text is moved into the log message.
+         * @see log(const LogCategory&, LogLevel, const std::string&, const std::source_location&)
+         */
+        auto log(const LogCategory& category, LogLevel level, std::string&& message,
+                 const std::source_location& location = std::source_location::current()) -> void;
+
+        /**
+         * @brief Logs a categorized wide-character message.
+         * @see log(LogLevel, std::wstring_view, const std::source_location&)
+         */
+        auto log(const LogCategory& category, LogLevel level, std::wstring_view message,
+                 const std::source_location& location = std::source_location::current()) -> void;
+
+        /**
+         * @brief Logs a categorized wide string literal or C string.
+         * @see log(LogLevel, std::wstring_view, const std::source_location&)
+         */
+        auto log(const LogCategory& category, LogLevel level, const wchar_t* message,
+                 const std::source_location& location = std::source_location::current()) -> void;
+
+        /**
+         * @brief Logs a categorized wide message whose text is moved into the log message.
+         * @see log(LogLevel, std::wstring_view, const std::source_location&)
+         */
+        auto log(const LogCategory& category, LogLevel level, std::wstring&& message,
+                 const std::source_location& location = std::source_location::current()) -> void;
+
+        /**
+         * @brief Returns the category with the given name, registering it on first use.
+         *
+         * New categories follow the logger level until set_category_level() is called.
+         *
+         * @param name The category name.
+         * @return A handle to the category.
+         */
+        [[nodiscard]] auto get_category(std::string_view name) -> LogCategory;
+
+        /**
+         * @brief Sets an explicit threshold for a category.
+         *
+         * If the threshold is lower than the logger level, the appenders' levels are lowered
+         * as well so that the category's messages reach them.
+         *
+         * @param category The category to configure.
+         * @param level The threshold to set.
+         */
+        auto set_category_level(const LogCategory& category, LogLevel level) -> void;
+
+        /**
+         * @brief Makes a category follow the logger level again.
+         * @param category The category to reset.
+         */
+        auto reset_category_level(const LogCategory& category) -> void;
+
+        /**
+         * @brief Returns the effective threshold of a category.
+         * @param category The category to query.
+         * @return The category threshold.
+         */
+        [[nodiscard]] auto get_category_level(const LogCategory& category) const -> LogLevel;
+
+        /**
+         * @brief Adds a log appender to the logger.
+         * @param appender The log appender to add.
+         */
+        auto add_appender(const std::shared_ptr<LogAppender>& appender) -> void;
+
+        /**
+         * @brief Removes all log appenders from the logger.
+         */
+        auto clear_appenders() -> void;
+
+        /**
+         * @brief Sets the log level of the logger.
+         * @param level The log level to set.
+         */
+        auto set_log_level(LogLevel level) -> void;
+
+        /**
+         * @brief Returns the current log level of the logger.
+         * @return The current log level.
+         */
+        [[nodiscard]] auto get_log_level() const -> LogLevel;
+
+        /**
+         * @brief Returns whether a message of the given level passes the logger level.
+         *
+         * Lets callers skip building a message that would be discarded. Levels kept by the
+         * backtrace buffer count as enabled.
+         *
+         * @param level The level to check.
+         * @return True if the level is valid and at or above the logger level or the backtrace
+         * level.
+         */
+        [[nodiscard]] auto is_enabled(LogLevel level) const -> bool;
+
+        /**
+         * @brief Flushes all appenders once everything logged before the call has reached them.
+         *
+         * If the backend is running, its staged messages are drained on the calling thread and
+         * the formatting workers are waited for first. The appenders then flush on their own
+         * threads, so the caller only blocks if it waits for the future.
+         *
+         * @param mode Whether the messages only have to be written or also synced to disk.
+         * @return A future that becomes ready once every appender has flushed; its value is
+         * false if any appender failed.
+         */
+        [[nodiscard]] auto flush(FlushMode mode = FlushMode::Written) -> std::future<bool>;
+
+        /**
+         * @brief Flushes all appenders like flush(FlushMode) and reports the result to a
+         * callback instead of a future.
+         *
+         * @param callback Called exactly once, on the calling thread or an appender's thread.
+         * @param mode Whether the messages only have to be written or also synced to disk.
+         */
+        auto flush(FlushCallback callback, FlushMode mode = FlushMode::Written) -> void;
+
+        /**
+         * @brief Keeps messages below the logger level in a ring and delivers them ahead of the
+         * next Error or Fatal message.
+         *
+         * The buffered messages are neither formatted nor written until then; if the ring is
+         * full, the oldest message is discarded. The appenders' levels are lowered to the
+         * backtrace level so that they accept the dumped messages. Calling this again discards
+         * the buffered messages.
+         *
+         * @param capacity The number of messages to keep (0 disables backtrace mode).
+         * @param level The lowest level to keep.
+         */
+        auto enable_backtrace(std::size_t capacity, LogLevel level = LogLevel::Trace) -> void;
+
+        /**
+         * @brief Disables backtrace mode and discards the buffered messages.
+         */
+        auto disable_backtrace() -> void;
+
+        /**
+         * @brief Returns whether backtrace mode is enabled.
+         * @return True if messages below the logger level are buffered.
+         */
+        [[nodiscard]] auto is_backtrace_enabled() const -> bool;
+
+        /**
+         * @brief Delivers the buffered messages now, oldest first.
+         */
+        auto dump_backtrace() -> void;
+
+        /**
+         * @brief Starts delivering messages through per-thread staging buffers and a backend
+         * thread.
+         *
+         * Has no effect if the backend is already running. A stopped backend is restarted if
+         * the options are unchanged; otherwise a new one is created.
+         *
+         * @param options The backend configuration.
+         */
+        auto start_backend(const BackendOptions& options = {}) -> void;
+
+        /**
+         * @brief Stops the backend thread after delivering all staged messages.
+         *
+         * Messages logged afterwards are delivered on the calling thread again.
+         */
+        auto stop_backend() -> void;
+
+        /**
+         * @brief Returns whether messages are currently delivered by the backend thread.
+         * @return True if the backend is running, false otherwise.
+         */
+        [[nodiscard]] auto is_backend_running() const -> bool;
+
+    private:
+        class Impl;
+        std::unique_ptr<Impl> m_impl;
+};
+
+}  // namespace SimpleCppLogger
@@ -0,0 +1,131 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <source_location>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "ApiMacro.h"
+#include "SimpleCppLogger/LogAppender.h"
+#include "SimpleCppLogger/LogLevel.h"
+#include "SimpleCppLogger/LogMessage.h"
+
+namespace SimpleCppLogger
+{
+/**
+ * @struct MemoryRecord
+ * @brief A copy of one record held by a MemoryAppender.
+ */
+struct MemoryRecord {
+        std::uint64_t sequence = 0;  ///< Position of the record in the appender's history.
+        LogLevel level = LogLevel::Info;
+        LogMessage::Clock::time_point timestamp;
+        std::string text;  ///< The formatted text, truncated to the slot size.
+};
+
+/**
+ * @class MemoryAppender
+ * @brief A log appender that keeps the most recent records in a fixed-size ring in memory.
+ *
+ * Each append claims the next position with a single atomic increment and copies the text into
+ * its slot, guarded by a per-slot sequence counter (seqlock). Writers never wait: if the slot is
+ * still being written by a writer that lapped the ring, the record is dropped and counted.
+ * snapshot() copies the ring without blocking writers and skips slots that change while they
+ * are copied, so every returned record is consistent.
+ *
+ * Without a formatter, the raw message text is stored.
+ */
+class SIMPLECPPLOGGER_API MemoryAppender: public LogAppender
+{
+    public:
+        /**
+         * @brief The default maximum number of bytes of text kept per record.
+         */
+        static constexpr std::size_t DefaultRecordSize = 256;
+
+        /**
+         * @brief Constructs a MemoryAppender object.
+         *
+         * @param capacity The number of records kept, rounded up to a power of two.
+         * @param record_size The maximum number of bytes of text kept per record.
+         * @param formatter The formatter to apply, or nullptr to keep the raw message text.
+         */
+        explicit MemoryAppender(std::size_t capacity, std::size_t record_size = DefaultRecordSize,
+                                const std::shared_ptr<LogFormatter>& formatter = nullptr);
+
+        ~MemoryAppender() override;
+
+        MemoryAppender(const MemoryAppender&) = delete;
+        auto operator=(const MemoryAppender&) -> MemoryAppender& = delete;
+
+        /**
+         * @brief Returns true; preformatted text is stored unchanged.
+         */
+        [[nodiscard]] auto supports_preformatted() const -> bool override;
+
+        /**
+         * @brief Copies the records currently held, oldest first.
+         *
+         * Does not block writers. Records that are overwritten while the snapshot is taken are
+         * left out.
+         *
+         * @return The records ordered by sequence number.
+         */
+        [[nodiscard]] auto snapshot() const -> std::vector<MemoryRecord>;
+
+        /**
+         * @brief Returns the texts of snapshot(), for tests and quick inspection.
+         * @return The record texts, oldest first.
+         */
+        [[nodiscard]] auto get_texts() const -> std::vector<std::string>;
+
+        /**
+         * @brief Returns the number of records the ring holds.
+         * @return The capacity.
+         */
+        [[nodiscard]] auto get_capacity() const -> std::size_t;
+
+        /**
+         * @brief Returns the maximum number of bytes of text kept per record.
+         * @return The record size.
+         */
+        [[nodiscard]] auto get_record_size() const -> std::size_t;
+
+        /**
+         * @brief Returns the number of records appended so far, including overwritten ones.
+         * @return The number of records.
+         */
+        [[nodiscard]] auto get_total_count() const -> std::uint64_t;
+
+        /**
+         * @brief Returns the number of records dropped because their slot was busy.
+         * @return The number of dropped records.
+         */
+        [[nodiscard]] auto get_dropped_count() const -> std::uint64_t;
+
+    private:
+        struct Slot;
+
+        auto internal_append(const LogMessage& message,
+                             const std::source_location& location) -> void override;
+
+        auto internal_append_formatted(const LogMessage& message,
+                                       const std::source_location& location,
+                                       std::string&& formatted) -> void override;
+
+        auto store(const LogMessage& message, std::string_view text) -> void;
+
+        std::size_t m_capacity;
+        std::size_t m_record_size;
+        std::size_t m_words_per_slot;
+        std::unique_ptr<Slot[]> m_slots;
+        std::unique_ptr<std::atomic<std::uint64_t>[]> m_words;
+        alignas(64) std::atomic<std::uint64_t> m_next{0};
+        alignas(64) std::atomic<std::uint64_t> m_dropped{0};
+};
+
+}  // namespace SimpleCppLogger
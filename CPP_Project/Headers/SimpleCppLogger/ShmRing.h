@@ -0,0 +1,157 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <string>
+#include <string_view>
+
+#include "ApiMacro.h"
+#include "SimpleCppLogger/LogLevel.h"
+#include "SimpleCppLogger/LogMessage.h"
+
+namespace SimpleCppLogger
+{
+/**
+ * @enum ShmOverflowPolicy
+ * @brief Controls what the producer does when the shared-memory ring is full.
+ */
+enum class ShmOverflowPolicy
+{
+    Drop,  ///< Discard the record and count it in the ring header.
+    Block  ///< Wait up to a timeout for the reader to make room, then drop.
+};
+
+/**
+ * @struct ShmRecordView
+ * @brief A record read from a shared-memory ring. The text points into the shared mapping and is
+ * only valid inside the read callback.
+ */
+struct ShmRecordView {
+        LogLevel level = LogLevel::Info;
+        LogMessage::Clock::time_point timestamp;
+        std::string_view text;
+};
+
+/**
+ * @class ShmRing
+ * @brief A single-producer/single-consumer byte ring in a POSIX shared-memory object.
+ *
+ * The object starts with a header holding the capacity, the write and read positions and a drop
+ * counter, followed by the data area. A record is a 16-byte header (size, level, timestamp)
+ * followed by its text, padded to 16 bytes. A record never wraps: if it does not fit before the
+ * end of the data area, a padding record fills the rest and the record starts at offset 0, so
+ * the reader can pass the text to write() straight from the mapping.
+ *
+ * The producer publishes a record by advancing the write position after the record is
+ * complete, so records are either fully visible to the reader or not at all; a producer crash
+ * cannot leave a torn record behind. The reader advances the read position after it has
+ * processed a batch, so a reader crash re-delivers at most that batch.
+ *
+ * Errors are not thrown; a ring that could not be created or attached reports is_open() ==
+ * false and ignores all calls. Only available on POSIX systems.
+ */
+class SIMPLECPPLOGGER_API ShmRing
+{
+    public:
+        /**
+         * @brief The smallest data area, in bytes.
+         */
+        static constexpr std::size_t MinCapacity = 4096;
+
+        /**
+         * @brief Creates the shared-memory object or attaches to an existing one.
+         *
+         * An existing ring is reused as long as it has a valid header, so a restarted producer
+         * continues where it stopped and unread records are kept.
+         *
+         * @param name The object name, starting with '/' (see shm_open).
+         * @param capacity The size of the data area, rounded up to a power of two. 0 only
+         * attaches to an existing ring.
+         */
+        ShmRing(const std::string& name, std::size_t capacity);
+
+        /**
+         * @brief Unmaps the ring. The shared-memory object stays until remove() is called.
+         */
+        ~ShmRing();
+
+        ShmRing(const ShmRing&) = delete;
+        auto operator=(const ShmRing&) -> ShmRing& = delete;
+
+        /**
+         * @brief Returns whether the ring is mapped.
+         * @return True if the ring can be used, false otherwise.
+         */
+        [[nodiscard]] auto is_open() const -> bool;
+
+        /**
+         * @brief Writes a record. Must only be called by one producer at a time.
+         *
+         * Text longer than get_max_record_size() is truncated.
+         *
+         * @param level The log level of the record.
+         * @param timestamp The creation time of the record.
+         * @param text The record text.
+         * @param policy What to do if the ring is full.
+         * @param timeout How long ShmOverflowPolicy::Block waits for room.
+         * @return True if the record was written, false if it was dropped.
+         */
+        auto write(LogLevel level, LogMessage::Clock::time_point timestamp, std::string_view text,
+                   ShmOverflowPolicy policy = ShmOverflowPolicy::Drop,
+                   std::chrono::milliseconds timeout = std::chrono::milliseconds(0)) -> bool;
+
+        /**
+         * @brief Passes all published records to the callback in one batch and then releases
+         * their space. Must only be called by one consumer at a time.
+         *
+         * @param callback Receives the records in order and returns false to keep them for the
+         * next read, e.g. because they could not be written. Not called if there are none.
+         * @return The number of records released.
+         */
+        auto read(const std::function<bool(std::span<const ShmRecordView>)>& callback)
+            -> std::size_t;
+
+        /**
+         * @brief Returns the size of the data area.
+         * @return The capacity in bytes, or 0 if the ring is not open.
+         */
+        [[nodiscard]] auto get_capacity() const -> std::size_t;
+
+        /**
+         * @brief Returns the longest text a single record can hold.
+         * @return The maximum record size in bytes.
+         */
+        [[nodiscard]] auto get_max_record_size() const -> std::size_t;
+
+        /**
+         * @brief Returns the number of bytes written but not yet read.
+         * @return The number of pending bytes.
+         */
+        [[nodiscard]] auto get_pending_bytes() const -> std::size_t;
+
+        /**
+         * @brief Returns the number of records the producer dropped because the ring was full.
+         * @return The drop count.
+         */
+        [[nodiscard]] auto get_dropped_count() const -> std::uint64_t;
+
+        /**
+         * @brief Removes the shared-memory object. Mappings that exist stay valid.
+         * @param name The object name.
+         * @return True if the object was removed.
+         */
+        static auto remove(const std::string& name) -> bool;
+
+    private:
+        struct Header;
+
+        auto data() const -> unsigned char*;
+
+        Header* m_header = nullptr;
+        std::size_t m_mapped_size = 0;
+};
+
+}  // namespace SimpleCppLogger
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <source_location>
+#include <string>
+
+#include "ApiMacro.h"
+#include "SimpleCppLogger/LogAppender.h"
+#include "SimpleCppLogger/ShmRing.h"
+#include "SimpleCppLogger/SimpleFormatter.h"
+
+namespace SimpleCppLogger
+{
+/**
+ * @struct ShmRingAppenderOptions
+ * @brief Configuration of a ShmRingAppender.
+ */
+struct ShmRingAppenderOptions {
+        std::size_t capacity = 1024 * 1024;  ///< Size of the ring's data area in bytes.
+        ShmOverflowPolicy overflow_policy = ShmOverflowPolicy::Drop;
+        std::chrono::milliseconds block_timeout{100};  ///< Block: longest wait for room.
+        bool remove_on_destroy = false;  ///< Remove the shared-memory object in the destructor.
+};
+
+/**
+ * @class ShmRingAppender
+ * @brief A log appender that writes formatted records into a shared-memory ring.
+ *
+ * A separate reader process (see ShmRingReader and the ShmLogReader tool) consumes the ring and
+ * writes the records to files, so the logging process never performs file I/O. Records that
+ * have been written to the ring survive a crash of the logging process.
+ *
+ * When the reader falls behind and the ring is full, records are dropped and counted in the
+ * ring header (ShmOverflowPolicy::Drop), or the appender waits up to block_timeout before
+ * dropping (ShmOverflowPolicy::Block). Only available on POSIX systems; elsewhere the ring is
+ * never open and all records are ignored.
+ */
+class SIMPLECPPLOGGER_API ShmRingAppender: public LogAppender
+{
+    public:
+        /**
+         * @brief Creates or attaches to the ring with the given name.
+         *
+         * @param name The shared-memory object name, starting with '/'.
+         * @param options The ring configuration.
+         * @param formatter The LogFormatter to use; defaults to a SimpleFormatter without colors.
+         */
+        explicit ShmRingAppender(
+            const std::string& name, const ShmRingAppenderOptions& options = {},
+            const std::shared_ptr<LogFormatter>& formatter =
+                std::make_shared<SimpleFormatter>(false));
+
+        /**
+         * @brief Unmaps the ring and removes it if remove_on_destroy is set.
+         */
+        ~ShmRingAppender() override;
+
+        ShmRingAppender(const ShmRingAppender&) = delete;
+        auto operator=(const ShmRingAppender&) -> ShmRingAppender& = delete;
+
+        /**
+         * @brief Returns whether the ring could be created or attached.
+         * @return True if records are written to the ring.
+         */
+        [[nodiscard]] auto is_open() const -> bool;
+
+        /**
+         * @brief Returns the name of the shared-memory object.
+         * @return The object name.
+         */
+        [[nodiscard]] auto get_name() const -> const std::string&;
+
+        /**
+         * @brief Returns the number of records dropped because the ring was full.
+         * @return The drop count stored in the ring header.
+         */
+        [[nodiscard]] auto get_dropped_count() const -> std::uint64_t;
+
+        /**
+         * @brief Returns true; preformatted text is written unchanged.
+         */
+        [[nodiscard]] auto supports_preformatted() const -> bool override;
+
+    private:
+        auto internal_append(const LogMessage& message,
+                             const std::source_location& location) -> void override;
+
+        auto internal_append_formatted(const LogMessage& message,
+                                       const std::source_location& location,
+                                       std::string&& formatted) -> void override;
+
+        std::string m_name;
+        ShmRingAppenderOptions m_options;
+        std::mutex m_mutex;  ///< The ring allows a single producer at a time.
+        ShmRing m_ring;
+};
+
+}  // namespace SimpleCppLogger
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "ApiMacro.h"
+#include "SimpleCppLogger/ShmRing.h"
+
+namespace SimpleCppLogger
+{
+/**
+ * @class ShmRingReader
+ * @brief Consumes the shared-memory ring of a ShmRingAppender and writes it to a file.
+ *
+ * The record text is written straight from the shared mapping with writev, one newline per
+ * record. When the producer has dropped records since the last poll, a line reporting the
+ * number of lost records is written in their place.
+ */
+class SIMPLECPPLOGGER_API ShmRingReader
+{
+    public:
+        /**
+         * @brief Attaches to an existing ring.
+         * @param name The shared-memory object name.
+         */
+        explicit ShmRingReader(const std::string& name);
+
+        /**
+         * @brief Returns whether the ring exists and could be attached.
+         * @return True if the reader can poll.
+         */
+        [[nodiscard]] auto is_open() const -> bool;
+
+        /**
+         * @brief Writes all records published since the last poll to the file descriptor.
+         * @param fd The descriptor to write to.
+         * @return The number of records written.
+         */
+        auto poll(int fd) -> std::size_t;
+
+        /**
+         * @brief Returns the number of records the producer has dropped so far.
+         * @return The drop count.
+         */
+        [[nodiscard]] auto get_dropped_count() const -> std::uint64_t;
+
+    private:
+        ShmRing m_ring;
+        std::uint64_t m_reported_drops = 0;
+};
+
+}  // namespace SimpleCppLogger
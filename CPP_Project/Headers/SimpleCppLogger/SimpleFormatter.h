@@ -20,10 +20,24 @@ class SIMPLECPPLOGGER_API SimpleFormatter: public LogFormatter
 {
     public:
         /**
-         * @brief Constructs a SimpleFormatter object.
+         * @brief Constructs a SimpleFormatter object that emits ANSI color codes.
          */
         SimpleFormatter() = default;
 
+        /**
+         * @brief Constructs a SimpleFormatter object.
+         *
+         * @param use_colors Whether ANSI color codes are emitted. Disable this for outputs that
+         * are not terminals (pipes, files, log collectors).
+         */
+        explicit SimpleFormatter(bool use_colors);
+
+        /**
+         * @brief Returns whether ANSI color codes are emitted.
+         * @return True if color codes are emitted, false otherwise.
+         */
+        [[nodiscard]] auto uses_colors() const -> bool;
+
         /**
          * @brief Formats the log message according to the specified context.
          *
@@ -35,6 +49,9 @@ class SIMPLECPPLOGGER_API SimpleFormatter: public LogFormatter
             const LogMessage& log_message,
             const std::source_location& location = std::source_location::current()) const
             -> std::string override;
+
+    private:
+        bool m_use_colors = true;
 };
 
 }  // namespace SimpleCppLogger
@@ -0,0 +1,224 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <source_location>
+#include <thread>
+#include <vector>
+
+#include "ApiMacro.h"
+#include "SimpleCppLogger/LogMessage.h"
+#include "SimpleCppLogger/StagingBuffer.h"
+
+namespace SimpleCppLogger
+{
+/**
+ * @enum BackendSharding
+ * @brief Controls how a StagingBackend splits its producer buffers into shards.
+ */
+enum class BackendSharding
+{
+    None,      ///< One shard, drained by the backend thread itself.
+    NumaNode,  ///< One shard per NUMA node.
+    CoreGroup  ///< One shard per group of cores_per_group CPUs within a NUMA node.
+};
+
+/**
+ * @enum BackendWaitStrategy
+ * @brief Controls how the backend thread waits when a drain found no records.
+ */
+enum class BackendWaitStrategy
+{
+    Spin,   ///< Busy-poll with a CPU pause hint; lowest latency, occupies a core.
+    Yield,  ///< Poll and yield the CPU between polls.
+    Block,  ///< Sleep until a producer wakes the backend or poll_interval passes.
+    Hybrid  ///< Spin for spin_polls, yield for yield_polls, then block.
+};
+
+/**
+ * @struct BackendOptions
+ * @brief Configuration of a StagingBackend.
+ */
+struct BackendOptions {
+        std::size_t buffer_capacity = 4096;  ///< Records per producer thread (power of two).
+        StagingFullPolicy full_policy = StagingFullPolicy::Block;
+        BackendWaitStrategy wait_strategy = BackendWaitStrategy::Block;
+        std::chrono::microseconds poll_interval{500};  ///< Longest sleep of Block and Hybrid.
+        std::size_t spin_polls = 4096;                 ///< Hybrid: empty polls spent spinning.
+        std::size_t yield_polls = 64;                  ///< Hybrid: empty polls spent yielding.
+        std::size_t formatting_threads = 0;  ///< Formatting workers; 0 formats on the writer.
+        std::size_t records_per_task = 256;  ///< Records per task handed to a formatting worker.
+        BackendSharding sharding = BackendSharding::None;
+        std::size_t cores_per_group = 8;  ///< CoreGroup: CPUs per shard.
+        bool pin_threads = true;          ///< Pin each shard's drain thread to the shard's CPUs.
+
+        auto operator==(const BackendOptions&) const -> bool = default;
+};
+
+/**
+ * @class StagingBackend
+ * @brief Collects records from per-thread staging buffers and delivers them in time order.
+ *
+ * Every producer thread writes into its own StagingBuffer, which is registered with the backend
+ * the first time the thread submits a record and retired when the thread exits. A backend thread
+ * periodically drains all buffers, merges the drained records by timestamp (ties are resolved by
+ * buffer registration order and per-thread sequence, so the order within a thread is always
+ * kept) and passes the merged batch to the sink.
+ *
+ * Submitting a record only touches the calling thread's buffer and its thread-local lookup
+ * table; it does not take a lock or write any cache line shared with other producers.
+ *
+ * With sharding, each buffer belongs to the shard of the CPU its thread first logged from, and
+ * each shard has its own drain thread, pinned to the shard's CPUs if pin_threads is set. A
+ * buffer is allocated by its producer thread, so its memory is local to that thread's node, and
+ * only the drain thread of the same node reads it. The backend thread then merges the drained
+ * shards by timestamp, breaking ties by shard and buffer registration order, and delivers the
+ * result as one batch, so the sink sees the same order as without sharding.
+ *
+ * When a drain comes back empty the backend thread waits according to wait_strategy. Only the
+ * Block and Hybrid strategies let it sleep; a producer then wakes it after a submit, but only if
+ * it is actually asleep, so a busy backend costs producers a fence and a load, not a syscall.
+ */
+class SIMPLECPPLOGGER_API StagingBackend
+{
+    public:
+        /**
+         * @brief Receives each merged batch. Called from the backend thread or from stop().
+         */
+        using Sink = std::function<void(std::vector<StagedRecord>& records)>;
+
+        /**
+         * @brief Constructs a stopped backend.
+         * @param options The backend configuration.
+         * @param sink The function that receives the merged records.
+         */
+        StagingBackend(const BackendOptions& options, Sink sink);
+
+        /**
+         * @brief Stops the backend and delivers all remaining records.
+         */
+        ~StagingBackend();
+
+        StagingBackend(const StagingBackend&) = delete;
+        auto operator=(const StagingBackend&) -> StagingBackend& = delete;
+
+        /**
+         * @brief Starts the backend thread. Has no effect if it is already running.
+         */
+        auto start() -> void;
+
+        /**
+         * @brief Stops the backend thread and delivers all records staged so far.
+         *
+         * Records that producers submit while stop() runs are delivered by the next drain.
+         */
+        auto stop() -> void;
+
+        /**
+         * @brief Returns whether the backend thread is running.
+         * @return True if running, false otherwise.
+         */
+        [[nodiscard]] auto is_running() const -> bool;
+
+        /**
+         * @brief Stages a record in the calling thread's buffer.
+         *
+         * @param message The message to stage.
+         * @param location The source location of the message.
+         * @return True if the record was staged, false if it was dropped.
+         */
+        auto submit(LogMessage&& message, const std::source_location& location) -> bool;
+
+        /**
+         * @brief Drains all buffers once and delivers the merged records to the sink.
+         *
+         * Normally called by the backend thread; safe to call concurrently with it.
+         *
+         * @return The number of delivered records.
+         */
+        auto drain() -> std::size_t;
+
+        /**
+         * @brief Returns the number of shards.
+         * @return 1 without sharding, otherwise the number of NUMA nodes or core groups.
+         */
+        [[nodiscard]] auto get_shard_count() const -> std::size_t;
+
+        /**
+         * @brief Assigns the calling thread's buffer to a shard instead of the one of its CPU.
+         *
+         * Only has an effect before the thread submits its first record to this backend.
+         *
+         * @param shard The shard, less than get_shard_count().
+         * @return True if the buffer was registered with the shard.
+         */
+        auto bind_current_thread(std::size_t shard) -> bool;
+
+        /**
+         * @brief Returns the number of registered producer buffers that have not been released.
+         * @return The number of buffers.
+         */
+        [[nodiscard]] auto get_buffer_count() const -> std::size_t;
+
+        /**
+         * @brief Returns the number of records dropped by all producers so far.
+         * @return The drop count.
+         */
+        [[nodiscard]] auto get_dropped_count() const -> std::uint64_t;
+
+        /**
+         * @brief Returns the options the backend was created with.
+         * @return The backend options.
+         */
+        [[nodiscard]] auto get_options() const -> const BackendOptions&;
+
+    private:
+        struct Shard;
+
+        auto local_buffer() -> StagingBuffer&;
+        auto find_local_buffer() -> StagingBuffer*;
+        auto register_buffer(std::size_t shard) -> StagingBuffer&;
+        auto get_current_shard() const -> std::size_t;
+        auto drain_shard(Shard& shard) -> void;
+        auto collect_shards() -> void;
+        auto start_shard_threads() -> void;
+        auto stop_shard_threads() -> void;
+        auto run_shard(Shard& shard) -> void;
+        [[nodiscard]] auto has_pending_records() const -> bool;
+        auto wake_backend() -> void;
+        auto wait_for_records(std::size_t idle_polls) -> void;
+        auto run() -> void;
+
+        BackendOptions m_options;
+        Sink m_sink;
+        std::uint64_t m_id;
+
+        std::vector<std::unique_ptr<Shard>> m_shards;
+        std::vector<std::size_t> m_shard_of_cpu;
+
+        std::mutex m_drain_mutex;
+        std::vector<StagedRecord> m_merged;
+
+        std::mutex m_shard_mutex;
+        std::condition_variable m_shard_work;
+        std::condition_variable m_shard_done;
+        std::uint64_t m_shard_generation = 0;
+        std::size_t m_shards_pending = 0;
+        bool m_shard_threads_running = false;
+
+        std::mutex m_state_mutex;
+        std::condition_variable m_state_cv;
+        std::atomic<bool> m_running{false};
+        std::atomic<bool> m_stop_requested{false};
+        std::atomic<bool> m_backend_sleeping{false};
+        bool m_wake_requested = false;
+        std::thread m_thread;
+};
+
+}  // namespace SimpleCppLogger
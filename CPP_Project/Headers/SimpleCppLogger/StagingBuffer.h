@@ -0,0 +1,118 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <source_location>
+#include <vector>
+
+#include "ApiMacro.h"
+#include "SimpleCppLogger/LogMessage.h"
+
+namespace SimpleCppLogger
+{
+/**
+ * @struct StagedRecord
+ * @brief A log message waiting in a staging buffer, together with its source location.
+ */
+struct StagedRecord {
+        LogMessage message;
+        std::source_location location;
+        std::uint64_t sequence = 0;  ///< Position of the record within its producer thread.
+};
+
+/**
+ * @enum StagingFullPolicy
+ * @brief Controls what a producer does when its staging buffer is full.
+ */
+enum class StagingFullPolicy
+{
+    Block,  ///< Yield until the backend has made room.
+    Drop    ///< Discard the record and count it.
+};
+
+/**
+ * @class StagingBuffer
+ * @brief A bounded single-producer/single-consumer ring of staged records.
+ *
+ * Each producer thread owns one buffer per backend. The producer only writes the tail index and
+ * its own drop counter, the consumer only writes the head index, and both live on separate cache
+ * lines, so the producer path does not share written cache lines with other producers.
+ */
+class SIMPLECPPLOGGER_API StagingBuffer
+{
+    public:
+        /**
+         * @brief Constructs a buffer that holds at least the given number of records.
+         * @param capacity The requested capacity, rounded up to a power of two.
+         */
+        explicit StagingBuffer(std::size_t capacity);
+
+        StagingBuffer(const StagingBuffer&) = delete;
+        auto operator=(const StagingBuffer&) -> StagingBuffer& = delete;
+
+        /**
+         * @brief Appends a record. Must only be called by the owning producer thread.
+         *
+         * @param message The message to stage.
+         * @param location The source location of the message.
+         * @param policy What to do if the buffer is full.
+         * @return True if the record was staged, false if it was dropped.
+         */
+        auto push(LogMessage&& message, const std::source_location& location,
+                  StagingFullPolicy policy) -> bool;
+
+        /**
+         * @brief Moves all staged records to the end of the given vector. Must only be called by
+         * the consumer.
+         *
+         * @param out The vector to append to.
+         * @return The number of records moved.
+         */
+        auto pop_all(std::vector<StagedRecord>& out) -> std::size_t;
+
+        /**
+         * @brief Returns whether no records are staged.
+         * @return True if the buffer is empty.
+         */
+        [[nodiscard]] auto is_empty() const -> bool;
+
+        /**
+         * @brief Returns the capacity of the buffer.
+         * @return The number of records the buffer can hold.
+         */
+        [[nodiscard]] auto get_capacity() const -> std::size_t;
+
+        /**
+         * @brief Returns the number of records dropped because the buffer was full.
+         * @return The drop count.
+         */
+        [[nodiscard]] auto get_dropped_count() const -> std::uint64_t;
+
+        /**
+         * @brief Marks the buffer as retired because its producer thread has exited.
+         */
+        auto retire() -> void;
+
+        /**
+         * @brief Returns whether the producer thread has exited.
+         * @return True if the buffer is retired.
+         */
+        [[nodiscard]] auto is_retired() const -> bool;
+
+    private:
+        static constexpr std::size_t CacheLineSize = 64;
+
+        std::vector<StagedRecord> m_slots;
+        std::size_t m_mask;
+
+        alignas(CacheLineSize) std::atomic<std::size_t> m_head{0};
+
+        alignas(CacheLineSize) std::atomic<std::size_t> m_tail{0};
+        std::size_t m_cached_head = 0;
+        std::uint64_t m_next_sequence = 0;
+        std::atomic<std::uint64_t> m_dropped{0};
+        std::atomic<bool> m_retired{false};
+};
+
+}  // namespace SimpleCppLogger
@@ -0,0 +1,340 @@
+#pragma once
+
+#include <array>
+#include <charconv>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <source_location>
+#include <string>
+#include <string_view>
+
+#include "SimpleCppLogger/LogFormatter.h"
+#include "SimpleCppLogger/LogLevel.h"
+#include "SimpleCppLogger/LogMessage.h"
+
+/**
+ * @file StaticFormatter.h
+ * @brief A header-only formatter whose layout is fixed at compile time.
+ */
+
+namespace SimpleCppLogger
+{
+/**
+ * @enum TimestampStyle
+ * @brief How a StaticFormatter renders the message timestamp.
+ */
+enum class TimestampStyle
+{
+    None,      ///< No timestamp.
+    Local,     ///< Local time as "YYYY-MM-DD HH:MM:SS", like SimpleFormatter.
+    Iso8601Utc ///< UTC as "YYYY-MM-DDTHH:MM:SS.mmmZ".
+};
+
+/**
+ * @struct FormatterOptions
+ * @brief Compile-time layout options of a StaticFormatter.
+ */
+struct FormatterOptions {
+        bool colors = true;    ///< Emit ANSI color codes.
+        bool location = true;  ///< Append file and line.
+        bool function = true;  ///< Append the function name.
+        TimestampStyle timestamp = TimestampStyle::Local;
+};
+
+namespace detail
+{
+/**
+ * @brief A level prefix such as "\033[94m[Info     ]:\033[0m " built at compile time.
+ */
+struct LevelPrefix {
+        std::array<char, 40> data{};
+        std::size_t size = 0;
+
+        constexpr auto append(std::string_view text) -> void
+        {
+            for (char c: text)
+            {
+                data[size++] = c;
+            }
+        }
+
+        [[nodiscard]] constexpr auto view() const -> std::string_view
+        {
+            return {data.data(), size};
+        }
+};
+
+inline constexpr std::string_view ResetColor = "\033[0m";
+inline constexpr std::string_view ContextColor = "\033[95m";  // Light Purple
+inline constexpr std::size_t LevelTagWidth = 9;
+
+/**
+ * @brief Returns the ANSI color of a level, matching SimpleFormatter.
+ */
+constexpr auto level_color(LogLevel level) -> std::string_view
+{
+    switch (level)
+    {
+    case LogLevel::Trace:
+        return "\033[96m";  // Light Cyan
+    case LogLevel::Debug:
+        return "\033[92m";  // Light Green
+    case LogLevel::Info:
+        return "\033[94m";  // Light Blue
+    case LogLevel::Warning:
+        return "\033[93m";  // Light Yellow
+    case LogLevel::Error:
+        return "\033[91m";  // Light Red
+    case LogLevel::Fatal:
+        return "\033[95m";  // Light Magenta
+    default:
+        return ResetColor;
+    }
+}
+
+constexpr auto make_prefix(std::string_view name, std::string_view color, bool colors)
+    -> LevelPrefix
+{
+    LevelPrefix prefix;
+
+    if (colors)
+    {
+        prefix.append(color);
+    }
+
+    prefix.append("[");
+    prefix.append(name);
+    for (std::size_t i = name.size(); i < LevelTagWidth; ++i)
+    {
+        prefix.append(" ");
+    }
+    prefix.append("]:");
+
+    if (colors)
+    {
+        prefix.append(ResetColor);
+    }
+
+    prefix.append(" ");
+
+    return prefix;
+}
+
+/**
+ * @brief The level prefixes for all levels in LOGLEVEL_LIST, followed by the "Unknown" prefix.
+ */
+template <bool Colors>
+inline constexpr std::array<LevelPrefix, LogLevelCount + 1> LevelPrefixes = {
+#define X(a, b, c) make_prefix(b, level_color(LogLevel::a), Colors),
+    LOGLEVEL_LIST
+#undef X
+        make_prefix("Unknown", ResetColor, Colors)};
+
+/**
+ * @brief Appends an unsigned number with at least the given number of digits.
+ */
+inline auto append_number(std::string& out, std::uint32_t value, int width = 0) -> void
+{
+    char buffer[16];
+    auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    for (auto digits = static_cast<int>(result.ptr - buffer); digits < width; ++digits)
+    {
+        out += '0';
+    }
+    out.append(buffer, result.ptr);
+}
+
+template <TimestampStyle Style>
+auto append_timestamp(std::string& out, LogMessage::Clock::time_point timestamp) -> void
+{
+    if constexpr (Style == TimestampStyle::Local)
+    {
+        const std::time_t seconds = LogMessage::Clock::to_time_t(timestamp);
+        std::tm local{};
+#ifdef _WIN32
+        localtime_s(&local, &seconds);
+#else
+        localtime_r(&seconds, &local);
+#endif
+        append_number(out, static_cast<std::uint32_t>(local.tm_year + 1900), 4);
+        out += '-';
+        append_number(out, static_cast<std::uint32_t>(local.tm_mon + 1), 2);
+        out += '-';
+        append_number(out, static_cast<std::uint32_t>(local.tm_mday), 2);
+        out += ' ';
+        append_number(out, static_cast<std::uint32_t>(local.tm_hour), 2);
+        out += ':';
+        append_number(out, static_cast<std::uint32_t>(local.tm_min), 2);
+        out += ':';
+        append_number(out, static_cast<std::uint32_t>(local.tm_sec), 2);
+        out += ' ';
+    }
+    else if constexpr (Style == TimestampStyle::Iso8601Utc)
+    {
+        const auto day_point = std::chrono::floor<std::chrono::days>(timestamp);
+        const std::chrono::year_month_day date{day_point};
+        const std::chrono::hh_mm_ss time{
+            std::chrono::floor<std::chrono::milliseconds>(timestamp - day_point)};
+
+        append_number(out, static_cast<std::uint32_t>(static_cast<int>(date.year())), 4);
+        out += '-';
+        append_number(out, static_cast<unsigned>(date.month()), 2);
+        out += '-';
+        append_number(out, static_cast<unsigned>(date.day()), 2);
+        out += 'T';
+        append_number(out, static_cast<std::uint32_t>(time.hours().count()), 2);
+        out += ':';
+        append_number(out, static_cast<std::uint32_t>(time.minutes().count()), 2);
+        out += ':';
+        append_number(out, static_cast<std::uint32_t>(time.seconds().count()), 2);
+        out += '.';
+        append_number(out, static_cast<std::uint32_t>(time.subseconds().count()), 3);
+        out += "Z ";
+    }
+}
+}  // namespace detail
+
+/**
+ * @class StaticFormatter
+ * @brief A formatter whose layout options are template parameters.
+ *
+ * Produces the same layout as SimpleFormatter, but colors, file/line, function name and the
+ * timestamp style are chosen at compile time, so an instantiation contains only the code for
+ * the parts it renders. The level prefixes (tag, padding and color codes) are generated from
+ * LOGLEVEL_LIST at compile time and selected by table lookup instead of a switch. The timestamp
+ * is the creation time of the message.
+ *
+ * @tparam Options The layout options.
+ */
+template <FormatterOptions Options = FormatterOptions{}>
+class StaticFormatter: public LogFormatter
+{
+    public:
+        /**
+         * @brief The layout options of this formatter.
+         */
+        static constexpr FormatterOptions options = Options;
+
+        /**
+         * @brief Returns the prefix written in front of messages of the given level.
+         * @param level The log level.
+         * @return The level prefix, or the "Unknown" prefix for out-of-range levels.
+         */
+        [[nodiscard]] static constexpr auto level_prefix(LogLevel level) -> std::string_view
+        {
+            const auto index = static_cast<std::size_t>(level);
+            return detail::LevelPrefixes<Options.colors>[index < LogLevelCount ? index
+                                                                                : LogLevelCount]
+                .view();
+        }
+
+        /**
+         * @brief Formats the log message according to the compile-time options.
+         *
+         * @param log_message The log message to format.
+         * @param location The source location of the log message.
+         * @return The formatted log message as a std::string.
+         */
+        [[nodiscard]] auto format(
+            const LogMessage& log_message,
+            const std::source_location& location = std::source_location::current()) const
+            -> std::string override
+        {
+            const std::string& message = log_message.get_message();
+            std::string out;
+            out.reserve(64 + message.size());
+
+            out += level_prefix(log_message.get_level());
+            detail::append_timestamp<Options.timestamp>(out, log_message.get_timestamp());
+
+            if (!log_message.get_category().empty())
+            {
+                out += '[';
+                out += log_message.get_category();
+                out += "] ";
+            }
+
+            out += message;
+
+            if constexpr (Options.location || Options.function)
+            {
+                append_context(out, log_message, location);
+            }
+
+            return out;
+        }
+
+    private:
+        static auto append_colored(std::string& out, std::string_view text) -> void
+        {
+            if constexpr (Options.colors)
+            {
+                out += detail::ContextColor;
+                out += text;
+                out += detail::ResetColor;
+            }
+            else
+            {
+                out += text;
+            }
+        }
+
+        static auto append_context(std::string& out, const LogMessage& log_message,
+                                   const std::source_location& location) -> void
+        {
+            // Messages with an explicit source context are logged with an empty source_location.
+            std::string_view file = location.file_name();
+            std::string_view function = location.function_name();
+            std::uint_least32_t line = location.line();
+
+            if (file.empty() && function.empty() && line == 0)
+            {
+                file = log_message.get_file();
+                function = log_message.get_function();
+                line = log_message.get_line();
+            }
+
+            const bool has_file = Options.location && !file.empty();
+            const bool has_line = Options.location && line > 0;
+            const bool has_function = Options.function && !function.empty();
+
+            if (!has_file && !has_line && !has_function)
+            {
+                return;
+            }
+
+            out += " - ";
+
+            if (has_file)
+            {
+                append_colored(out, file);
+            }
+
+            if (has_line)
+            {
+                out += ':';
+                std::string number;
+                detail::append_number(number, static_cast<std::uint32_t>(line));
+                append_colored(out, number);
+            }
+
+            if (has_function)
+            {
+                if (has_file || has_line)
+                {
+                    out += ", ";
+                }
+                append_colored(out, function);
+            }
+        }
+};
+
+/**
+ * @brief A formatter for file sinks: no colors, no function names, local timestamps.
+ */
+using PlainFormatter = StaticFormatter<FormatterOptions{
+    .colors = false, .location = true, .function = false, .timestamp = TimestampStyle::Local}>;
+
+}  // namespace SimpleCppLogger
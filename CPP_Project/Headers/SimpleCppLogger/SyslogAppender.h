@@ -0,0 +1,140 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <shared_mutex>
+#include <source_location>
+#include <span>
+#include <string>
+#include <string_view>
+
+#include "ApiMacro.h"
+#include "SimpleCppLogger/LogAppender.h"
+#include "SimpleCppLogger/LogLevel.h"
+
+namespace SimpleCppLogger
+{
+/**
+ * @struct SyslogAppenderOptions
+ * @brief Configuration of a SyslogAppender.
+ */
+struct SyslogAppenderOptions {
+        std::string socket_path = "/dev/log";  ///< Datagram socket of the local syslog daemon.
+        int facility = 1;                      ///< Syslog facility (1 = user-level messages).
+        std::string app_name;                  ///< APP-NAME field; "-" if empty.
+        std::string hostname;                  ///< HOSTNAME field; the host name if empty.
+        std::size_t max_message_size = 8192;   ///< Longer datagrams are truncated.
+};
+
+/**
+ * @class SyslogAppender
+ * @brief A log appender that sends RFC 5424 messages to the local syslog daemon.
+ *
+ * Records are sent over a non-blocking AF_UNIX datagram socket. If the socket buffer is full or
+ * the daemon is not reachable, records are dropped and counted instead of blocking the caller;
+ * a lost connection is re-established at most once per second. Batches from append_batch() are
+ * sent with a single sendmmsg call on Linux.
+ *
+ * The message text is the raw message unless a formatter is set. Only available on POSIX
+ * systems; elsewhere every record is dropped.
+ */
+class SIMPLECPPLOGGER_API SyslogAppender: public LogAppender
+{
+    public:
+        /**
+         * @brief Creates the socket and connects it to the configured path.
+         *
+         * @param options The socket and header configuration.
+         * @param formatter The LogFormatter for the MSG part, or nullptr for the raw message.
+         */
+        explicit SyslogAppender(const SyslogAppenderOptions& options = {},
+                                const std::shared_ptr<LogFormatter>& formatter = nullptr);
+
+        /**
+         * @brief Closes the socket.
+         */
+        ~SyslogAppender() override;
+
+        SyslogAppender(const SyslogAppender&) = delete;
+        auto operator=(const SyslogAppender&) -> SyslogAppender& = delete;
+
+        /**
+         * @brief Returns whether the socket is currently connected.
+         * @return True if records can be sent.
+         */
+        [[nodiscard]] auto is_connected() const -> bool;
+
+        /**
+         * @brief Returns the number of datagrams sent.
+         * @return The sent count.
+         */
+        [[nodiscard]] auto get_sent_count() const -> std::uint64_t;
+
+        /**
+         * @brief Returns the number of records dropped because they could not be sent.
+         * @return The drop count.
+         */
+        [[nodiscard]] auto get_dropped_count() const -> std::uint64_t;
+
+        /**
+         * @brief Returns true; preformatted text becomes the MSG part unchanged.
+         */
+        [[nodiscard]] auto supports_preformatted() const -> bool override;
+
+        /**
+         * @brief Encodes all records that pass the level check and sends them with as few
+         * system calls as possible.
+         *
+         * @param records The messages to append, with their source locations.
+         */
+        auto append_batch(std::span<const StagedRecord> records) -> void override;
+
+        /**
+         * @brief Maps a log level to a syslog severity.
+         *
+         * Trace and Debug map to Debug (7), Info to Informational (6), Warning to Warning (4),
+         * Error to Error (3) and Fatal to Critical (2).
+         *
+         * @param level The log level.
+         * @return The syslog severity.
+         */
+        [[nodiscard]] static auto to_severity(LogLevel level) -> int;
+
+        /**
+         * @brief Encodes a record as an RFC 5424 message.
+         *
+         * The category becomes the MSGID. No structured data is sent.
+         *
+         * @param message The log message.
+         * @param text The MSG part.
+         * @return The encoded message, truncated to max_message_size.
+         */
+        [[nodiscard]] auto encode(const LogMessage& message, std::string_view text) const
+            -> std::string;
+
+    private:
+        auto internal_append(const LogMessage& message,
+                             const std::source_location& location) -> void override;
+
+        auto internal_append_formatted(const LogMessage& message,
+                                       const std::source_location& location,
+                                       std::string&& formatted) -> void override;
+
+        auto send(std::span<std::string> datagrams) -> void;
+        auto connect_socket() -> bool;
+
+        SyslogAppenderOptions m_options;
+        std::string m_header_suffix;  ///< " HOSTNAME APP-NAME PROCID ", shared by all messages.
+
+        mutable std::shared_mutex m_socket_mutex;  ///< Exclusive only to reconnect.
+        int m_socket = -1;
+        std::chrono::steady_clock::time_point m_next_connect;
+
+        std::atomic<std::uint64_t> m_sent{0};
+        std::atomic<std::uint64_t> m_dropped{0};
+};
+
+}  // namespace SimpleCppLogger
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+
+#include "ApiMacro.h"
+
+/**
+ * @file Utf8Conversion.h
+ * @brief Conversion of wide strings (UTF-16 or UTF-32, depending on wchar_t) to UTF-8.
+ */
+
+namespace SimpleCppLogger
+{
+/**
+ * @brief Appends the UTF-8 encoding of a wide string.
+ *
+ * wchar_t is treated as UTF-16 where it is 16 bits wide (Windows) and as UTF-32 otherwise.
+ * Runs of ASCII characters are copied without decoding. Unpaired surrogates and values outside
+ * the Unicode range are replaced with U+FFFD.
+ *
+ * @param out The string to append to.
+ * @param text The wide text to convert.
+ */
+SIMPLECPPLOGGER_API auto append_utf8(std::string& out, std::wstring_view text) -> void;
+
+/**
+ * @brief Converts a wide string to UTF-8.
+ * @param text The wide text to convert.
+ * @return The UTF-8 encoded text.
+ */
+[[nodiscard]] SIMPLECPPLOGGER_API auto to_utf8(std::wstring_view text) -> std::string;
+
+}  // namespace SimpleCppLogger
@@ -0,0 +1,86 @@
+/// @file WLogStream.h
+/// @brief Defines the WLogStream class for wide-character stream-style logging.
+
+#pragma once
+
+#include <source_location>
+#include <sstream>
+#include <string>
+
+#include "SimpleCppLogger/LogCategory.h"
+#include "SimpleCppLogger/LogLevel.h"
+
+namespace SimpleCppLogger
+{
+class LoggerContext;
+
+/**
+ * @class WLogStream
+ * @brief Helper class for wide-character stream-style logging.
+ *
+ * The wide counterpart of LogStream: values are streamed into a std::wostringstream and the
+ * resulting std::wstring is moved into a wide LogMessage when the WLogStream is destroyed.
+ * Conversion to UTF-8 is left to the appenders that need it.
+ */
+class WLogStream
+{
+    public:
+        /**
+         * @brief Constructs a WLogStream for the given log level and source location.
+         * @param level The log level.
+         * @param location The source location (defaults to caller location).
+         */
+        WLogStream(LogLevel level, std::source_location location = std::source_location::current());
+
+        /**
+         * @brief Constructs a WLogStream for a message that belongs to a category.
+         * @param category The category of the message.
+         * @param level The log level.
+         * @param location The source location (defaults to caller location).
+         */
+        WLogStream(const LogCategory& category, LogLevel level,
+                   std::source_location location = std::source_location::current());
+
+        /**
+         * @brief Constructs a WLogStream that sends its message to the given context.
+         * @param context The logger context that receives the message.
+         * @param level The log level.
+         * @param location The source location (defaults to caller location).
+         */
+        WLogStream(LoggerContext& context, LogLevel level,
+                   std::source_location location = std::source_location::current());
+
+        /**
+         * @brief Appends a value to the log message.
+         * @tparam T The type of the value.
+         * @param value The value to append.
+         * @return Reference to this WLogStream.
+         */
+        template<typename T>
+        WLogStream& operator<<(const T& value)
+        {
+            m_stream << value;
+            return *this;
+        }
+
+        /**
+         * @brief Appends a stream manipulator (e.g., std::endl) to the log message.
+         * @param manip The stream manipulator.
+         * @return Reference to this WLogStream.
+         */
+        WLogStream& operator<<(std::wostream& (*manip)(std::wostream&));
+
+        /**
+         * @brief Destructor. Sends the accumulated message to the logger.
+         */
+        ~WLogStream();
+
+    private:
+        LoggerContext* m_context;
+        LogLevel m_level;
+        std::wostringstream m_stream;
+        std::source_location m_location;
+        LogCategory m_category;
+};
+
+}  // namespace SimpleCppLogger
@@ -0,0 +1,315 @@
+#include "SimpleCppLogger/AsyncAppender.h"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "SimpleCppLogger/LogLevel.h"
+
+namespace SimpleCppLogger
+{
+
+/**
+ * @brief Wraps the given appender and starts the worker thread.
+ *
+ * The decorator takes over the wrapped appender's level and opens the wrapped appender to all
+ * levels, so that only the decorator filters.
+ *
+ * @param appender The appender to decorate. Must not be null.
+ * @param options The queue configuration.
+ */
+AsyncAppender::AsyncAppender(std::shared_ptr<LogAppender> appender,
+                             const AsyncAppenderOptions& options)
+    : LogAppender(nullptr), m_appender(std::move(appender)), m_options(options)
+{
+    m_options.queue_capacity = std::max<std::size_t>(m_options.queue_capacity, 1);
+
+    if (m_appender)
+    {
+        m_log_level = m_appender->get_log_level();
+        m_appender->set_log_level(LogLevel::Trace);
+    }
+
+    m_worker = std::thread([this] { run(); });
+}
+
+/**
+ * @brief Delivers all queued messages and stops the worker thread.
+ */
+AsyncAppender::~AsyncAppender()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+
+    m_not_empty.notify_all();
+    m_worker.join();
+}
+
+/**
+ * @brief Returns the number of messages waiting in the queue.
+ * @return The queue size.
+ */
+auto AsyncAppender::get_queue_size() const -> std::size_t
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_queue.size();
+}
+
+/**
+ * @brief Returns the number of messages dropped because the queue was full.
+ * @return The drop count.
+ */
+auto AsyncAppender::get_dropped_count() const -> std::uint64_t
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_dropped;
+}
+
+/**
+ * @brief Returns the decorated appender.
+ * @return The wrapped appender.
+ */
+auto AsyncAppender::get_appender() const -> const std::shared_ptr<LogAppender>&
+{
+    return m_appender;
+}
+
+/**
+ * @brief Formats the message with the wrapped appender's formatter.
+ *
+ * @param message The log message to format.
+ * @param location The source location of the log message.
+ * @return The formatted text.
+ */
+auto AsyncAppender::format(const LogMessage& message, const std::source_location& location) const
+    -> std::string
+{
+    return m_appender ? m_appender->format(message, location) : message.get_message();
+}
+
+/**
+ * @brief Returns whether the wrapped appender supports preformatted output.
+ */
+auto AsyncAppender::supports_preformatted() const -> bool
+{
+    return m_appender && m_appender->supports_preformatted();
+}
+
+/**
+ * @brief Queues a copy of the message for the worker thread.
+ *
+ * @param message The log message to append.
+ * @param location The source location of the log message.
+ */
+auto AsyncAppender::internal_append(const LogMessage& message,
+                                    const std::source_location& location) -> void
+{
+    enqueue(Entry{message, location, {}, false});
+}
+
+/**
+ * @brief Queues a copy of the message together with its formatted text.
+ *
+ * @param message The log message to append.
+ * @param location The source location of the log message.
+ * @param formatted The formatted text.
+ */
+auto AsyncAppender::internal_append_formatted(const LogMessage& message,
+                                              const std::source_location& location,
+                                              std::string&& formatted) -> void
+{
+    enqueue(Entry{message, location, std::move(formatted), true});
+}
+
+/**
+ * @brief Flushes the wrapped appender once every message queued so far has been passed to it.
+ *
+ * The request is never dropped, even if the queue is full; the callback runs on the worker
+ * thread or on the wrapped appender's writer thread.
+ *
+ * @param callback Passed on to the wrapped appender's flush.
+ * @param mode Passed on to the wrapped appender's flush.
+ */
+auto AsyncAppender::internal_flush(FlushCallback callback, FlushMode mode) -> void
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_flush_requests.push_back(FlushRequest{m_queued, mode, std::move(callback)});
+    }
+
+    m_not_empty.notify_one();
+}
+
+/**
+ * @brief Queues copies of all records that pass the level check under a single lock.
+ *
+ * @param records The messages to append, with their source locations.
+ */
+auto AsyncAppender::append_batch(std::span<const StagedRecord> records) -> void
+{
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        for (const auto& record: records)
+        {
+            if (record.message.get_level() >= m_log_level && wait_for_space(lock))
+            {
+                m_queue.push_back(Entry{record.message, record.location, {}, false});
+                ++m_queued;
+            }
+        }
+    }
+
+    m_not_empty.notify_one();
+}
+
+/**
+ * @brief Adds an entry to the queue, applying the overflow policy if it is full.
+ */
+auto AsyncAppender::enqueue(Entry&& entry) -> void
+{
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        if (!wait_for_space(lock))
+        {
+            return;
+        }
+
+        m_queue.push_back(std::move(entry));
+        ++m_queued;
+    }
+
+    m_not_empty.notify_one();
+}
+
+/**
+ * @brief Applies the overflow policy if the queue is full. The caller must hold the lock.
+ * @return True if the entry can be queued, false if it was dropped.
+ */
+auto AsyncAppender::wait_for_space(std::unique_lock<std::mutex>& lock) -> bool
+{
+    if (m_queue.size() < m_options.queue_capacity)
+    {
+        return true;
+    }
+
+    if (m_options.overflow_policy == AsyncOverflowPolicy::Drop)
+    {
+        ++m_dropped;
+        return false;
+    }
+
+    // The worker may not have been woken for the entries queued by this batch yet.
+    m_not_empty.notify_one();
+    m_not_full.wait(lock, [this] { return m_queue.size() < m_options.queue_capacity; });
+    return true;
+}
+
+/**
+ * @brief Worker loop: takes all queued entries at once, passes them to the wrapped appender and
+ * then completes the flush requests they satisfy.
+ */
+auto AsyncAppender::run() -> void
+{
+    std::deque<Entry> batch;
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    for (;;)
+    {
+        m_not_empty.wait(lock, [this] {
+            return !m_queue.empty() || !m_flush_requests.empty() || m_stopping;
+        });
+
+        if (m_queue.empty() && m_flush_requests.empty())
+        {
+            return;
+        }
+
+        batch.swap(m_queue);
+        lock.unlock();
+        m_not_full.notify_all();
+
+        if (m_appender)
+        {
+            deliver(batch);
+        }
+
+        const std::size_t delivered = batch.size();
+        batch.clear();
+        lock.lock();
+        m_delivered += delivered;
+        complete_flush_requests(lock);
+    }
+}
+
+/**
+ * @brief Passes the flush requests whose entries have all been delivered on to the wrapped
+ * appender. Called with the lock held; releases it while the wrapped appender flushes.
+ */
+auto AsyncAppender::complete_flush_requests(std::unique_lock<std::mutex>& lock) -> void
+{
+    std::vector<FlushRequest> ready;
+
+    while (!m_flush_requests.empty() && m_flush_requests.front().position <= m_delivered)
+    {
+        ready.push_back(std::move(m_flush_requests.front()));
+        m_flush_requests.pop_front();
+    }
+
+    if (ready.empty())
+    {
+        return;
+    }
+
+    lock.unlock();
+
+    for (auto& request: ready)
+    {
+        if (m_appender)
+        {
+            m_appender->flush(std::move(request.callback), request.mode);
+        }
+        else
+        {
+            request.callback(true);
+        }
+    }
+
+    lock.lock();
+}
+
+/**
+ * @brief Passes a batch to the wrapped appender. Runs of entries without preformatted text are
+ * handed over with a single append_batch() call.
+ */
+auto AsyncAppender::deliver(std::deque<Entry>& batch) -> void
+{
+    std::vector<StagedRecord> records;
+
+    for (auto& entry: batch)
+    {
+        if (!entry.preformatted)
+        {
+            records.push_back(StagedRecord{std::move(entry.message), entry.location});
+            continue;
+        }
+
+        if (!records.empty())
+        {
+            m_appender->append_batch(records);
+            records.clear();
+        }
+
+        m_appender->append_formatted(entry.message, entry.location, std::move(entry.formatted));
+    }
+
+    if (!records.empty())
+    {
+        m_appender->append_batch(records);
+    }
+}
+
+}  // namespace SimpleCppLogger
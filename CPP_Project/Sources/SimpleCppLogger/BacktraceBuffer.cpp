@@ -0,0 +1,101 @@
+#include "SimpleCppLogger/BacktraceBuffer.h"
+
+#include <iterator>
+#include <utility>
+
+namespace SimpleCppLogger
+{
+
+/**
+ * @brief Constructs a buffer with the given capacity.
+ *
+ * Memory for the records is allocated as they arrive, so an unused buffer stays small.
+ *
+ * @param capacity The maximum number of records kept (0 keeps nothing).
+ */
+BacktraceBuffer::BacktraceBuffer(std::size_t capacity): m_capacity(capacity) {}
+
+/**
+ * @brief Stores a record, overwriting the oldest one if the buffer is full.
+ * @param message The message to store.
+ * @param location The source location of the message.
+ */
+auto BacktraceBuffer::push(LogMessage&& message, const std::source_location& location) -> void
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (m_capacity == 0)
+    {
+        return;
+    }
+
+    StagedRecord record{std::move(message), location, m_sequence++};
+
+    if (m_records.size() < m_capacity)
+    {
+        m_records.push_back(std::move(record));
+        return;
+    }
+
+    m_records[m_next] = std::move(record);
+    m_next = (m_next + 1) % m_capacity;
+}
+
+/**
+ * @brief Moves all stored records, oldest first, to the end of the given vector and empties the
+ * buffer.
+ *
+ * @param out The vector to append to.
+ * @return The number of records moved.
+ */
+auto BacktraceBuffer::take_all(std::vector<StagedRecord>& out) -> std::size_t
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const std::size_t count = m_records.size();
+
+    out.reserve(out.size() + count);
+    out.insert(out.end(), std::make_move_iterator(m_records.begin() + m_next),
+               std::make_move_iterator(m_records.end()));
+    out.insert(out.end(), std::make_move_iterator(m_records.begin()),
+               std::make_move_iterator(m_records.begin() + m_next));
+
+    m_records.clear();
+    m_next = 0;
+
+    return count;
+}
+
+/**
+ * @brief Discards all records and changes the capacity.
+ * @param capacity The new capacity.
+ */
+auto BacktraceBuffer::reset(std::size_t capacity) -> void
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_records.clear();
+    m_records.shrink_to_fit();
+    m_capacity = capacity;
+    m_next = 0;
+}
+
+/**
+ * @brief Returns the maximum number of records kept.
+ * @return The capacity.
+ */
+auto BacktraceBuffer::get_capacity() const -> std::size_t
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_capacity;
+}
+
+/**
+ * @brief Returns the number of stored records.
+ * @return The number of records.
+ */
+auto BacktraceBuffer::size() const -> std::size_t
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_records.size();
+}
+
+}  // namespace SimpleCppLogger
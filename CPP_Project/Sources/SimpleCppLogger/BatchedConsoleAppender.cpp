@@ -0,0 +1,331 @@
+#include "SimpleCppLogger/BatchedConsoleAppender.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <utility>
+
+#include "SimpleCppLogger/SimpleFormatter.h"
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <climits>
+#endif
+
+namespace SimpleCppLogger
+{
+
+namespace
+{
+#ifdef _WIN32
+/**
+ * @brief Writes the whole buffer to the descriptor, retrying on partial writes.
+ */
+auto write_all(int fd, const char* data, std::size_t size) -> void
+{
+    while (size > 0)
+    {
+        const auto chunk = static_cast<unsigned int>(std::min<std::size_t>(size, 1u << 30));
+        const int written = _write(fd, data, chunk);
+
+        if (written <= 0)
+        {
+            return;
+        }
+
+        data += written;
+        size -= static_cast<std::size_t>(written);
+    }
+}
+#else
+#ifdef IOV_MAX
+constexpr std::size_t MaxIovecs = IOV_MAX;
+#else
+constexpr std::size_t MaxIovecs = 1024;
+#endif
+
+/**
+ * @brief Writes all iovecs to the descriptor, retrying on EINTR and partial writes.
+ *
+ * Output that cannot be written (closed pipe, full non-blocking descriptor) is dropped; a
+ * logger must not fail its caller because the console went away.
+ */
+auto writev_all(int fd, iovec* iov, std::size_t count) -> void
+{
+    while (count > 0)
+    {
+        const auto batch = static_cast<int>(std::min(count, MaxIovecs));
+        const ssize_t written = ::writev(fd, iov, batch);
+
+        if (written < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return;
+        }
+
+        auto remaining = static_cast<std::size_t>(written);
+        while (count > 0 && remaining >= iov->iov_len)
+        {
+            remaining -= iov->iov_len;
+            ++iov;
+            --count;
+        }
+
+        if (count > 0 && remaining > 0)
+        {
+            iov->iov_base = static_cast<char*>(iov->iov_base) + remaining;
+            iov->iov_len -= remaining;
+        }
+    }
+}
+#endif
+
+/**
+ * @brief Writes one contiguous buffer to the descriptor.
+ */
+auto write_buffer(int fd, std::string& buffer) -> void
+{
+#ifdef _WIN32
+    write_all(fd, buffer.data(), buffer.size());
+#else
+    iovec single{buffer.data(), buffer.size()};
+    writev_all(fd, &single, 1);
+#endif
+}
+}  // namespace
+
+/**
+ * @brief Constructs a BatchedConsoleAppender object.
+ *
+ * If no formatter is provided, a SimpleFormatter is created whose color codes are enabled only
+ * if both configured descriptors are terminals.
+ *
+ * @param options The output configuration.
+ * @param formatter The LogFormatter to use, or nullptr for a TTY-aware SimpleFormatter.
+ */
+BatchedConsoleAppender::BatchedConsoleAppender(const ConsoleOutputOptions& options,
+                                               const std::shared_ptr<LogFormatter>& formatter)
+    : LogAppender(formatter ? formatter
+                            : std::make_shared<SimpleFormatter>(is_terminal(options.stdout_fd) &&
+                                                                is_terminal(options.stderr_fd))),
+      m_options(options)
+{
+    m_options.max_batch_records = std::max<std::size_t>(m_options.max_batch_records, 1);
+    m_pending.reserve(m_options.max_batch_records);
+}
+
+/**
+ * @brief Writes all pending lines and destroys the appender.
+ */
+BatchedConsoleAppender::~BatchedConsoleAppender()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    flush_locked();
+}
+
+/**
+ * @brief Returns the number of lines waiting to be written.
+ * @return The number of pending lines.
+ */
+auto BatchedConsoleAppender::get_pending_count() const -> std::size_t
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_pending.size();
+}
+
+/**
+ * @brief Returns whether the given file descriptor refers to a terminal.
+ * @param fd The file descriptor to check.
+ * @return True if fd is a terminal, false otherwise.
+ */
+auto BatchedConsoleAppender::is_terminal(int fd) -> bool
+{
+#ifdef _WIN32
+    return _isatty(fd) != 0;
+#else
+    return ::isatty(fd) == 1;
+#endif
+}
+
+/**
+ * @brief Formats the message and writes or queues it according to the flush policy.
+ *
+ * With ConsoleFlushPolicy::EveryMessage the line is written immediately. With
+ * ConsoleFlushPolicy::Batched it is queued and the queue is written once the record or byte
+ * limit is reached or the message level is at or above the configured flush level.
+ *
+ * @param message The log message to append.
+ * @param location The source location of the log message.
+ */
+auto BatchedConsoleAppender::internal_append(const LogMessage& message,
+                                             const std::source_location& location) -> void
+{
+    internal_append_formatted(message, location, m_formatter->format(message, location));
+}
+
+/**
+ * @brief Writes or queues already formatted text according to the flush policy.
+ *
+ * @param message The log message to append.
+ * @param location The source location of the log message.
+ * @param formatted The formatted text without a trailing newline.
+ */
+auto BatchedConsoleAppender::internal_append_formatted(const LogMessage& message,
+                                                       const std::source_location& /*location*/,
+                                                       std::string&& formatted) -> void
+{
+    std::string line = std::move(formatted);
+    line += '\n';
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_pending_bytes += line.size();
+    m_pending.push_back({select_fd(message.get_level()), std::move(line)});
+
+    if (m_options.flush_policy == ConsoleFlushPolicy::EveryMessage ||
+        m_pending.size() >= m_options.max_batch_records ||
+        m_pending_bytes >= m_options.max_batch_bytes ||
+        message.get_level() >= m_options.flush_level)
+    {
+        flush_locked();
+    }
+}
+
+/**
+ * @brief Formats the batch into one buffer per run of lines for the same descriptor and writes
+ * each run with a single system call.
+ *
+ * Formatting happens before m_mutex is taken. Pending lines are written first, so the order is
+ * preserved.
+ *
+ * @param records The messages to append, with their source locations.
+ */
+auto BatchedConsoleAppender::append_batch(std::span<const StagedRecord> records) -> void
+{
+    std::vector<PendingLine> runs;
+
+    for (const auto& record: records)
+    {
+        if (record.message.get_level() < m_log_level)
+        {
+            continue;
+        }
+
+        const int fd = select_fd(record.message.get_level());
+        if (runs.empty() || runs.back().fd != fd)
+        {
+            runs.push_back({fd, {}});
+        }
+
+        runs.back().text += m_formatter->format(record.message, record.location);
+        runs.back().text += '\n';
+    }
+
+    if (runs.empty())
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    flush_locked();
+
+    for (auto& run: runs)
+    {
+        write_buffer(run.fd, run.text);
+    }
+}
+
+/**
+ * @brief Writes all pending lines to their file descriptors.
+ *
+ * @param callback Called with true once the lines are written.
+ */
+auto BatchedConsoleAppender::internal_flush(FlushCallback callback, FlushMode /*mode*/) -> void
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        flush_locked();
+    }
+
+    callback(true);
+}
+
+/**
+ * @brief Writes all pending lines. The caller must hold m_mutex.
+ *
+ * Consecutive lines for the same descriptor are written with a single writev call, so the
+ * order of lines is preserved even when stdout and stderr refer to the same file.
+ */
+auto BatchedConsoleAppender::flush_locked() -> void
+{
+    std::size_t run_begin = 0;
+
+    while (run_begin < m_pending.size())
+    {
+        const int fd = m_pending[run_begin].fd;
+        std::size_t run_end = run_begin;
+
+        while (run_end < m_pending.size() && m_pending[run_end].fd == fd)
+        {
+            ++run_end;
+        }
+
+#ifdef _WIN32
+        std::string buffer;
+        for (std::size_t i = run_begin; i < run_end; ++i)
+        {
+            buffer += m_pending[i].text;
+        }
+        write_all(fd, buffer.data(), buffer.size());
+#else
+        if (run_end - run_begin == 1)
+        {
+            iovec single{m_pending[run_begin].text.data(), m_pending[run_begin].text.size()};
+            writev_all(fd, &single, 1);
+        }
+        else
+        {
+            std::vector<iovec> iov;
+            iov.reserve(run_end - run_begin);
+            for (std::size_t i = run_begin; i < run_end; ++i)
+            {
+                iov.push_back({m_pending[i].text.data(), m_pending[i].text.size()});
+            }
+            writev_all(fd, iov.data(), iov.size());
+        }
+#endif
+
+        run_begin = run_end;
+    }
+
+    m_pending.clear();
+    m_pending_bytes = 0;
+}
+
+/**
+ * @brief Returns true; preformatted text is written unchanged.
+ */
+auto BatchedConsoleAppender::supports_preformatted() const -> bool
+{
+    return true;
+}
+
+auto BatchedConsoleAppender::select_fd(LogLevel level) const -> int
+{
+    switch (level)
+    {
+    case LogLevel::Warning:
+    case LogLevel::Error:
+    case LogLevel::Fatal:
+        return m_options.stderr_fd;
+    default:
+        return m_options.stdout_fd;
+    }
+}
+
+}  // namespace SimpleCppLogger
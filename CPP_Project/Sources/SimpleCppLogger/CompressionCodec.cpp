@@ -0,0 +1,381 @@
+#include "SimpleCppLogger/CompressionCodec.h"
+
+#include <climits>
+#include <cstddef>
+
+#if defined(SIMPLECPPLOGGER_HAS_ZLIB)
+#include <zlib.h>
+#endif
+
+#if defined(SIMPLECPPLOGGER_HAS_ZSTD)
+#include <zstd.h>
+#endif
+
+#if defined(SIMPLECPPLOGGER_HAS_LZ4)
+#include <lz4frame.h>
+#endif
+
+namespace SimpleCppLogger
+{
+
+namespace
+{
+constexpr std::size_t DecompressChunkSize = 64 * 1024;
+
+#if defined(SIMPLECPPLOGGER_HAS_ZLIB)
+/**
+ * @brief Writes every frame as a gzip member. The deflate state is reused between frames.
+ */
+class ZlibCodec final: public CompressionCodec
+{
+    public:
+        explicit ZlibCodec(int level): m_level(level == 0 ? Z_DEFAULT_COMPRESSION : level) {}
+
+        ~ZlibCodec() override
+        {
+            if (m_initialized)
+            {
+                deflateEnd(&m_stream);
+            }
+        }
+
+        ZlibCodec(const ZlibCodec&) = delete;
+        auto operator=(const ZlibCodec&) -> ZlibCodec& = delete;
+
+        [[nodiscard]] auto get_name() const -> std::string_view override
+        {
+            return "zlib";
+        }
+
+        [[nodiscard]] auto get_file_extension() const -> std::string_view override
+        {
+            return ".gz";
+        }
+
+        auto compress(std::string_view input, std::string& out) -> bool override
+        {
+            if (input.size() > UINT_MAX)
+            {
+                return false;
+            }
+
+            if (!m_initialized)
+            {
+                // 16 + MAX_WBITS selects the gzip wrapper.
+                if (deflateInit2(&m_stream, m_level, Z_DEFLATED, 16 + MAX_WBITS, 8,
+                                 Z_DEFAULT_STRATEGY) != Z_OK)
+                {
+                    return false;
+                }
+                m_initialized = true;
+            }
+            else if (deflateReset(&m_stream) != Z_OK)
+            {
+                return false;
+            }
+
+            const std::size_t offset = out.size();
+            const auto bound = deflateBound(&m_stream, static_cast<uLong>(input.size()));
+            out.resize(offset + bound);
+
+            m_stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(input.data()));
+            m_stream.avail_in = static_cast<uInt>(input.size());
+            m_stream.next_out = reinterpret_cast<Bytef*>(out.data() + offset);
+            m_stream.avail_out = static_cast<uInt>(bound);
+
+            const bool finished = deflate(&m_stream, Z_FINISH) == Z_STREAM_END;
+            out.resize(finished ? offset + m_stream.total_out : offset);
+
+            return finished;
+        }
+
+        auto decompress(std::string_view input, std::string& out) -> bool override
+        {
+            if (input.empty())
+            {
+                return true;
+            }
+
+            if (input.size() > UINT_MAX)
+            {
+                return false;
+            }
+
+            z_stream stream{};
+            // 32 + MAX_WBITS accepts both the gzip and the zlib wrapper.
+            if (inflateInit2(&stream, 32 + MAX_WBITS) != Z_OK)
+            {
+                return false;
+            }
+
+            stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(input.data()));
+            stream.avail_in = static_cast<uInt>(input.size());
+
+            char buffer[DecompressChunkSize];
+            bool complete = false;
+
+            for (;;)
+            {
+                stream.next_out = reinterpret_cast<Bytef*>(buffer);
+                stream.avail_out = sizeof(buffer);
+
+                const int result = inflate(&stream, Z_NO_FLUSH);
+                out.append(buffer, sizeof(buffer) - stream.avail_out);
+
+                if (result == Z_STREAM_END)
+                {
+                    if (stream.avail_in == 0)
+                    {
+                        complete = true;
+                        break;
+                    }
+                    inflateReset(&stream);
+                }
+                else if (result != Z_OK)
+                {
+                    break;
+                }
+            }
+
+            inflateEnd(&stream);
+            return complete;
+        }
+
+    private:
+        int m_level;
+        z_stream m_stream{};
+        bool m_initialized = false;
+};
+#endif
+
+#if defined(SIMPLECPPLOGGER_HAS_ZSTD)
+/**
+ * @brief Writes every frame as a Zstandard frame. The compression context is reused.
+ */
+class ZstdCodec final: public CompressionCodec
+{
+    public:
+        explicit ZstdCodec(int level): m_level(level == 0 ? ZSTD_CLEVEL_DEFAULT : level) {}
+
+        ~ZstdCodec() override
+        {
+            ZSTD_freeCCtx(m_context);
+        }
+
+        ZstdCodec(const ZstdCodec&) = delete;
+        auto operator=(const ZstdCodec&) -> ZstdCodec& = delete;
+
+        [[nodiscard]] auto get_name() const -> std::string_view override
+        {
+            return "zstd";
+        }
+
+        [[nodiscard]] auto get_file_extension() const -> std::string_view override
+        {
+            return ".zst";
+        }
+
+        auto compress(std::string_view input, std::string& out) -> bool override
+        {
+            if (m_context == nullptr && (m_context = ZSTD_createCCtx()) == nullptr)
+            {
+                return false;
+            }
+
+            const std::size_t offset = out.size();
+            out.resize(offset + ZSTD_compressBound(input.size()));
+
+            const std::size_t written =
+                ZSTD_compressCCtx(m_context, out.data() + offset, out.size() - offset,
+                                  input.data(), input.size(), m_level);
+            const bool success = ZSTD_isError(written) == 0;
+            out.resize(success ? offset + written : offset);
+
+            return success;
+        }
+
+        auto decompress(std::string_view input, std::string& out) -> bool override
+        {
+            ZSTD_DCtx* context = ZSTD_createDCtx();
+            if (context == nullptr)
+            {
+                return false;
+            }
+
+            char buffer[DecompressChunkSize];
+            ZSTD_inBuffer in{input.data(), input.size(), 0};
+            std::size_t remaining = 0;
+            bool failed = false;
+
+            // A non-zero result means the current frame is incomplete or output is pending.
+            while (!failed && (in.pos < in.size || remaining != 0))
+            {
+                ZSTD_outBuffer chunk{buffer, sizeof(buffer), 0};
+                const std::size_t previous_pos = in.pos;
+
+                remaining = ZSTD_decompressStream(context, &chunk, &in);
+                failed = ZSTD_isError(remaining) != 0 ||
+                         (chunk.pos == 0 && in.pos == previous_pos && remaining != 0);
+                out.append(buffer, failed ? 0 : chunk.pos);
+            }
+
+            ZSTD_freeDCtx(context);
+            return !failed;
+        }
+
+    private:
+        int m_level;
+        ZSTD_CCtx* m_context = nullptr;
+};
+#endif
+
+#if defined(SIMPLECPPLOGGER_HAS_LZ4)
+/**
+ * @brief Writes every frame as an LZ4 frame.
+ */
+class Lz4Codec final: public CompressionCodec
+{
+    public:
+        explicit Lz4Codec(int level): m_level(level) {}
+
+        [[nodiscard]] auto get_name() const -> std::string_view override
+        {
+            return "lz4";
+        }
+
+        [[nodiscard]] auto get_file_extension() const -> std::string_view override
+        {
+            return ".lz4";
+        }
+
+        auto compress(std::string_view input, std::string& out) -> bool override
+        {
+            LZ4F_preferences_t preferences{};
+            preferences.compressionLevel = m_level;
+            preferences.frameInfo.contentSize = input.size();
+
+            const std::size_t offset = out.size();
+            out.resize(offset + LZ4F_compressFrameBound(input.size(), &preferences));
+
+            const std::size_t written =
+                LZ4F_compressFrame(out.data() + offset, out.size() - offset, input.data(),
+                                   input.size(), &preferences);
+            const bool success = LZ4F_isError(written) == 0;
+            out.resize(success ? offset + written : offset);
+
+            return success;
+        }
+
+        auto decompress(std::string_view input, std::string& out) -> bool override
+        {
+            LZ4F_dctx* context = nullptr;
+            if (LZ4F_isError(LZ4F_createDecompressionContext(&context, LZ4F_VERSION)))
+            {
+                return false;
+            }
+
+            char buffer[DecompressChunkSize];
+            const char* source = input.data();
+            std::size_t available = input.size();
+            std::size_t hint = 0;
+            bool failed = false;
+
+            // A non-zero hint means the current frame is incomplete or output is pending.
+            while (!failed && (available > 0 || hint != 0))
+            {
+                std::size_t produced = sizeof(buffer);
+                std::size_t consumed = available;
+
+                hint = LZ4F_decompress(context, buffer, &produced, source, &consumed, nullptr);
+                failed = LZ4F_isError(hint) != 0 || (produced == 0 && consumed == 0);
+
+                if (!failed)
+                {
+                    out.append(buffer, produced);
+                    source += consumed;
+                    available -= consumed;
+                }
+            }
+
+            LZ4F_freeDecompressionContext(context);
+            return !failed;
+        }
+
+    private:
+        int m_level;
+};
+#endif
+}  // namespace
+
+auto CompressionCodec::is_available(CompressionType type) -> bool
+{
+    switch (type)
+    {
+    case CompressionType::Zlib:
+#if defined(SIMPLECPPLOGGER_HAS_ZLIB)
+        return true;
+#else
+        return false;
+#endif
+    case CompressionType::Zstd:
+#if defined(SIMPLECPPLOGGER_HAS_ZSTD)
+        return true;
+#else
+        return false;
+#endif
+    case CompressionType::Lz4:
+#if defined(SIMPLECPPLOGGER_HAS_LZ4)
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    return false;
+}
+
+auto CompressionCodec::create([[maybe_unused]] CompressionType type, [[maybe_unused]] int level)
+    -> std::unique_ptr<CompressionCodec>
+{
+#if defined(SIMPLECPPLOGGER_HAS_ZLIB)
+    if (type == CompressionType::Zlib)
+    {
+        return std::make_unique<ZlibCodec>(level);
+    }
+#endif
+#if defined(SIMPLECPPLOGGER_HAS_ZSTD)
+    if (type == CompressionType::Zstd)
+    {
+        return std::make_unique<ZstdCodec>(level);
+    }
+#endif
+#if defined(SIMPLECPPLOGGER_HAS_LZ4)
+    if (type == CompressionType::Lz4)
+    {
+        return std::make_unique<Lz4Codec>(level);
+    }
+#endif
+
+    return nullptr;
+}
+
+auto CompressionCodec::create(std::string_view name, int level)
+    -> std::unique_ptr<CompressionCodec>
+{
+    if (name == "zlib")
+    {
+        return create(CompressionType::Zlib, level);
+    }
+    if (name == "zstd")
+    {
+        return create(CompressionType::Zstd, level);
+    }
+    if (name == "lz4")
+    {
+        return create(CompressionType::Lz4, level);
+    }
+
+    return nullptr;
+}
+
+}  // namespace SimpleCppLogger
@@ -1,10 +1,36 @@
 #include "SimpleCppLogger/ConsoleAppender.h"
 
 #include <iostream>
+#include <ostream>
+#include <string>
 
 namespace SimpleCppLogger
 {
 
+namespace
+{
+/**
+ * @brief Returns std::cerr for warnings and errors and std::cout for everything else.
+ */
+auto select_stream(LogLevel level) -> std::ostream&
+{
+    switch (level)
+    {
+    case LogLevel::Warning:
+    case LogLevel::Error:
+    case LogLevel::Fatal:
+        return std::cerr;
+    default:
+        return std::cout;
+    }
+}
+
+auto write_text(std::ostream& stream, const std::string& text) -> void
+{
+    stream.write(text.data(), static_cast<std::streamsize>(text.size()));
+}
+}  // namespace
+
 /**
  * @brief Constructs a ConsoleAppender object.
  *
@@ -17,11 +43,20 @@ ConsoleAppender::ConsoleAppender(const std::shared_ptr<LogFormatter>& formatter)
     : LogAppender(formatter)
 {}
 
+/**
+ * @brief Returns true; preformatted text is written unchanged.
+ */
+auto ConsoleAppender::supports_preformatted() const -> bool
+{
+    return true;
+}
+
 /**
  * @brief Appends the specified log message to the console.
  *
  * This method formats the log message using the provided formatter and outputs it to the
- * console using std::cout or std::cerr depending on the log level.
+ * console using std::cout or std::cerr depending on the log level. The streams are not flushed;
+ * std::cerr is unbuffered, and std::cout is flushed by flush() or when its buffer fills up.
  *
  * @param message The log message to append to the console.
  * @param location The source location of the log message.
@@ -29,23 +64,73 @@ ConsoleAppender::ConsoleAppender(const std::shared_ptr<LogFormatter>& formatter)
 auto ConsoleAppender::internal_append(const LogMessage& message,
                                       const std::source_location& location) -> void
 {
-    const std::string formatted_message = m_formatter->format(message, location);
+    internal_append_formatted(message, location, m_formatter->format(message, location));
+}
 
-    switch (message.get_level())
+/**
+ * @brief Outputs already formatted text to the console.
+ *
+ * @param message The log message to append to the console.
+ * @param location The source location of the log message.
+ * @param formatted_message The formatted text.
+ */
+auto ConsoleAppender::internal_append_formatted(const LogMessage& message,
+                                                const std::source_location& /*location*/,
+                                                std::string&& formatted_message) -> void
+{
+    select_stream(message.get_level()) << formatted_message << '\n';
+}
+
+/**
+ * @brief Formats the batch into one buffer per output stream and writes each buffer at once.
+ *
+ * Consecutive records for the same stream share a buffer, so the order of lines is preserved
+ * when std::cout and std::cerr refer to the same terminal.
+ *
+ * @param records The messages to append, with their source locations.
+ */
+auto ConsoleAppender::append_batch(std::span<const StagedRecord> records) -> void
+{
+    std::string buffer;
+    std::ostream* stream = nullptr;
+
+    for (const auto& record: records)
     {
-    case LogLevel::Info:
-    case LogLevel::Debug:
-        std::cout << formatted_message << std::endl;
-        break;
-    case LogLevel::Warning:
-    case LogLevel::Error:
-    case LogLevel::Fatal:
-        std::cerr << formatted_message << std::endl;
-        break;
-    default:
-        std::cout << formatted_message << std::endl;
-        break;
+        if (record.message.get_level() < m_log_level)
+        {
+            continue;
+        }
+
+        std::ostream& target = select_stream(record.message.get_level());
+        if (stream != nullptr && stream != &target)
+        {
+            write_text(*stream, buffer);
+            buffer.clear();
+        }
+
+        stream = &target;
+        buffer += m_formatter->format(record.message, record.location);
+        buffer += '\n';
+    }
+
+    if (stream != nullptr)
+    {
+        write_text(*stream, buffer);
     }
 }
 
+/**
+ * @brief Flushes std::cout and std::cerr.
+ *
+ * The streams cannot be synced to disk, so FlushMode::Durable behaves like FlushMode::Written.
+ *
+ * @param callback Called with true if both streams are still good.
+ */
+auto ConsoleAppender::internal_flush(FlushCallback callback, FlushMode /*mode*/) -> void
+{
+    std::cout.flush();
+    std::cerr.flush();
+    callback(std::cout.good() && std::cerr.good());
+}
+
 }  // namespace SimpleCppLogger
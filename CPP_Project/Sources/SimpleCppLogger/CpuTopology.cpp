@@ -0,0 +1,179 @@
+#include "SimpleCppLogger/CpuTopology.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace SimpleCppLogger
+{
+
+namespace
+{
+/**
+ * @brief Parses a Linux CPU list such as "0-3,8,10-11".
+ */
+auto parse_cpu_list(const std::string& text) -> std::vector<int>
+{
+    std::vector<int> cpus;
+    std::stringstream stream(text);
+    std::string range;
+
+    while (std::getline(stream, range, ','))
+    {
+        char* end = nullptr;
+        const long first = std::strtol(range.c_str(), &end, 10);
+        if (end == range.c_str() || first < 0)
+        {
+            continue;
+        }
+
+        const long last = *end == '-' ? std::strtol(end + 1, nullptr, 10) : first;
+        for (long cpu = first; cpu <= last; ++cpu)
+        {
+            cpus.push_back(static_cast<int>(cpu));
+        }
+    }
+
+    return cpus;
+}
+
+/**
+ * @brief Reads the CPU-to-node table from sysfs, or returns a single-node table.
+ */
+auto load_node_table() -> std::vector<std::size_t>
+{
+    std::vector<std::size_t> node_of_cpu;
+
+#ifdef __linux__
+    // Node numbers may have gaps; nodes are renumbered densely in ascending order.
+    std::size_t dense_node = 0;
+    for (int node = 0, missing = 0; missing < 64; ++node)
+    {
+        std::ifstream file("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+        std::string list;
+
+        if (!file || !std::getline(file, list))
+        {
+            ++missing;
+            continue;
+        }
+
+        missing = 0;
+        const auto cpus = parse_cpu_list(list);
+        if (cpus.empty())
+        {
+            continue;
+        }
+
+        for (const int cpu: cpus)
+        {
+            if (static_cast<std::size_t>(cpu) >= node_of_cpu.size())
+            {
+                node_of_cpu.resize(static_cast<std::size_t>(cpu) + 1, 0);
+            }
+            node_of_cpu[static_cast<std::size_t>(cpu)] = dense_node;
+        }
+        ++dense_node;
+    }
+#endif
+
+    if (node_of_cpu.empty())
+    {
+        node_of_cpu.assign(std::max(std::thread::hardware_concurrency(), 1U), 0);
+    }
+
+    return node_of_cpu;
+}
+}  // namespace
+
+auto CpuTopology::get() -> const CpuTopology&
+{
+    static const CpuTopology topology(load_node_table());
+    return topology;
+}
+
+/**
+ * @brief Builds a topology from an explicit CPU-to-node table.
+ * @param node_of_cpu The node of every CPU, indexed by CPU number.
+ */
+CpuTopology::CpuTopology(std::vector<std::size_t> node_of_cpu)
+    : m_node_of_cpu(std::move(node_of_cpu))
+{
+    if (m_node_of_cpu.empty())
+    {
+        m_node_of_cpu.push_back(0);
+    }
+
+    const std::size_t node_count =
+        *std::max_element(m_node_of_cpu.begin(), m_node_of_cpu.end()) + 1;
+    m_cpus_of_node.resize(node_count);
+
+    for (std::size_t cpu = 0; cpu < m_node_of_cpu.size(); ++cpu)
+    {
+        m_cpus_of_node[m_node_of_cpu[cpu]].push_back(static_cast<int>(cpu));
+    }
+}
+
+auto CpuTopology::get_cpu_count() const -> std::size_t
+{
+    return m_node_of_cpu.size();
+}
+
+auto CpuTopology::get_node_count() const -> std::size_t
+{
+    return m_cpus_of_node.size();
+}
+
+auto CpuTopology::get_node_of_cpu(int cpu) const -> std::size_t
+{
+    return cpu >= 0 && static_cast<std::size_t>(cpu) < m_node_of_cpu.size()
+               ? m_node_of_cpu[static_cast<std::size_t>(cpu)]
+               : 0;
+}
+
+auto CpuTopology::get_cpus_of_node(std::size_t node) const -> std::span<const int>
+{
+    return node < m_cpus_of_node.size() ? std::span<const int>(m_cpus_of_node[node])
+                                        : std::span<const int>();
+}
+
+auto CpuTopology::get_current_cpu() -> int
+{
+#ifdef __linux__
+    return ::sched_getcpu();
+#else
+    return -1;
+#endif
+}
+
+auto CpuTopology::pin_current_thread([[maybe_unused]] std::span<const int> cpus) -> bool
+{
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+
+    for (const int cpu: cpus)
+    {
+        if (cpu >= 0 && cpu < CPU_SETSIZE)
+        {
+            CPU_SET(cpu, &set);
+        }
+    }
+
+    return CPU_COUNT(&set) > 0 &&
+           ::pthread_setaffinity_np(::pthread_self(), sizeof(set), &set) == 0;
+#else
+    return false;
+#endif
+}
+
+}  // namespace SimpleCppLogger
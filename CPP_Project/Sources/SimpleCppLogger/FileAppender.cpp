@@ -0,0 +1,1231 @@
+#include "SimpleCppLogger/FileAppender.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <future>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+
+#ifdef _WIN32
+#include <io.h>
+#include <sys/stat.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace SimpleCppLogger
+{
+
+namespace
+{
+/**
+ * @brief A frame that is this many times larger than frame_size makes logging threads wait.
+ */
+constexpr std::size_t MaxPendingFrames = 4;
+
+/**
+ * @brief Room in each io_uring buffer beyond frame_size, for the line that overfills a frame.
+ */
+constexpr std::size_t SlotSlack = 64 * 1024;
+
+constexpr std::uint64_t SyncTag = UINT64_MAX - 1;
+constexpr std::uint64_t StopTag = UINT64_MAX;
+
+/**
+ * @brief Alignment of staged writes; a multiple of the logical block size O_DIRECT requires.
+ */
+constexpr std::size_t PageSize = 4096;
+
+constexpr std::size_t MinStageSize = 64 * 1024;
+
+auto round_up(std::uint64_t value, std::uint64_t multiple) -> std::uint64_t
+{
+    return (value + multiple - 1) / multiple * multiple;
+}
+
+/**
+ * @brief Opens the file for writing.
+ *
+ * @param positional True if every write passes its offset; the file is then opened for reading
+ * too, and without O_APPEND, which would make Linux ignore the offsets.
+ * @param direct True to try O_DIRECT first; filesystems that reject it get a cached file.
+ */
+auto open_file(const std::string& path, bool append, bool positional, bool direct) -> int
+{
+#ifdef _WIN32
+    (void)positional;
+    (void)direct;
+    const int mode = append ? _O_APPEND : _O_TRUNC;
+    return ::_open(path.c_str(), _O_WRONLY | _O_CREAT | _O_BINARY | _O_NOINHERIT | mode,
+                   _S_IREAD | _S_IWRITE);
+#else
+    const int mode = append ? (positional ? 0 : O_APPEND) : O_TRUNC;
+    const int flags = O_CREAT | O_CLOEXEC | mode | (positional ? O_RDWR : O_WRONLY);
+
+#ifdef __linux__
+    if (direct)
+    {
+        const int fd = ::open(path.c_str(), flags | O_DIRECT, 0644);
+        if (fd >= 0 || errno != EINVAL)
+        {
+            return fd;
+        }
+    }
+#else
+    (void)direct;
+#endif
+
+    return ::open(path.c_str(), flags, 0644);
+#endif
+}
+
+auto is_direct(int fd) -> bool
+{
+#ifdef __linux__
+    return (::fcntl(fd, F_GETFL) & O_DIRECT) != 0;
+#else
+    (void)fd;
+    return false;
+#endif
+}
+
+auto close_file(int fd) -> void
+{
+#ifdef _WIN32
+    ::_close(fd);
+#else
+    ::close(fd);
+#endif
+}
+
+auto file_size(int fd) -> std::uint64_t
+{
+#ifdef _WIN32
+    const long long size = ::_lseeki64(fd, 0, SEEK_END);
+#else
+    const off_t size = ::lseek(fd, 0, SEEK_END);
+#endif
+    return size > 0 ? static_cast<std::uint64_t>(size) : 0;
+}
+
+auto sync_file(int fd) -> bool
+{
+#if defined(_WIN32)
+    return ::_commit(fd) == 0;
+#elif defined(__linux__)
+    return ::fdatasync(fd) == 0;
+#else
+    return ::fsync(fd) == 0;
+#endif
+}
+
+auto write_file(int fd, const char* data, std::size_t size) -> long long
+{
+#ifdef _WIN32
+    return ::_write(fd, data, static_cast<unsigned int>(std::min<std::size_t>(size, 1U << 30)));
+#else
+    return ::write(fd, data, size);
+#endif
+}
+
+auto write_file_at(int fd, const char* data, std::size_t size, std::uint64_t offset) -> long long
+{
+#ifdef _WIN32
+    (void)fd;
+    (void)data;
+    (void)size;
+    (void)offset;
+    errno = ENOSYS;
+    return -1;
+#else
+    return ::pwrite(fd, data, size, static_cast<off_t>(offset));
+#endif
+}
+
+auto read_file_at(int fd, char* data, std::size_t size, std::uint64_t offset) -> long long
+{
+#ifdef _WIN32
+    (void)fd;
+    (void)data;
+    (void)size;
+    (void)offset;
+    errno = ENOSYS;
+    return -1;
+#else
+    return ::pread(fd, data, size, static_cast<off_t>(offset));
+#endif
+}
+
+/**
+ * @brief Allocates extents for the range without changing the file size.
+ * @return False if the filesystem or platform does not support it.
+ */
+auto preallocate_file(int fd, std::uint64_t offset, std::uint64_t size) -> bool
+{
+#ifdef __linux__
+    return ::fallocate(fd, FALLOC_FL_KEEP_SIZE, static_cast<off_t>(offset),
+                       static_cast<off_t>(size)) == 0;
+#else
+    (void)fd;
+    (void)offset;
+    (void)size;
+    return false;
+#endif
+}
+
+auto truncate_file(int fd, std::uint64_t size) -> void
+{
+#ifdef _WIN32
+    ::_chsize_s(fd, static_cast<long long>(size));
+#else
+    static_cast<void>(::ftruncate(fd, static_cast<off_t>(size)));
+#endif
+}
+}  // namespace
+
+/**
+ * @brief Opens the file and starts the writer thread.
+ *
+ * @param path The file to write to.
+ * @param options The frame and compression configuration.
+ * @param formatter The LogFormatter to use; defaults to a SimpleFormatter without colors.
+ */
+FileAppender::FileAppender(const std::string& path, const FileAppenderOptions& options,
+                           const std::shared_ptr<LogFormatter>& formatter)
+    : LogAppender(formatter), m_path(path), m_options(options)
+{
+    m_options.frame_size = std::max<std::size_t>(m_options.frame_size, 1);
+#ifdef __linux__
+    const bool staged = m_options.preallocate_size > 0 || m_options.direct_io;
+#else
+    const bool staged = false;
+#endif
+    const bool ring = m_options.io_uring && !m_options.direct_io && start_io_uring();
+    m_fd = open_file(m_path, m_options.append, ring || staged, staged && m_options.direct_io);
+
+    if (m_fd >= 0)
+    {
+        m_file_offset = file_size(m_fd);
+        m_allocated_end = m_file_offset;
+        m_direct_io = is_direct(m_fd);
+
+        if (staged && !ring && !start_staging())
+        {
+            close_file(m_fd);
+            m_fd = -1;
+        }
+    }
+
+    if (m_fd >= 0)
+    {
+        if (m_options.write_index)
+        {
+            m_options.index_block_records = std::max<std::size_t>(m_options.index_block_records, 1);
+            m_index = std::make_unique<LogIndexWriter>(
+                get_index_path(m_path), m_options.append, m_options.index_bloom_bytes,
+                m_options.codec ? m_options.codec->get_name() : std::string_view{});
+        }
+
+        m_writer = std::thread([this] { run(); });
+    }
+}
+
+/**
+ * @brief Writes all buffered lines, stops the writer thread, trims O_DIRECT padding and
+ * preallocated space and closes the file.
+ */
+FileAppender::~FileAppender()
+{
+    if (m_writer.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stopping = true;
+        }
+
+        m_wake.notify_one();
+        m_writer.join();
+    }
+
+    if (m_reaper.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_ring_mutex);
+            static_cast<void>(m_ring->prepare_nop(StopTag) && m_ring->submit());
+        }
+
+        m_reaper.join();
+    }
+
+    if (m_fd >= 0)
+    {
+        // ftruncate also releases extents reserved with FALLOC_FL_KEEP_SIZE past the end.
+        if (m_trim_on_close || m_allocated_end > m_file_offset)
+        {
+            truncate_file(m_fd, m_file_offset);
+        }
+
+        close_file(m_fd);
+    }
+}
+
+auto FileAppender::is_open() const -> bool
+{
+    return m_fd >= 0;
+}
+
+auto FileAppender::get_path() const -> const std::string&
+{
+    return m_path;
+}
+
+auto FileAppender::is_index_open() const -> bool
+{
+    return m_index && m_index->is_open();
+}
+
+auto FileAppender::get_input_bytes() const -> std::uint64_t
+{
+    return m_input_bytes.load(std::memory_order_relaxed);
+}
+
+auto FileAppender::get_written_bytes() const -> std::uint64_t
+{
+    return m_written_bytes.load(std::memory_order_relaxed);
+}
+
+auto FileAppender::get_frame_count() const -> std::uint64_t
+{
+    return m_frame_count.load(std::memory_order_relaxed);
+}
+
+auto FileAppender::is_io_uring_active() const -> bool
+{
+    return is_open() && m_ring;
+}
+
+auto FileAppender::get_sync_count() const -> std::uint64_t
+{
+    return m_sync_count.load(std::memory_order_relaxed);
+}
+
+auto FileAppender::supports_preformatted() const -> bool
+{
+    return true;
+}
+
+auto FileAppender::append_batch(std::span<const StagedRecord> records) -> void
+{
+    if (!is_open())
+    {
+        return;
+    }
+
+    std::vector<std::pair<std::string, const LogMessage*>> lines;
+    lines.reserve(records.size());
+
+    for (const auto& record: records)
+    {
+        if (record.message.get_level() >= m_log_level)
+        {
+            lines.emplace_back(format(record.message, record.location), &record.message);
+        }
+    }
+
+    bool notify = false;
+    bool durable = false;
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    for (const auto& [text, message]: lines)
+    {
+        notify = add_line(lock, text, *message) || notify;
+        durable = durable || message->get_level() >= m_options.durable_level;
+    }
+
+    if (durable)
+    {
+        wait_until_durable(lock);
+        return;
+    }
+
+    lock.unlock();
+
+    if (notify)
+    {
+        m_wake.notify_one();
+    }
+}
+
+auto FileAppender::internal_append(const LogMessage& message,
+                                   const std::source_location& location) -> void
+{
+    internal_append_formatted(message, location, format(message, location));
+}
+
+auto FileAppender::internal_append_formatted(const LogMessage& message,
+                                             const std::source_location& /*location*/,
+                                             std::string&& formatted) -> void
+{
+    if (!is_open())
+    {
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    const bool notify = add_line(lock, formatted, message);
+
+    if (message.get_level() >= m_options.durable_level)
+    {
+        wait_until_durable(lock);
+        return;
+    }
+
+    lock.unlock();
+
+    if (notify)
+    {
+        m_wake.notify_one();
+    }
+}
+
+/**
+ * @brief Queues a flush request for the writer thread.
+ *
+ * @param callback Called with false if a frame could not be written or synced.
+ * @param mode Whether the file has to be synced as well.
+ */
+auto FileAppender::internal_flush(FlushCallback callback, FlushMode mode) -> void
+{
+    if (!is_open())
+    {
+        callback(false);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        add_flush_request(std::move(callback), mode);
+    }
+
+    m_wake.notify_one();
+}
+
+/**
+ * @brief Completes the pending frame and queues a request that the writer thread completes once
+ * the frame is written or synced. The caller must hold the lock and wake the writer.
+ */
+auto FileAppender::add_flush_request(FlushCallback callback, FlushMode mode) -> void
+{
+    if (!m_pending.text.empty())
+    {
+        complete_frame();
+    }
+
+    m_flush_requests.push_back(FlushRequest{m_completed_frames, m_write_errors, m_sync_errors,
+                                            mode, std::move(callback)});
+    m_writer_signaled = true;
+}
+
+/**
+ * @brief Blocks the logging thread until the records it just added are synced, or at the end of
+ * its DurableWaitScope. Called with the lock held; releases it.
+ */
+auto FileAppender::wait_until_durable(std::unique_lock<std::mutex>& lock) -> void
+{
+    auto durable = std::make_shared<std::promise<bool>>();
+    std::future<bool> result = durable->get_future();
+    add_flush_request([durable](bool success) { durable->set_value(success); },
+                      FlushMode::Durable);
+
+    lock.unlock();
+    m_wake.notify_one();
+    DurableWaitScope::wait_for_durable(std::move(result));
+}
+
+/**
+ * @brief Appends a line to the pending frame and completes the frame if it is full or the
+ * record's level demands it. The caller must hold the lock.
+ *
+ * @return True if the writer thread has to be woken, either to start the flush timer or to take
+ * a completed frame.
+ */
+auto FileAppender::add_line(std::unique_lock<std::mutex>& lock, std::string_view text,
+                            const LogMessage& message) -> bool
+{
+    const std::size_t limit = m_options.frame_size * MaxPendingFrames;
+    if (m_completed_bytes >= limit)
+    {
+        m_wake.notify_one();
+        m_space.wait(lock, [this, limit] { return m_completed_bytes < limit; });
+    }
+
+    const bool was_empty = m_pending.text.empty();
+    if (was_empty)
+    {
+        m_pending_since = std::chrono::steady_clock::now();
+    }
+
+    m_pending.text.append(text);
+    m_pending.text += '\n';
+
+    const LogLevel level = message.get_level();
+    bool block_full = false;
+
+    if (m_index)
+    {
+        const std::int64_t timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                           message.get_timestamp().time_since_epoch())
+                                           .count();
+        FrameStats& stats = m_pending.stats;
+
+        stats.first_timestamp =
+            stats.record_count == 0 ? timestamp : std::min(stats.first_timestamp, timestamp);
+        stats.last_timestamp =
+            stats.record_count == 0 ? timestamp : std::max(stats.last_timestamp, timestamp);
+        stats.level_mask |= std::uint32_t{1} << (static_cast<std::uint32_t>(level) % 32);
+        block_full = ++stats.record_count >= m_options.index_block_records;
+    }
+
+    if (block_full || m_pending.text.size() >= m_options.frame_size ||
+        level >= m_options.flush_level)
+    {
+        complete_frame();
+        return true;
+    }
+
+    return was_empty;
+}
+
+/**
+ * @brief Moves the pending frame to the queue of the writer thread. The caller must hold the
+ * lock.
+ */
+auto FileAppender::complete_frame() -> void
+{
+    m_completed_bytes += m_pending.text.size();
+    m_completed.push_back(std::exchange(m_pending, Frame{}));
+    ++m_completed_frames;
+}
+
+/**
+ * @brief Writer loop: waits for completed frames, or completes the pending frame once its oldest
+ * line has waited for flush_interval, and writes the frames outside the lock. Then syncs the
+ * file if a sync is wanted and due, and completes the flush requests that are satisfied.
+ *
+ * With io_uring the frames are only submitted here; the reaper thread retires them.
+ */
+auto FileAppender::run() -> void
+{
+    std::deque<Frame> frames;
+    std::string compressed;
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    for (;;)
+    {
+        wait_for_work(lock);
+
+        if (!m_pending.text.empty() &&
+            (m_stopping ||
+             std::chrono::steady_clock::now() >= m_pending_since + m_options.flush_interval))
+        {
+            complete_frame();
+        }
+
+        if (!m_completed.empty())
+        {
+            frames.swap(m_completed);
+            m_completed_bytes = 0;
+            lock.unlock();
+            m_space.notify_all();
+
+            if (m_ring)
+            {
+                for (const auto& frame: frames)
+                {
+                    submit_frame(frame, compressed);
+                }
+
+                lock.lock();
+            }
+            else
+            {
+                std::uint64_t failed = 0;
+                for (const auto& frame: frames)
+                {
+                    failed += write_frame(frame, compressed) ? 0 : 1;
+                }
+
+                if (!m_stage.empty() && !write_stage())
+                {
+                    ++failed;
+                }
+
+                lock.lock();
+                m_submitted_frames += frames.size();
+                m_written_frames += frames.size();
+                m_write_errors += failed;
+            }
+
+            frames.clear();
+        }
+
+        if (is_sync_wanted() &&
+            (m_stopping || std::chrono::steady_clock::now() >= m_next_sync))
+        {
+            sync(lock);
+        }
+
+        complete_flush_requests(lock);
+
+        if (m_stopping && m_pending.text.empty() && m_completed.empty() &&
+            m_flush_requests.empty() && !is_io_in_flight())
+        {
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Waits until there is something to do: stopping, a completed frame, a new flush request,
+ * completed io_uring operations, the pending frame's flush_interval or the next due sync. While
+ * stopping, it still waits for the operations in flight. The caller must hold the lock.
+ */
+auto FileAppender::wait_for_work(std::unique_lock<std::mutex>& lock) -> void
+{
+    using Clock = std::chrono::steady_clock;
+
+    while (!(m_stopping && !is_io_in_flight()) && m_completed.empty() && !m_writer_signaled)
+    {
+        Clock::time_point deadline = Clock::time_point::max();
+
+        if (!m_pending.text.empty())
+        {
+            deadline = m_pending_since + m_options.flush_interval;
+        }
+
+        if (is_sync_wanted())
+        {
+            deadline = std::min(deadline, m_next_sync);
+        }
+
+        if (deadline == Clock::time_point::max())
+        {
+            m_wake.wait(lock);
+        }
+        else if (m_wake.wait_until(lock, deadline) == std::cv_status::timeout)
+        {
+            break;
+        }
+    }
+
+    m_writer_signaled = false;
+}
+
+/**
+ * @brief Returns whether io_uring writes or a sync have not completed yet. The caller must hold
+ * the lock.
+ */
+auto FileAppender::is_io_in_flight() const -> bool
+{
+    return m_submitted_frames != m_written_frames || m_sync_in_flight;
+}
+
+/**
+ * @brief Returns whether written frames are waiting for a sync: always with a sync_interval,
+ * otherwise only if a durable flush request waits for them. Frames submitted to io_uring count as
+ * written, since the sync runs after them; only one sync is in flight at a time. The caller must
+ * hold the lock.
+ */
+auto FileAppender::is_sync_wanted() const -> bool
+{
+    if (m_sync_in_flight || m_synced_frames == m_submitted_frames)
+    {
+        return false;
+    }
+
+    return m_options.sync_interval.count() > 0 ||
+           std::any_of(m_flush_requests.begin(), m_flush_requests.end(),
+                       [this](const FlushRequest& request) {
+                           return request.mode == FlushMode::Durable &&
+                                  request.frame <= m_submitted_frames;
+                       });
+}
+
+/**
+ * @brief Syncs every frame written so far with a single call and schedules the next sync no
+ * earlier than sync_interval later. Called with the lock held; releases it while syncing.
+ *
+ * With io_uring the sync is only submitted, and the reaper thread completes it.
+ */
+auto FileAppender::sync(std::unique_lock<std::mutex>& lock) -> void
+{
+    if (m_ring)
+    {
+        m_sync_target = m_submitted_frames;
+        m_sync_in_flight = true;
+        m_next_sync = std::chrono::steady_clock::now() + m_options.sync_interval;
+        lock.unlock();
+
+        bool submitted = false;
+        {
+            std::lock_guard<std::mutex> ring_lock(m_ring_mutex);
+            submitted = m_ring->prepare_sync(m_fd, SyncTag) && m_ring->submit();
+        }
+
+        if (!submitted)
+        {
+            finish_sync(-EIO);
+        }
+
+        lock.lock();
+        return;
+    }
+
+    // Only the writer thread writes frames, so this count stays valid while unlocked.
+    const std::uint64_t frames = m_written_frames;
+    const auto started = std::chrono::steady_clock::now();
+
+    lock.unlock();
+    const bool synced = sync_file(m_fd);
+    m_sync_count.fetch_add(1, std::memory_order_relaxed);
+    lock.lock();
+
+    m_synced_frames = frames;
+    m_sync_errors += synced ? 0 : 1;
+    m_next_sync = started + m_options.sync_interval;
+}
+
+/**
+ * @brief Calls the callbacks of the flush requests whose frames have all been written, or synced
+ * for FlushMode::Durable. Called with the lock held; releases it while calling back.
+ */
+auto FileAppender::complete_flush_requests(std::unique_lock<std::mutex>& lock) -> void
+{
+    std::vector<FlushRequest> ready;
+
+    for (auto it = m_flush_requests.begin(); it != m_flush_requests.end();)
+    {
+        const std::uint64_t done =
+            it->mode == FlushMode::Durable ? m_synced_frames : m_written_frames;
+
+        if (it->frame <= done)
+        {
+            ready.push_back(std::move(*it));
+            it = m_flush_requests.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    if (ready.empty())
+    {
+        return;
+    }
+
+    const std::uint64_t write_errors = m_write_errors;
+    const std::uint64_t sync_errors = m_sync_errors;
+    lock.unlock();
+
+    for (auto& request: ready)
+    {
+        request.callback(request.write_errors == write_errors &&
+                         (request.mode != FlushMode::Durable ||
+                          request.sync_errors == sync_errors));
+    }
+
+    lock.lock();
+}
+
+/**
+ * @brief Compresses the frame if a codec is configured and writes it to the file.
+ *
+ * A frame that cannot be compressed is discarded rather than written as plain text, which would
+ * corrupt the compressed stream. Once the frame is written, its index entry is appended; a
+ * staged frame's entry waits in m_staged_blocks until write_stage() has written the frame.
+ *
+ * @return True if the frame was written completely or staged.
+ */
+auto FileAppender::write_frame(const Frame& frame, std::string& compressed) -> bool
+{
+    std::string_view data = frame.text;
+
+    if (m_options.codec)
+    {
+        compressed.clear();
+        if (!m_options.codec->compress(frame.text, compressed))
+        {
+            return false;
+        }
+        data = compressed;
+    }
+
+    if (m_stage.empty() && !write_all(data))
+    {
+        // A partial write may have moved the end of the file.
+        m_file_offset = file_size(m_fd);
+        return false;
+    }
+
+    // A staged frame keeps its place even if writing a full stage fails.
+    const std::uint64_t offset = m_file_offset;
+    m_file_offset += data.size();
+
+    if (!m_stage.empty() && !stage(data))
+    {
+        return false;
+    }
+
+    if (m_index && m_stage.empty())
+    {
+        m_index->write(make_index_block(frame, offset, data.size()));
+    }
+    else if (m_index)
+    {
+        m_staged_blocks.push_back(make_index_block(frame, offset, data.size()));
+    }
+
+    m_input_bytes.fetch_add(frame.text.size(), std::memory_order_relaxed);
+    m_written_bytes.fetch_add(data.size(), std::memory_order_relaxed);
+    m_frame_count.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+/**
+ * @brief Writes the data completely, retrying after partial writes and interruptions.
+ * @return True if all bytes were written.
+ */
+auto FileAppender::write_all(std::string_view data) -> bool
+{
+    while (!data.empty())
+    {
+        const long long written = write_file(m_fd, data.data(), data.size());
+
+        if (written < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return false;
+        }
+
+        data.remove_prefix(static_cast<std::size_t>(written));
+    }
+
+    return true;
+}
+
+/**
+ * @brief Builds the index entry of a frame stored at the given offset.
+ */
+auto FileAppender::make_index_block(const Frame& frame, std::uint64_t offset,
+                                    std::size_t stored_size) const -> LogIndexBlock
+{
+    LogIndexBlock block;
+    block.file_offset = offset;
+    block.stored_size = stored_size;
+    block.text_size = frame.text.size();
+    block.first_timestamp = frame.stats.first_timestamp;
+    block.last_timestamp = frame.stats.last_timestamp;
+    block.record_count = frame.stats.record_count;
+    block.level_mask = frame.stats.level_mask;
+    block.bloom.resize(m_index->get_bloom_words());
+    block.add_tokens(frame.text);
+    return block;
+}
+
+/**
+ * @brief Creates the ring, its buffers and the reaper thread.
+ *
+ * The buffers are registered with the kernel if the memlock limit allows it; otherwise writes
+ * are submitted from the same buffers without registration.
+ *
+ * @return False if io_uring is not available, in which case the appender uses write(2).
+ */
+auto FileAppender::start_io_uring() -> bool
+{
+    const std::size_t depth = std::max<std::size_t>(m_options.io_uring_depth, 1);
+    auto ring = std::make_unique<IoUring>(static_cast<unsigned>(depth + 2));
+    if (!ring->is_open())
+    {
+        return false;
+    }
+
+    const std::size_t capacity = m_options.frame_size + SlotSlack;
+    m_slot_memory = std::make_unique_for_overwrite<char[]>(capacity * depth);
+    m_slots.resize(depth);
+
+    std::vector<std::span<char>> buffers;
+    buffers.reserve(depth);
+
+    for (std::size_t i = 0; i < depth; ++i)
+    {
+        m_slots[i].buffer = std::span<char>(m_slot_memory.get() + i * capacity, capacity);
+        buffers.push_back(m_slots[i].buffer);
+    }
+
+    m_buffers_registered = ring->register_buffers(buffers);
+    m_ring = std::move(ring);
+    m_reaper = std::thread([this] { run_reaper(); });
+    return true;
+}
+
+/**
+ * @brief Compresses the frame if a codec is configured, copies it into the next free slot and
+ * submits a write at the end of the file. Waits while io_uring_depth frames are in flight.
+ *
+ * A frame that cannot be compressed still takes its slot, with a no-op in place of the write, so
+ * that frames are retired in order.
+ */
+auto FileAppender::submit_frame(const Frame& frame, std::string& compressed) -> void
+{
+    std::string_view data = frame.text;
+    bool failed = false;
+
+    if (m_options.codec)
+    {
+        compressed.clear();
+        failed = !m_options.codec->compress(frame.text, compressed);
+        data = failed ? std::string_view{} : std::string_view{compressed};
+    }
+
+    std::uint64_t sequence = 0;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_wake.wait(lock,
+                    [this] { return m_submitted_frames - m_written_frames < m_slots.size(); });
+        sequence = m_submitted_frames++;
+    }
+
+    // Only this thread submits writes, so it alone advances the offset.
+    const std::uint64_t offset = m_file_offset;
+    m_file_offset += data.size();
+    reserve(m_file_offset);
+
+    LogIndexBlock block;
+    if (m_index && !failed)
+    {
+        block = make_index_block(frame, offset, data.size());
+    }
+
+    const std::size_t index = sequence % m_slots.size();
+    bool submitted = false;
+    {
+        std::lock_guard<std::mutex> ring_lock(m_ring_mutex);
+        WriteSlot& slot = m_slots[index];
+        const bool fits = data.size() <= slot.buffer.size();
+
+        if (fits)
+        {
+            std::copy(data.begin(), data.end(), slot.buffer.begin());
+            slot.data = slot.buffer.first(data.size());
+        }
+        else
+        {
+            slot.overflow.assign(data);
+            slot.data = slot.overflow;
+        }
+
+        slot.offset = offset;
+        slot.written = 0;
+        slot.text_size = frame.text.size();
+        slot.block = std::move(block);
+        slot.failed = failed;
+        slot.completed = false;
+
+        const int fixed = fits && m_buffers_registered ? static_cast<int>(index) : -1;
+        submitted = (failed ? m_ring->prepare_nop(sequence)
+                            : m_ring->prepare_write(m_fd, slot.data, offset, sequence, fixed)) &&
+                    m_ring->submit();
+    }
+
+    if (!submitted)
+    {
+        finish_write(sequence, -EIO);
+    }
+}
+
+/**
+ * @brief Handles the completion of a frame's write: resubmits the rest after a short write,
+ * otherwise retires the frame and every completed frame after it in submission order, writing
+ * their index entries. Then completes the flush requests that are satisfied.
+ *
+ * @param sequence The frame's submission number.
+ * @param result The bytes written, or -errno.
+ */
+auto FileAppender::finish_write(std::uint64_t sequence, int result) -> void
+{
+    std::uint64_t retired = 0;
+    std::uint64_t failed = 0;
+    {
+        std::lock_guard<std::mutex> ring_lock(m_ring_mutex);
+        const std::size_t index = sequence % m_slots.size();
+        WriteSlot& slot = m_slots[index];
+
+        if (result < 0 || (result == 0 && slot.written < slot.data.size()))
+        {
+            slot.failed = true;
+        }
+        else
+        {
+            slot.written += static_cast<std::size_t>(result);
+
+            if (!slot.failed && slot.written < slot.data.size())
+            {
+                const auto rest = slot.data.subspan(slot.written);
+                const bool fixed = m_buffers_registered && slot.data.data() == slot.buffer.data();
+
+                if (m_ring->prepare_write(m_fd, rest, slot.offset + slot.written, sequence,
+                                          fixed ? static_cast<int>(index) : -1) &&
+                    m_ring->submit())
+                {
+                    return;
+                }
+
+                slot.failed = true;
+            }
+        }
+
+        slot.completed = true;
+
+        for (;;)
+        {
+            WriteSlot& next = m_slots[m_retired_frames % m_slots.size()];
+            if (!next.completed)
+            {
+                break;
+            }
+
+            next.completed = false;
+            ++m_retired_frames;
+            ++retired;
+
+            if (next.failed)
+            {
+                ++failed;
+                continue;
+            }
+
+            if (m_index)
+            {
+                m_index->write(next.block);
+            }
+
+            m_input_bytes.fetch_add(next.text_size, std::memory_order_relaxed);
+            m_written_bytes.fetch_add(next.data.size(), std::memory_order_relaxed);
+            m_frame_count.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    if (retired == 0)
+    {
+        return;
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_written_frames += retired;
+        m_write_errors += failed;
+        m_writer_signaled = true;
+        complete_flush_requests(lock);
+    }
+
+    m_wake.notify_one();
+}
+
+/**
+ * @brief Handles the completion of a sync. It ran after every write submitted before it, so it
+ * covers the frames retired by then, up to those submitted before it.
+ *
+ * @param result 0, or -errno.
+ */
+auto FileAppender::finish_sync(int result) -> void
+{
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_synced_frames = std::min(m_sync_target, m_written_frames);
+        m_sync_errors += result < 0 ? 1 : 0;
+        m_sync_in_flight = false;
+        m_writer_signaled = true;
+        m_sync_count.fetch_add(1, std::memory_order_relaxed);
+        complete_flush_requests(lock);
+    }
+
+    m_wake.notify_one();
+}
+
+/**
+ * @brief Reaper loop: waits for io_uring completions until the destructor submits StopTag.
+ */
+auto FileAppender::run_reaper() -> void
+{
+    IoUringCompletion completion;
+
+    while (m_ring->wait(completion) && completion.user_data != StopTag)
+    {
+        if (completion.user_data == SyncTag)
+        {
+            finish_sync(completion.result);
+        }
+        else
+        {
+            finish_write(completion.user_data, completion.result);
+        }
+    }
+}
+
+/**
+ * @brief Allocates the page-aligned staging buffer and stages the file's last partial page, so
+ * that the first write starts at its page boundary.
+ *
+ * @return False if the partial page could not be read.
+ */
+auto FileAppender::start_staging() -> bool
+{
+    const std::size_t capacity = round_up(std::max(m_options.frame_size, MinStageSize), PageSize);
+    m_stage_memory = std::make_unique_for_overwrite<char[]>(capacity + PageSize);
+
+    const auto address = reinterpret_cast<std::uintptr_t>(m_stage_memory.get());
+    m_stage = std::span<char>(m_stage_memory.get() + (PageSize - address % PageSize) % PageSize,
+                              capacity);
+    m_stage_offset = m_file_offset / PageSize * PageSize;
+    m_stage_size = m_stage_written = static_cast<std::size_t>(m_file_offset - m_stage_offset);
+
+    if (m_stage_size == 0)
+    {
+        return true;
+    }
+
+    long long read = 0;
+    do
+    {
+        read = read_file_at(m_fd, m_stage.data(), PageSize, m_stage_offset);
+    } while (read < 0 && errno == EINTR);
+
+    return read >= static_cast<long long>(m_stage_size);
+}
+
+/**
+ * @brief Appends data to the stage and writes the stage whenever it is full.
+ * @return False if writing a full stage failed.
+ */
+auto FileAppender::stage(std::string_view data) -> bool
+{
+    bool written = true;
+
+    while (!data.empty())
+    {
+        const std::size_t count = std::min(data.size(), m_stage.size() - m_stage_size);
+        std::copy_n(data.begin(), count, m_stage.data() + m_stage_size);
+        m_stage_size += count;
+        data.remove_prefix(count);
+
+        if (m_stage_size == m_stage.size())
+        {
+            written = write_stage() && written;
+        }
+    }
+
+    return written;
+}
+
+/**
+ * @brief Writes the staged bytes that are not in the file yet, from the start of their page, and
+ * keeps the last partial page staged so that the next write starts page-aligned again. With
+ * O_DIRECT the partial page is padded with zeros.
+ *
+ * The index entries of the staged frames are written only once their data is; if the write
+ * fails, they are dropped so that the index never points at missing data.
+ *
+ * @return True if the bytes were written.
+ */
+auto FileAppender::write_stage() -> bool
+{
+    if (m_stage_size == m_stage_written)
+    {
+        return true;
+    }
+
+    const std::size_t start = m_stage_written / PageSize * PageSize;
+    const std::size_t end = m_direct_io ? round_up(m_stage_size, PageSize) : m_stage_size;
+    std::fill(m_stage.begin() + static_cast<std::ptrdiff_t>(m_stage_size),
+              m_stage.begin() + static_cast<std::ptrdiff_t>(end), '\0');
+
+    const bool written = write_at(m_stage.data() + start, end - start, m_stage_offset + start);
+    m_trim_on_close = m_trim_on_close || end > m_stage_size;
+
+    if (written)
+    {
+        for (const auto& block: m_staged_blocks)
+        {
+            m_index->write(block);
+        }
+    }
+    m_staged_blocks.clear();
+
+    const std::size_t full = m_stage_size / PageSize * PageSize;
+    std::copy(m_stage.begin() + static_cast<std::ptrdiff_t>(full),
+              m_stage.begin() + static_cast<std::ptrdiff_t>(m_stage_size), m_stage.begin());
+    m_stage_offset += full;
+    m_stage_size -= full;
+    m_stage_written = m_stage_size;
+    return written;
+}
+
+/**
+ * @brief Writes the data completely at the offset, reserving extents first.
+ * @return True if all bytes were written.
+ */
+auto FileAppender::write_at(const char* data, std::size_t size, std::uint64_t offset) -> bool
+{
+    reserve(offset + size);
+
+    while (size > 0)
+    {
+        const long long written = write_file_at(m_fd, data, size, offset);
+
+        if (written < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return false;
+        }
+
+        data += written;
+        size -= static_cast<std::size_t>(written);
+        offset += static_cast<std::uint64_t>(written);
+    }
+
+    return true;
+}
+
+/**
+ * @brief Extends the preallocated extents in steps of preallocate_size until they reach end.
+ * Stops preallocating if the filesystem does not support it.
+ */
+auto FileAppender::reserve(std::uint64_t end) -> void
+{
+    if (m_options.preallocate_size == 0 || end <= m_allocated_end)
+    {
+        return;
+    }
+
+    const std::uint64_t size = round_up(end - m_allocated_end, m_options.preallocate_size);
+
+    if (preallocate_file(m_fd, m_allocated_end, size))
+    {
+        m_allocated_end += size;
+    }
+    else
+    {
+        m_options.preallocate_size = 0;
+    }
+}
+
+}  // namespace SimpleCppLogger
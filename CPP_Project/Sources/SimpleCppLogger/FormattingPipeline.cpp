@@ -0,0 +1,191 @@
+#include "SimpleCppLogger/FormattingPipeline.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace SimpleCppLogger
+{
+
+/**
+ * @brief Starts the worker threads and the writer thread.
+ *
+ * @param worker_count The number of formatting threads (at least one).
+ * @param max_pending_tasks The number of submitted but unwritten tasks at which submit()
+ * blocks.
+ * @param writer The function that emits formatted tasks.
+ */
+FormattingPipeline::FormattingPipeline(std::size_t worker_count, std::size_t max_pending_tasks,
+                                       Writer writer)
+    : m_writer(std::move(writer)), m_max_pending(std::max<std::size_t>(max_pending_tasks, 1))
+{
+    worker_count = std::max<std::size_t>(worker_count, 1);
+    m_workers.reserve(worker_count);
+
+    for (std::size_t i = 0; i < worker_count; ++i)
+    {
+        m_workers.emplace_back([this] { run_worker(); });
+    }
+
+    m_writer_thread = std::thread([this] { run_writer(); });
+}
+
+/**
+ * @brief Writes all submitted tasks and joins the threads.
+ */
+FormattingPipeline::~FormattingPipeline()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+
+    m_work_cv.notify_all();
+    m_written_cv.notify_all();
+
+    for (auto& worker: m_workers)
+    {
+        worker.join();
+    }
+
+    m_writer_thread.join();
+}
+
+/**
+ * @brief Queues a task for formatting, blocking while too many tasks are pending.
+ * @param task The task to format and write.
+ */
+auto FormattingPipeline::submit(FormattingTask&& task) -> void
+{
+    auto queued = std::make_unique<FormattingTask>(std::move(task));
+
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_state_cv.wait(lock, [this] { return m_next_sequence - m_next_to_write < m_max_pending; });
+
+        queued->sequence = m_next_sequence++;
+        m_queue.push_back(std::move(queued));
+    }
+
+    m_work_cv.notify_one();
+}
+
+/**
+ * @brief Blocks until every task submitted so far has been written.
+ */
+auto FormattingPipeline::wait_idle() -> void
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    const std::uint64_t target = m_next_sequence;
+    m_state_cv.wait(lock, [this, target] { return m_next_to_write >= target; });
+}
+
+/**
+ * @brief Returns the number of formatting threads.
+ * @return The worker count.
+ */
+auto FormattingPipeline::get_worker_count() const -> std::size_t
+{
+    return m_workers.size();
+}
+
+/**
+ * @brief Fills task.formatted for all appenders that support preformatted output.
+ * @param task The task to format.
+ */
+auto FormattingPipeline::format_task(FormattingTask& task) -> void
+{
+    task.formatted.resize(task.appenders.size());
+
+    for (std::size_t appender = 0; appender < task.appenders.size(); ++appender)
+    {
+        const auto& target = task.appenders[appender];
+
+        if (!target || !target->supports_preformatted())
+        {
+            continue;
+        }
+
+        auto& texts = task.formatted[appender];
+        texts.resize(task.records.size());
+
+        for (std::size_t record = 0; record < task.records.size(); ++record)
+        {
+            const StagedRecord& staged = task.records[record];
+
+            if (staged.message.get_level() >= task.levels[appender])
+            {
+                texts[record] = target->format(staged.message, staged.location);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Worker loop: formats queued tasks until the pipeline stops and the queue is empty.
+ */
+auto FormattingPipeline::run_worker() -> void
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    for (;;)
+    {
+        m_work_cv.wait(lock, [this] { return !m_queue.empty() || m_stopping; });
+
+        if (m_queue.empty())
+        {
+            return;
+        }
+
+        std::unique_ptr<FormattingTask> task = std::move(m_queue.front());
+        m_queue.pop_front();
+
+        lock.unlock();
+        format_task(*task);
+        lock.lock();
+
+        const std::uint64_t sequence = task->sequence;
+        m_finished.emplace(sequence, std::move(task));
+
+        if (sequence == m_next_to_write)
+        {
+            m_written_cv.notify_one();
+        }
+    }
+}
+
+/**
+ * @brief Writer loop: emits finished tasks in sequence order until all tasks are written.
+ */
+auto FormattingPipeline::run_writer() -> void
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    for (;;)
+    {
+        m_written_cv.wait(lock, [this] {
+            return m_finished.contains(m_next_to_write) ||
+                   (m_stopping && m_next_to_write == m_next_sequence);
+        });
+
+        auto it = m_finished.find(m_next_to_write);
+        if (it == m_finished.end())
+        {
+            return;
+        }
+
+        std::unique_ptr<FormattingTask> task = std::move(it->second);
+        m_finished.erase(it);
+
+        lock.unlock();
+        if (m_writer)
+        {
+            m_writer(*task);
+        }
+        lock.lock();
+
+        ++m_next_to_write;
+        m_state_cv.notify_all();
+    }
+}
+
+}  // namespace SimpleCppLogger
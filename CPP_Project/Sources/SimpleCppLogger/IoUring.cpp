@@ -0,0 +1,377 @@
+#include "SimpleCppLogger/IoUring.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <vector>
+
+#ifdef __linux__
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+namespace SimpleCppLogger
+{
+
+#ifdef __linux__
+
+namespace
+{
+auto load_acquire(const unsigned* value) -> unsigned
+{
+    return std::atomic_ref<const unsigned>(*value).load(std::memory_order_acquire);
+}
+
+auto store_release(unsigned* value, unsigned new_value) -> void
+{
+    std::atomic_ref<unsigned>(*value).store(new_value, std::memory_order_release);
+}
+}  // namespace
+
+/**
+ * @class IoUring::Impl
+ * @brief The ring file descriptor and the mapped submission and completion queues.
+ */
+class IoUring::Impl
+{
+    public:
+        explicit Impl(unsigned entries)
+        {
+            io_uring_params params{};
+            m_fd = static_cast<int>(::syscall(__NR_io_uring_setup, std::max(entries, 1U),
+                                              &params));
+            if (m_fd < 0)
+            {
+                return;
+            }
+
+            // IORING_OP_WRITE needs Linux 5.6, which is also the first with RW_CUR_POS.
+            if ((params.features & IORING_FEAT_RW_CUR_POS) == 0 || !map(params))
+            {
+                close();
+            }
+        }
+
+        ~Impl()
+        {
+            close();
+        }
+
+        Impl(const Impl&) = delete;
+        auto operator=(const Impl&) -> Impl& = delete;
+
+        [[nodiscard]] auto is_open() const -> bool
+        {
+            return m_fd >= 0;
+        }
+
+        auto register_buffers(std::span<const std::span<char>> buffers) -> bool
+        {
+            std::vector<iovec> vectors;
+            vectors.reserve(buffers.size());
+            for (const auto& buffer: buffers)
+            {
+                vectors.push_back(iovec{buffer.data(), buffer.size()});
+            }
+
+            return is_open() && ::syscall(__NR_io_uring_register, m_fd, IORING_REGISTER_BUFFERS,
+                                          vectors.data(), vectors.size()) == 0;
+        }
+
+        /**
+         * @brief Returns a cleared entry at the private tail of the submission queue, or nullptr
+         * if the queue is full.
+         */
+        auto next_entry() -> io_uring_sqe*
+        {
+            if (!is_open() || m_sq_tail - load_acquire(m_sq_head) >= m_sq_entries)
+            {
+                return nullptr;
+            }
+
+            const unsigned index = m_sq_tail & *m_sq_mask;
+            io_uring_sqe* entry = &m_sqes[index];
+            std::memset(entry, 0, sizeof(*entry));
+            m_sq_array[index] = index;
+            ++m_sq_tail;
+            return entry;
+        }
+
+        auto submit() -> bool
+        {
+            store_release(m_sq_tail_shared, m_sq_tail);
+
+            while (m_submitted != m_sq_tail)
+            {
+                const long result = ::syscall(__NR_io_uring_enter, m_fd, m_sq_tail - m_submitted,
+                                              0, 0, nullptr, 0);
+                if (result < 0)
+                {
+                    if (errno == EINTR || errno == EAGAIN)
+                    {
+                        continue;
+                    }
+                    return false;
+                }
+
+                m_submitted += static_cast<unsigned>(result);
+            }
+
+            return true;
+        }
+
+        auto wait(IoUringCompletion& completion) -> bool
+        {
+            while (is_open())
+            {
+                const unsigned head = *m_cq_head;
+
+                if (head != load_acquire(m_cq_tail))
+                {
+                    const io_uring_cqe& entry = m_cqes[head & *m_cq_mask];
+                    completion.user_data = entry.user_data;
+                    completion.result = entry.res;
+                    store_release(m_cq_head, head + 1);
+                    return true;
+                }
+
+                if (::syscall(__NR_io_uring_enter, m_fd, 0, 1, IORING_ENTER_GETEVENTS, nullptr,
+                              0) < 0 &&
+                    errno != EINTR)
+                {
+                    return false;
+                }
+            }
+
+            return false;
+        }
+
+    private:
+        auto map(const io_uring_params& params) -> bool
+        {
+            m_sq_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+            m_cq_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+            if ((params.features & IORING_FEAT_SINGLE_MMAP) != 0)
+            {
+                m_sq_size = m_cq_size = std::max(m_sq_size, m_cq_size);
+            }
+
+            m_sq_ring = mmap_ring(m_sq_size, IORING_OFF_SQ_RING);
+            if (m_sq_ring == nullptr)
+            {
+                return false;
+            }
+
+            if ((params.features & IORING_FEAT_SINGLE_MMAP) != 0)
+            {
+                m_cq_ring = m_sq_ring;
+            }
+            else if ((m_cq_ring = mmap_ring(m_cq_size, IORING_OFF_CQ_RING)) == nullptr)
+            {
+                return false;
+            }
+
+            m_sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+            m_sqes = static_cast<io_uring_sqe*>(mmap_ring(m_sqes_size, IORING_OFF_SQES));
+            if (m_sqes == nullptr)
+            {
+                return false;
+            }
+
+            auto* sq = static_cast<char*>(m_sq_ring);
+            auto* cq = static_cast<char*>(m_cq_ring);
+            m_sq_head = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+            m_sq_tail_shared = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+            m_sq_mask = reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+            m_sq_array = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+            m_cq_head = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+            m_cq_tail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+            m_cq_mask = reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+            m_cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+            m_sq_entries = params.sq_entries;
+            m_sq_tail = m_submitted = *m_sq_tail_shared;
+            return true;
+        }
+
+        auto mmap_ring(std::size_t size, off_t offset) const -> void*
+        {
+            void* ring =
+                ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_fd,
+                       offset);
+            return ring == MAP_FAILED ? nullptr : ring;
+        }
+
+        auto close() -> void
+        {
+            if (m_sqes != nullptr)
+            {
+                ::munmap(m_sqes, m_sqes_size);
+            }
+            if (m_cq_ring != nullptr && m_cq_ring != m_sq_ring)
+            {
+                ::munmap(m_cq_ring, m_cq_size);
+            }
+            if (m_sq_ring != nullptr)
+            {
+                ::munmap(m_sq_ring, m_sq_size);
+            }
+            if (m_fd >= 0)
+            {
+                ::close(m_fd);
+            }
+
+            m_sqes = nullptr;
+            m_sq_ring = m_cq_ring = nullptr;
+            m_fd = -1;
+        }
+
+        int m_fd = -1;
+        void* m_sq_ring = nullptr;
+        void* m_cq_ring = nullptr;
+        std::size_t m_sq_size = 0;
+        std::size_t m_cq_size = 0;
+        std::size_t m_sqes_size = 0;
+        io_uring_sqe* m_sqes = nullptr;
+        io_uring_cqe* m_cqes = nullptr;
+
+        unsigned* m_sq_head = nullptr;
+        unsigned* m_sq_tail_shared = nullptr;
+        unsigned* m_sq_mask = nullptr;
+        unsigned* m_sq_array = nullptr;
+        unsigned* m_cq_head = nullptr;
+        unsigned* m_cq_tail = nullptr;
+        unsigned* m_cq_mask = nullptr;
+        unsigned m_sq_entries = 0;
+        unsigned m_sq_tail = 0;    ///< Tail including prepared but unpublished entries.
+        unsigned m_submitted = 0;  ///< Entries accepted by io_uring_enter.
+};
+
+IoUring::IoUring(unsigned entries): m_impl(std::make_unique<Impl>(entries)) {}
+
+IoUring::~IoUring() = default;
+
+auto IoUring::is_open() const -> bool
+{
+    return m_impl->is_open();
+}
+
+auto IoUring::register_buffers(std::span<const std::span<char>> buffers) -> bool
+{
+    return m_impl->register_buffers(buffers);
+}
+
+auto IoUring::prepare_write(int fd, std::span<const char> data, std::uint64_t offset,
+                            std::uint64_t user_data, int fixed_buffer) -> bool
+{
+    io_uring_sqe* entry = m_impl->next_entry();
+    if (entry == nullptr)
+    {
+        return false;
+    }
+
+    entry->opcode = fixed_buffer >= 0 ? IORING_OP_WRITE_FIXED : IORING_OP_WRITE;
+    entry->fd = fd;
+    entry->addr = reinterpret_cast<std::uint64_t>(data.data());
+    entry->len = static_cast<std::uint32_t>(data.size());
+    entry->off = offset;
+    entry->buf_index = static_cast<std::uint16_t>(std::max(fixed_buffer, 0));
+    entry->user_data = user_data;
+    return true;
+}
+
+auto IoUring::prepare_sync(int fd, std::uint64_t user_data) -> bool
+{
+    io_uring_sqe* entry = m_impl->next_entry();
+    if (entry == nullptr)
+    {
+        return false;
+    }
+
+    // Draining orders the sync after every earlier write, not only those linked to it.
+    entry->opcode = IORING_OP_FSYNC;
+    entry->flags = IOSQE_IO_DRAIN;
+    entry->fd = fd;
+    entry->fsync_flags = IORING_FSYNC_DATASYNC;
+    entry->user_data = user_data;
+    return true;
+}
+
+auto IoUring::prepare_nop(std::uint64_t user_data) -> bool
+{
+    io_uring_sqe* entry = m_impl->next_entry();
+    if (entry == nullptr)
+    {
+        return false;
+    }
+
+    entry->opcode = IORING_OP_NOP;
+    entry->user_data = user_data;
+    return true;
+}
+
+auto IoUring::submit() -> bool
+{
+    return m_impl->is_open() && m_impl->submit();
+}
+
+auto IoUring::wait(IoUringCompletion& completion) -> bool
+{
+    return m_impl->wait(completion);
+}
+
+#else
+
+/**
+ * @class IoUring::Impl
+ * @brief Placeholder on platforms without io_uring.
+ */
+class IoUring::Impl
+{};
+
+IoUring::IoUring(unsigned /*entries*/) {}
+
+IoUring::~IoUring() = default;
+
+auto IoUring::is_open() const -> bool
+{
+    return false;
+}
+
+auto IoUring::register_buffers(std::span<const std::span<char>> /*buffers*/) -> bool
+{
+    return false;
+}
+
+auto IoUring::prepare_write(int /*fd*/, std::span<const char> /*data*/, std::uint64_t /*offset*/,
+                            std::uint64_t /*user_data*/, int /*fixed_buffer*/) -> bool
+{
+    return false;
+}
+
+auto IoUring::prepare_sync(int /*fd*/, std::uint64_t /*user_data*/) -> bool
+{
+    return false;
+}
+
+auto IoUring::prepare_nop(std::uint64_t /*user_data*/) -> bool
+{
+    return false;
+}
+
+auto IoUring::submit() -> bool
+{
+    return false;
+}
+
+auto IoUring::wait(IoUringCompletion& /*completion*/) -> bool
+{
+    return false;
+}
+
+#endif
+
+}  // namespace SimpleCppLogger
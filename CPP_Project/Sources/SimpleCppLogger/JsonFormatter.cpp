@@ -0,0 +1,257 @@
+/**
+ * @file JsonFormatter.cpp
+ * @brief This file contains the implementation of the JsonFormatter class.
+ */
+
+#include "SimpleCppLogger/JsonFormatter.h"
+
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+
+#include "SimpleCppLogger/LogLevel.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define SIMPLECPPLOGGER_JSON_AVX2 1
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define SIMPLECPPLOGGER_JSON_SSE2 1
+#endif
+
+namespace SimpleCppLogger
+{
+
+namespace
+{
+/**
+ * @brief Returns true if the given byte must be escaped inside a JSON string.
+ */
+constexpr auto needs_escape(unsigned char c) -> bool
+{
+    return c < 0x20 || c == '"' || c == '\\';
+}
+
+/**
+ * @brief Finds the first byte at or after pos that must be escaped.
+ *
+ * Whole blocks are checked with a single compare-and-movemask sequence; the remaining tail is
+ * checked byte by byte.
+ *
+ * @return The index of the byte, or size if the rest of the text can be copied verbatim.
+ */
+auto find_next_escape(const char* data, std::size_t size, std::size_t pos) -> std::size_t
+{
+#if defined(SIMPLECPPLOGGER_JSON_AVX2)
+    const __m256i quote_32 = _mm256_set1_epi8('"');
+    const __m256i backslash_32 = _mm256_set1_epi8('\\');
+    const __m256i control_max_32 = _mm256_set1_epi8(0x1F);
+
+    while (pos + 32 <= size)
+    {
+        const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + pos));
+        // max_epu8(chunk, 0x1F) == 0x1F holds exactly for the unsigned bytes <= 0x1F.
+        const __m256i is_control =
+            _mm256_cmpeq_epi8(_mm256_max_epu8(chunk, control_max_32), control_max_32);
+        const __m256i hits =
+            _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(chunk, quote_32),
+                                            _mm256_cmpeq_epi8(chunk, backslash_32)),
+                            is_control);
+        const auto mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(hits));
+
+        if (mask != 0)
+        {
+            return pos + static_cast<std::size_t>(std::countr_zero(mask));
+        }
+        pos += 32;
+    }
+#endif
+
+#if defined(SIMPLECPPLOGGER_JSON_SSE2)
+    const __m128i quote_16 = _mm_set1_epi8('"');
+    const __m128i backslash_16 = _mm_set1_epi8('\\');
+    const __m128i control_max_16 = _mm_set1_epi8(0x1F);
+
+    while (pos + 16 <= size)
+    {
+        const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos));
+        const __m128i is_control =
+            _mm_cmpeq_epi8(_mm_max_epu8(chunk, control_max_16), control_max_16);
+        const __m128i hits = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(chunk, quote_16), _mm_cmpeq_epi8(chunk, backslash_16)),
+            is_control);
+        const auto mask = static_cast<std::uint32_t>(_mm_movemask_epi8(hits));
+
+        if (mask != 0)
+        {
+            return pos + static_cast<std::size_t>(std::countr_zero(mask));
+        }
+        pos += 16;
+    }
+#endif
+
+    while (pos < size && !needs_escape(static_cast<unsigned char>(data[pos])))
+    {
+        ++pos;
+    }
+
+    return pos;
+}
+
+/**
+ * @brief Appends the escape sequence for a single byte that requires escaping.
+ */
+auto append_escape_sequence(std::string& out, unsigned char c) -> void
+{
+    static constexpr char hex_digits[] = "0123456789abcdef";
+
+    switch (c)
+    {
+    case '"':
+        out += "\\\"";
+        break;
+    case '\\':
+        out += "\\\\";
+        break;
+    case '\n':
+        out += "\\n";
+        break;
+    case '\r':
+        out += "\\r";
+        break;
+    case '\t':
+        out += "\\t";
+        break;
+    case '\b':
+        out += "\\b";
+        break;
+    case '\f':
+        out += "\\f";
+        break;
+    default:
+        out += "\\u00";
+        out += hex_digits[c >> 4];
+        out += hex_digits[c & 0x0F];
+        break;
+    }
+}
+
+/**
+ * @brief Appends the timestamp as an ISO 8601 UTC string with millisecond precision.
+ */
+auto append_timestamp(std::string& out, LogMessage::Clock::time_point timestamp) -> void
+{
+    const auto day_point = std::chrono::floor<std::chrono::days>(timestamp);
+    const std::chrono::year_month_day date{day_point};
+    const std::chrono::hh_mm_ss time{
+        std::chrono::floor<std::chrono::milliseconds>(timestamp - day_point)};
+
+    char buffer[32];
+    const int length = std::snprintf(
+        buffer, sizeof(buffer), "%04d-%02u-%02uT%02d:%02d:%02d.%03dZ",
+        static_cast<int>(date.year()), static_cast<unsigned>(date.month()),
+        static_cast<unsigned>(date.day()), static_cast<int>(time.hours().count()),
+        static_cast<int>(time.minutes().count()), static_cast<int>(time.seconds().count()),
+        static_cast<int>(time.subseconds().count()));
+
+    if (length > 0)
+    {
+        out.append(buffer, static_cast<std::size_t>(length));
+    }
+}
+
+/**
+ * @brief Appends a "key":"value" pair with an escaped string value.
+ */
+auto append_string_field(std::string& out, std::string_view key, std::string_view value) -> void
+{
+    out += ",\"";
+    out += key;
+    out += "\":\"";
+    JsonFormatter::append_escaped(out, value);
+    out += '"';
+}
+}  // namespace
+
+auto JsonFormatter::append_escaped(std::string& out, std::string_view text) -> void
+{
+    const char* data = text.data();
+    const std::size_t size = text.size();
+    std::size_t pos = 0;
+
+    out.reserve(out.size() + size);
+
+    while (pos < size)
+    {
+        const std::size_t next = find_next_escape(data, size, pos);
+        out.append(data + pos, next - pos);
+
+        if (next == size)
+        {
+            break;
+        }
+
+        append_escape_sequence(out, static_cast<unsigned char>(data[next]));
+        pos = next + 1;
+    }
+}
+
+auto JsonFormatter::format(const LogMessage& log_message,
+                           const std::source_location& location) const -> std::string
+{
+    const std::string_view level_name = to_string_view(log_message.get_level());
+    const std::string_view message = log_message.get_message();
+
+    std::string out;
+    out.reserve(96 + message.size());
+
+    out += "{\"timestamp\":\"";
+    append_timestamp(out, log_message.get_timestamp());
+    out += '"';
+
+    append_string_field(out, "level", level_name.empty() ? "Unknown" : level_name);
+
+    if (!log_message.get_category().empty())
+    {
+        append_string_field(out, "category", log_message.get_category());
+    }
+
+    append_string_field(out, "message", message);
+
+    // Messages with an explicit source context are logged with an empty source_location.
+    std::string_view file = location.file_name();
+    std::string_view function = location.function_name();
+    std::uint_least32_t line = location.line();
+
+    if (file.empty() && function.empty() && line == 0)
+    {
+        file = log_message.get_file();
+        function = log_message.get_function();
+        line = log_message.get_line();
+    }
+
+    if (!file.empty())
+    {
+        append_string_field(out, "file", file);
+    }
+
+    if (line > 0)
+    {
+        out += ",\"line\":";
+        out += std::to_string(line);
+    }
+
+    if (!function.empty())
+    {
+        append_string_field(out, "function", function);
+    }
+
+    out += '}';
+
+    return out;
+}
+
+}  // namespace SimpleCppLogger
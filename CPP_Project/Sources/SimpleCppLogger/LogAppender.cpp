@@ -1,9 +1,53 @@
 #include "SimpleCppLogger/LogAppender.h"
 
+#include <utility>
+
 #include "SimpleCppLogger/SimpleFormatter.h"
 
 namespace SimpleCppLogger
 {
+namespace
+{
+thread_local DurableWaitScope* t_durable_wait_scope = nullptr;
+}  // namespace
+
+/**
+ * @brief Makes this scope the innermost one of the calling thread.
+ */
+DurableWaitScope::DurableWaitScope(): m_outer(t_durable_wait_scope)
+{
+    t_durable_wait_scope = this;
+}
+
+/**
+ * @brief Restores the enclosing scope and waits for the results passed in this scope.
+ */
+DurableWaitScope::~DurableWaitScope()
+{
+    t_durable_wait_scope = m_outer;
+
+    for (auto& result: m_pending)
+    {
+        result.wait();
+    }
+}
+
+/**
+ * @brief Waits for a durable result, or leaves the wait to the innermost scope of the calling
+ * thread if there is one.
+ *
+ * @param result Becomes ready once the record is synced.
+ */
+auto DurableWaitScope::wait_for_durable(std::future<bool> result) -> void
+{
+    if (t_durable_wait_scope != nullptr)
+    {
+        t_durable_wait_scope->m_pending.push_back(std::move(result));
+        return;
+    }
+
+    result.wait();
+}
 
 /**
  * @brief Constructs a LogAppender object with a default SimpleFormatter.
@@ -44,6 +88,119 @@ auto LogAppender::append(const LogMessage& message, const std::source_location&
     }
 }
 
+/**
+ * @brief Appends a log message that has already been formatted with format().
+ *
+ * The message is only appended if its level is greater than or equal to the log level of the
+ * appender.
+ *
+ * @param message The log message to append.
+ * @param location The source location of the log message.
+ * @param formatted The result of format() for this message.
+ */
+auto LogAppender::append_formatted(const LogMessage& message,
+                                   const std::source_location& location, std::string&& formatted)
+    -> void
+{
+    if (message.get_level() >= m_log_level)
+    {
+        internal_append_formatted(message, location, std::move(formatted));
+    }
+}
+
+/**
+ * @brief Appends a batch of log messages in order.
+ *
+ * Calls append() for each record, so every record is checked against the log level of the
+ * appender.
+ *
+ * @param records The messages to append, with their source locations.
+ */
+auto LogAppender::append_batch(std::span<const StagedRecord> records) -> void
+{
+    for (const auto& record: records)
+    {
+        append(record.message, record.location);
+    }
+}
+
+/**
+ * @brief Formats a log message with this appender's formatter.
+ *
+ * @param message The log message to format.
+ * @param location The source location of the log message.
+ * @return The formatted text, or the raw message text if no formatter is set.
+ */
+auto LogAppender::format(const LogMessage& message, const std::source_location& location) const
+    -> std::string
+{
+    return m_formatter ? m_formatter->format(message, location) : message.get_message();
+}
+
+/**
+ * @brief Returns whether the appender writes text produced by format() unchanged.
+ *
+ * The base implementation returns false.
+ *
+ * @return True if append_formatted() uses the given text, false otherwise.
+ */
+auto LogAppender::supports_preformatted() const -> bool
+{
+    return false;
+}
+
+/**
+ * @brief Flushes everything appended before the call.
+ *
+ * @param mode Whether the records only have to be written or also synced to disk.
+ * @return A future that becomes ready once the records have reached the requested state.
+ */
+auto LogAppender::flush(FlushMode mode) -> std::future<bool>
+{
+    auto promise = std::make_shared<std::promise<bool>>();
+    std::future<bool> result = promise->get_future();
+    internal_flush([promise](bool success) { promise->set_value(success); }, mode);
+    return result;
+}
+
+/**
+ * @brief Flushes everything appended before the call and reports the result to a callback.
+ *
+ * @param callback Called exactly once with the result.
+ * @param mode Whether the records only have to be written or also synced to disk.
+ */
+auto LogAppender::flush(FlushCallback callback, FlushMode mode) -> void
+{
+    if (!callback)
+    {
+        callback = [](bool /*success*/) {};
+    }
+
+    internal_flush(std::move(callback), mode);
+}
+
+/**
+ * @brief Calls the callback with true; appenders that write synchronously have nothing to flush.
+ */
+auto LogAppender::internal_flush(FlushCallback callback, FlushMode /*mode*/) -> void
+{
+    callback(true);
+}
+
+/**
+ * @brief Appends a preformatted log message by discarding the text and calling
+ * internal_append().
+ *
+ * @param message The log message to append.
+ * @param location The source location of the log message.
+ */
+auto LogAppender::internal_append_formatted(const LogMessage& message,
+                                            const std::source_location& location,
+                                            std::string&& /*formatted*/) -> void
+{
+    internal_append(message, location);
+}
+
 /**
  * @brief Sets the formatter for the log appender.
  *
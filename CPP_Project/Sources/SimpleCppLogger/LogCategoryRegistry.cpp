@@ -0,0 +1,178 @@
+#include "SimpleCppLogger/LogCategoryRegistry.h"
+
+#include <algorithm>
+
+namespace SimpleCppLogger
+{
+
+/**
+ * @brief Constructs a registry whose default level is LogLevel::Debug.
+ *
+ * Slot 0 is reserved for the unnamed default category.
+ */
+LogCategoryRegistry::LogCategoryRegistry(): m_default_level(LogLevel::Debug)
+{
+    for (auto& threshold: m_thresholds)
+    {
+        threshold.store(m_default_level, std::memory_order_relaxed);
+    }
+
+    m_names.emplace_back();
+}
+
+/**
+ * @brief Returns the category with the given name, registering it on first use.
+ *
+ * An empty name refers to the default category.
+ *
+ * @param name The category name.
+ * @return A handle to the category, or to the default category if the registry is full.
+ */
+auto LogCategoryRegistry::get_or_register(std::string_view name) -> LogCategory
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (name.empty())
+    {
+        return make_handle(0);
+    }
+
+    if (auto it = m_ids.find(name); it != m_ids.end())
+    {
+        return make_handle(it->second);
+    }
+
+    if (m_names.size() >= MaxCategories)
+    {
+        return make_handle(0);
+    }
+
+    const std::size_t id = m_names.size();
+    const std::string& stored_name = m_names.emplace_back(name);
+    m_ids.emplace(stored_name, id);
+    m_thresholds[id].store(m_default_level, std::memory_order_relaxed);
+
+    return make_handle(id);
+}
+
+/**
+ * @brief Looks up an already registered category.
+ * @param name The category name.
+ * @return A handle to the category, or std::nullopt if it is not registered.
+ */
+auto LogCategoryRegistry::find(std::string_view name) const -> std::optional<LogCategory>
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (auto it = m_ids.find(name); it != m_ids.end())
+    {
+        return make_handle(it->second);
+    }
+
+    return std::nullopt;
+}
+
+/**
+ * @brief Sets an explicit threshold for a category.
+ * @param category The category to configure.
+ * @param level The threshold to set.
+ */
+auto LogCategoryRegistry::set_level(const LogCategory& category, LogLevel level) -> void
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (owns(category) && category.get_id() != 0)
+    {
+        m_has_override[category.get_id()] = true;
+        m_thresholds[category.get_id()].store(level, std::memory_order_relaxed);
+    }
+}
+
+/**
+ * @brief Removes the explicit threshold so the category follows the default level again.
+ * @param category The category to reset.
+ */
+auto LogCategoryRegistry::reset_level(const LogCategory& category) -> void
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (owns(category))
+    {
+        m_has_override[category.get_id()] = false;
+        m_thresholds[category.get_id()].store(m_default_level, std::memory_order_relaxed);
+    }
+}
+
+/**
+ * @brief Returns the effective threshold of a category.
+ * @param category The category to query.
+ * @return The explicit threshold if set, otherwise the default level.
+ */
+auto LogCategoryRegistry::get_level(const LogCategory& category) const -> LogLevel
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return owns(category) ? m_thresholds[category.get_id()].load(std::memory_order_relaxed)
+                          : m_default_level;
+}
+
+/**
+ * @brief Sets the level followed by all categories without an explicit threshold.
+ * @param level The default level.
+ */
+auto LogCategoryRegistry::set_default_level(LogLevel level) -> void
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_default_level = level;
+
+    for (std::size_t id = 0; id < m_names.size(); ++id)
+    {
+        if (!m_has_override[id])
+        {
+            m_thresholds[id].store(level, std::memory_order_relaxed);
+        }
+    }
+}
+
+/**
+ * @brief Returns the lowest effective threshold of all categories.
+ * @return The lowest threshold, never higher than the default level.
+ */
+auto LogCategoryRegistry::get_lowest_level() const -> LogLevel
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    LogLevel lowest = m_default_level;
+
+    for (std::size_t id = 0; id < m_names.size(); ++id)
+    {
+        if (m_has_override[id])
+        {
+            lowest = std::min(lowest, m_thresholds[id].load(std::memory_order_relaxed));
+        }
+    }
+
+    return lowest;
+}
+
+/**
+ * @brief Returns the number of registered categories, including the default category.
+ * @return The number of categories.
+ */
+auto LogCategoryRegistry::size() const -> std::size_t
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_names.size();
+}
+
+auto LogCategoryRegistry::owns(const LogCategory& category) const -> bool
+{
+    return category.get_id() < m_names.size() &&
+           category.m_threshold == &m_thresholds[category.get_id()];
+}
+
+auto LogCategoryRegistry::make_handle(std::size_t id) const -> LogCategory
+{
+    return LogCategory(static_cast<std::uint16_t>(id), m_names[id], &m_thresholds[id]);
+}
+
+}  // namespace SimpleCppLogger
@@ -0,0 +1,266 @@
+#include "SimpleCppLogger/LogFormat.h"
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace SimpleCppLogger
+{
+namespace
+{
+using detail::FormatArg;
+using detail::FormatArgKind;
+using detail::FormatSpec;
+
+/**
+ * @brief Large enough for a double in fixed notation with the highest precision.
+ */
+constexpr std::size_t MaxNumberSize = 320 + MaxFormatWidth;
+
+auto to_upper(char* first, char* last) -> void
+{
+    std::transform(first, last, first, [](char c) {
+        return static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+    });
+}
+
+/**
+ * @brief Appends the prefix (sign and base) and the body, padded to the field width.
+ *
+ * With zero padding and no explicit alignment, zeros go between the prefix and the body.
+ */
+auto append_padded(std::string& out, const FormatSpec& spec, std::string_view prefix,
+                   std::string_view body, char default_align, bool zero_pad) -> void
+{
+    const std::size_t size = prefix.size() + body.size();
+    const std::size_t padding = spec.width > size ? spec.width - size : 0;
+
+    if (zero_pad && spec.align == '\0')
+    {
+        out.append(prefix);
+        out.append(padding, '0');
+        out.append(body);
+        return;
+    }
+
+    const char align = spec.align != '\0' ? spec.align : default_align;
+    const std::size_t before = align == '>' ? padding : align == '^' ? padding / 2 : 0;
+    out.append(before, spec.fill);
+    out.append(prefix);
+    out.append(body);
+    out.append(padding - before, spec.fill);
+}
+
+auto append_char(std::string& out, const FormatSpec& spec, char c) -> void
+{
+    append_padded(out, spec, {}, std::string_view(&c, 1), '<', false);
+}
+
+/**
+ * @brief Appends an integer given as sign and magnitude in the base of the presentation type.
+ */
+auto append_integer(std::string& out, const FormatSpec& spec, std::uint64_t magnitude,
+                    bool negative) -> void
+{
+    if (spec.type == 'c')
+    {
+        append_char(out, spec, static_cast<char>(negative ? 0 - magnitude : magnitude));
+        return;
+    }
+
+    int base = 10;
+    std::string_view base_prefix;
+    switch (spec.type)
+    {
+    case 'b':
+    case 'B':
+        base = 2;
+        base_prefix = spec.type == 'b' ? "0b" : "0B";
+        break;
+    case 'o':
+        base = 8;
+        base_prefix = magnitude != 0 ? "0" : "";
+        break;
+    case 'x':
+    case 'X':
+        base = 16;
+        base_prefix = spec.type == 'x' ? "0x" : "0X";
+        break;
+    default:
+        break;
+    }
+
+    std::array<char, 64> digits{};
+    const auto result =
+        std::to_chars(digits.data(), digits.data() + digits.size(), magnitude, base);
+    if (spec.type == 'X')
+    {
+        to_upper(digits.data(), result.ptr);
+    }
+
+    std::array<char, 3> prefix{};
+    std::size_t prefix_size = 0;
+    if (negative || spec.sign != '-')
+    {
+        prefix[prefix_size++] = negative ? '-' : spec.sign;
+    }
+    if (spec.alternate)
+    {
+        for (char c: base_prefix)
+        {
+            prefix[prefix_size++] = c;
+        }
+    }
+
+    const auto digit_count = static_cast<std::size_t>(result.ptr - digits.data());
+    append_padded(out, spec, std::string_view(prefix.data(), prefix_size),
+                  std::string_view(digits.data(), digit_count), '>', spec.zero_pad);
+}
+
+auto append_signed(std::string& out, const FormatSpec& spec, std::int64_t value) -> void
+{
+    const auto bits = static_cast<std::uint64_t>(value);
+    append_integer(out, spec, value < 0 ? 0 - bits : bits, value < 0);
+}
+
+/**
+ * @brief Appends a floating-point number like std::format: the shortest round-trip form by
+ * default, otherwise the notation and precision of the presentation type.
+ */
+auto append_floating(std::string& out, const FormatSpec& spec, double value) -> void
+{
+    const bool negative = std::signbit(value);
+    const double magnitude = std::fabs(value);
+    const int precision = spec.precision;
+
+    std::array<char, MaxNumberSize> digits{};
+    char* const first = digits.data();
+    char* const last = digits.data() + digits.size();
+    std::to_chars_result result{};
+
+    switch (spec.type)
+    {
+    case 'a':
+    case 'A':
+        result = precision < 0 ? std::to_chars(first, last, magnitude, std::chars_format::hex)
+                               : std::to_chars(first, last, magnitude, std::chars_format::hex,
+                                               precision);
+        break;
+    case 'e':
+    case 'E':
+        result = std::to_chars(first, last, magnitude, std::chars_format::scientific,
+                               precision < 0 ? 6 : precision);
+        break;
+    case 'f':
+    case 'F':
+        result = std::to_chars(first, last, magnitude, std::chars_format::fixed,
+                               precision < 0 ? 6 : precision);
+        break;
+    case 'g':
+    case 'G':
+        result = std::to_chars(first, last, magnitude, std::chars_format::general,
+                               precision < 0 ? 6 : precision);
+        break;
+    default:
+        result = precision < 0 ? std::to_chars(first, last, magnitude)
+                               : std::to_chars(first, last, magnitude,
+                                               std::chars_format::general, precision);
+        break;
+    }
+
+    if (spec.type == 'A' || spec.type == 'E' || spec.type == 'F' || spec.type == 'G')
+    {
+        to_upper(first, result.ptr);
+    }
+
+    const char sign = negative ? '-' : spec.sign;
+    const std::string_view prefix = sign != '-' || negative ? std::string_view(&sign, 1)
+                                                            : std::string_view();
+    append_padded(out, spec, prefix,
+                  std::string_view(first, static_cast<std::size_t>(result.ptr - first)), '>',
+                  spec.zero_pad && std::isfinite(value));
+}
+
+auto append_argument(std::string& out, const FormatSpec& spec, const FormatArg& arg) -> void
+{
+    const bool default_type = spec.type == '\0';
+
+    switch (arg.kind)
+    {
+    case FormatArgKind::Bool:
+        if (default_type || spec.type == 's')
+        {
+            append_padded(out, spec, {}, arg.integer != 0 ? "true" : "false", '<', false);
+        }
+        else
+        {
+            append_signed(out, spec, arg.integer);
+        }
+        break;
+    case FormatArgKind::Char:
+        if (default_type || spec.type == 'c')
+        {
+            append_char(out, spec, static_cast<char>(arg.integer));
+        }
+        else
+        {
+            append_signed(out, spec, arg.integer);
+        }
+        break;
+    case FormatArgKind::Signed:
+        append_signed(out, spec, arg.integer);
+        break;
+    case FormatArgKind::Unsigned:
+        append_integer(out, spec, arg.unsigned_integer, false);
+        break;
+    case FormatArgKind::Floating:
+        append_floating(out, spec, arg.floating);
+        break;
+    case FormatArgKind::String:
+        append_padded(out, spec, {},
+                      spec.precision < 0
+                          ? arg.text
+                          : arg.text.substr(0, static_cast<std::size_t>(spec.precision)),
+                      '<', false);
+        break;
+    case FormatArgKind::Pointer: {
+        FormatSpec hex = spec;
+        hex.type = 'x';
+        hex.alternate = true;
+        append_integer(out, hex, arg.unsigned_integer, false);
+        break;
+    }
+    case FormatArgKind::None:
+        break;
+    }
+}
+}  // namespace
+
+/**
+ * @brief Appends the literal text of the format string and the formatted arguments.
+ *
+ * @param out The string to append to.
+ * @param format A format string checked with is_valid_format().
+ * @param args The arguments, in the order of the format call.
+ */
+auto detail::append_format_args(std::string& out, std::string_view format,
+                                std::span<const FormatArg> args) -> void
+{
+    out.reserve(out.size() + format.size());
+    static_cast<void>(scan_format(
+        format, [&out](std::string_view text) { out.append(text); },
+        [&out, args](std::size_t index, const FormatSpec& spec) {
+            if (index < args.size())
+            {
+                append_argument(out, spec, args[index]);
+            }
+            return true;
+        }));
+}
+}  // namespace SimpleCppLogger
@@ -0,0 +1,417 @@
+#include "SimpleCppLogger/LogIndex.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <system_error>
+
+namespace SimpleCppLogger
+{
+
+namespace
+{
+constexpr std::array<char, 8> Magic = {'S', 'C', 'L', 'I', 'D', 'X', '0', '1'};
+constexpr std::size_t CodecNameSize = 16;
+constexpr std::size_t HeaderSize = Magic.size() + 2 * sizeof(std::uint32_t) + CodecNameSize;
+constexpr std::size_t EntryFixedSize = 5 * sizeof(std::uint64_t) + 2 * sizeof(std::uint32_t);
+constexpr std::uint32_t HashCount = 3;
+
+/**
+ * @brief The index header as stored at the start of the file.
+ */
+struct Header {
+        std::uint32_t bloom_bytes = 0;
+        std::uint32_t hash_count = HashCount;
+        std::string codec_name;
+};
+
+auto is_token_char(unsigned char c) -> bool
+{
+    return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+           c == '_' || c >= 0x80;
+}
+
+/**
+ * @brief Calls the function for every token of the text.
+ */
+template<typename Function>
+auto for_each_token(std::string_view text, Function&& function) -> void
+{
+    std::size_t pos = 0;
+
+    while (pos < text.size())
+    {
+        while (pos < text.size() && !is_token_char(static_cast<unsigned char>(text[pos])))
+        {
+            ++pos;
+        }
+
+        const std::size_t start = pos;
+        while (pos < text.size() && is_token_char(static_cast<unsigned char>(text[pos])))
+        {
+            ++pos;
+        }
+
+        if (pos > start)
+        {
+            function(text.substr(start, pos - start));
+        }
+    }
+}
+
+/**
+ * @brief Calls the function with the bit positions of a token (FNV-1a with double hashing).
+ */
+template<typename Function>
+auto for_each_bit(std::string_view token, std::size_t bit_count, Function&& function) -> void
+{
+    std::uint64_t hash = 14695981039346656037ULL;
+    for (const char c: token)
+    {
+        hash = (hash ^ static_cast<unsigned char>(c)) * 1099511628211ULL;
+    }
+
+    const std::uint64_t step = (hash >> 32) | 1;
+    for (std::uint32_t i = 0; i < HashCount; ++i)
+    {
+        function(static_cast<std::size_t>((hash + i * step) % bit_count));
+    }
+}
+
+template<typename T>
+auto put(char*& out, T value) -> void
+{
+    std::memcpy(out, &value, sizeof(T));
+    out += sizeof(T);
+}
+
+template<typename T>
+auto get(const char*& in) -> T
+{
+    T value;
+    std::memcpy(&value, in, sizeof(T));
+    in += sizeof(T);
+    return value;
+}
+
+auto encode_header(const Header& header) -> std::array<char, HeaderSize>
+{
+    std::array<char, HeaderSize> bytes{};
+    char* out = bytes.data();
+
+    std::memcpy(out, Magic.data(), Magic.size());
+    out += Magic.size();
+    put(out, header.bloom_bytes);
+    put(out, header.hash_count);
+    std::memcpy(out, header.codec_name.data(),
+                std::min(header.codec_name.size(), CodecNameSize - 1));
+
+    return bytes;
+}
+
+auto read_header(std::FILE* file) -> std::optional<Header>
+{
+    std::array<char, HeaderSize> bytes{};
+    if (std::fread(bytes.data(), 1, bytes.size(), file) != bytes.size() ||
+        std::memcmp(bytes.data(), Magic.data(), Magic.size()) != 0)
+    {
+        return std::nullopt;
+    }
+
+    const char* in = bytes.data() + Magic.size();
+    Header header;
+    header.bloom_bytes = get<std::uint32_t>(in);
+    header.hash_count = get<std::uint32_t>(in);
+    header.codec_name.assign(in, strnlen(in, CodecNameSize));
+
+    if (header.bloom_bytes == 0 || header.bloom_bytes % 8 != 0 || header.hash_count != HashCount)
+    {
+        return std::nullopt;
+    }
+
+    return header;
+}
+
+auto seek(std::FILE* file, std::uint64_t offset) -> bool
+{
+#ifdef _WIN32
+    return ::_fseeki64(file, static_cast<long long>(offset), SEEK_SET) == 0;
+#else
+    return ::fseeko(file, static_cast<off_t>(offset), SEEK_SET) == 0;
+#endif
+}
+
+auto to_nanoseconds(LogMessage::Clock::time_point time) -> std::int64_t
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count();
+}
+}  // namespace
+
+auto LogIndexBlock::add_tokens(std::string_view text) -> void
+{
+    if (bloom.empty())
+    {
+        return;
+    }
+
+    const std::size_t bit_count = bloom.size() * 64;
+    for_each_token(text, [&](std::string_view token) {
+        for_each_bit(token, bit_count, [&](std::size_t bit) {
+            bloom[bit / 64] |= std::uint64_t{1} << (bit % 64);
+        });
+    });
+}
+
+auto LogIndexBlock::may_contain_tokens(std::string_view text) const -> bool
+{
+    if (bloom.empty())
+    {
+        return true;
+    }
+
+    const std::size_t bit_count = bloom.size() * 64;
+    bool found = true;
+
+    for_each_token(text, [&](std::string_view token) {
+        for_each_bit(token, bit_count, [&](std::size_t bit) {
+            found = found && (bloom[bit / 64] & (std::uint64_t{1} << (bit % 64))) != 0;
+        });
+    });
+
+    return found;
+}
+
+auto LogIndexBlock::has_level_at_least(LogLevel level) const -> bool
+{
+    const auto index = static_cast<std::uint32_t>(level);
+    return index < 32 && (level_mask >> index) != 0;
+}
+
+auto get_index_path(const std::string& log_path) -> std::string
+{
+    return log_path + ".idx";
+}
+
+/**
+ * @brief Opens or creates the index file.
+ *
+ * In append mode the existing entries are kept if the header matches; otherwise the file is
+ * truncated and a new header is written. A partial entry left at the end by a crash is cut off,
+ * so that the entries appended after it stay aligned.
+ *
+ * @param path The index file.
+ * @param append Keep the existing entries if the header matches.
+ * @param bloom_bytes Size of each block's Bloom filter, rounded up to 8 bytes.
+ * @param codec_name Name of the log file's codec, or empty for plain text.
+ */
+LogIndexWriter::LogIndexWriter(const std::string& path, bool append, std::size_t bloom_bytes,
+                               std::string_view codec_name)
+    : m_bloom_words(std::max<std::size_t>((bloom_bytes + 7) / 8, 1))
+{
+    Header header;
+    header.bloom_bytes = static_cast<std::uint32_t>(m_bloom_words * 8);
+    header.codec_name = codec_name.substr(0, CodecNameSize - 1);
+
+    if (append)
+    {
+        if (std::FILE* existing = std::fopen(path.c_str(), "rb"))
+        {
+            const auto existing_header = read_header(existing);
+            std::fclose(existing);
+
+            std::error_code error;
+            const std::uintmax_t size = std::filesystem::file_size(path, error);
+
+            if (!error && existing_header && existing_header->bloom_bytes == header.bloom_bytes &&
+                existing_header->codec_name == header.codec_name)
+            {
+                const std::uintmax_t entry_size = EntryFixedSize + m_bloom_words * 8;
+                const std::uintmax_t entries = (size - HeaderSize) / entry_size;
+                const std::uintmax_t whole = HeaderSize + entries * entry_size;
+
+                if (whole != size)
+                {
+                    std::filesystem::resize_file(path, whole, error);
+                }
+
+                if (!error)
+                {
+                    m_file = std::fopen(path.c_str(), "ab");
+                    return;
+                }
+            }
+        }
+    }
+
+    m_file = std::fopen(path.c_str(), "wb");
+    if (m_file != nullptr)
+    {
+        const auto bytes = encode_header(header);
+        if (std::fwrite(bytes.data(), 1, bytes.size(), m_file) != bytes.size() ||
+            std::fflush(m_file) != 0)
+        {
+            std::fclose(m_file);
+            m_file = nullptr;
+        }
+    }
+}
+
+/**
+ * @brief Closes the index file.
+ */
+LogIndexWriter::~LogIndexWriter()
+{
+    if (m_file != nullptr)
+    {
+        std::fclose(m_file);
+    }
+}
+
+auto LogIndexWriter::is_open() const -> bool
+{
+    return m_file != nullptr;
+}
+
+auto LogIndexWriter::get_bloom_words() const -> std::size_t
+{
+    return m_bloom_words;
+}
+
+/**
+ * @brief Appends the entry of a block and flushes it to the file.
+ * @param block The block; its Bloom filter must have get_bloom_words() words.
+ * @return True on success.
+ */
+auto LogIndexWriter::write(const LogIndexBlock& block) -> bool
+{
+    if (m_file == nullptr || block.bloom.size() != m_bloom_words)
+    {
+        return false;
+    }
+
+    std::vector<char> bytes(EntryFixedSize + m_bloom_words * 8);
+    char* out = bytes.data();
+    put(out, block.file_offset);
+    put(out, block.stored_size);
+    put(out, block.text_size);
+    put(out, block.first_timestamp);
+    put(out, block.last_timestamp);
+    put(out, block.record_count);
+    put(out, block.level_mask);
+    std::memcpy(out, block.bloom.data(), m_bloom_words * 8);
+
+    return std::fwrite(bytes.data(), 1, bytes.size(), m_file) == bytes.size() &&
+           std::fflush(m_file) == 0;
+}
+
+/**
+ * @brief Loads all entries of the index file.
+ * @param path The index file.
+ */
+LogIndexReader::LogIndexReader(const std::string& path)
+{
+    std::FILE* file = std::fopen(path.c_str(), "rb");
+    if (file == nullptr)
+    {
+        return;
+    }
+
+    if (const auto header = read_header(file))
+    {
+        m_open = true;
+        m_codec_name = header->codec_name;
+
+        const std::size_t bloom_words = header->bloom_bytes / 8;
+        std::vector<char> bytes(EntryFixedSize + header->bloom_bytes);
+
+        while (std::fread(bytes.data(), 1, bytes.size(), file) == bytes.size())
+        {
+            const char* in = bytes.data();
+            LogIndexBlock& block = m_blocks.emplace_back();
+            block.file_offset = get<std::uint64_t>(in);
+            block.stored_size = get<std::uint64_t>(in);
+            block.text_size = get<std::uint64_t>(in);
+            block.first_timestamp = get<std::int64_t>(in);
+            block.last_timestamp = get<std::int64_t>(in);
+            block.record_count = get<std::uint32_t>(in);
+            block.level_mask = get<std::uint32_t>(in);
+            block.bloom.resize(bloom_words);
+            std::memcpy(block.bloom.data(), in, header->bloom_bytes);
+        }
+    }
+
+    std::fclose(file);
+}
+
+auto LogIndexReader::is_open() const -> bool
+{
+    return m_open;
+}
+
+auto LogIndexReader::get_codec_name() const -> std::string_view
+{
+    return m_codec_name;
+}
+
+auto LogIndexReader::get_blocks() const -> const std::vector<LogIndexBlock>&
+{
+    return m_blocks;
+}
+
+/**
+ * @brief Returns the blocks that may contain records matching the query.
+ * @param query The time range, level and tokens to look for.
+ * @return The candidate blocks in file order.
+ */
+auto LogIndexReader::find(const LogIndexQuery& query) const -> std::vector<LogIndexBlock>
+{
+    std::vector<LogIndexBlock> matches;
+
+    for (const auto& block: m_blocks)
+    {
+        const bool in_range =
+            (!query.from || block.last_timestamp >= to_nanoseconds(*query.from)) &&
+            (!query.to || block.first_timestamp <= to_nanoseconds(*query.to));
+
+        if (in_range && block.has_level_at_least(query.min_level) &&
+            block.may_contain_tokens(query.tokens))
+        {
+            matches.push_back(block);
+        }
+    }
+
+    return matches;
+}
+
+/**
+ * @brief Reads the text of a block from the log file.
+ *
+ * @param log_file The log file, opened in binary mode.
+ * @param block The block to read.
+ * @param codec The codec to decompress with, or nullptr for plain text.
+ * @param out The string the text is appended to.
+ * @return True on success.
+ */
+auto LogIndexReader::read_block(std::FILE* log_file, const LogIndexBlock& block,
+                                CompressionCodec* codec, std::string& out) -> bool
+{
+    std::string stored(static_cast<std::size_t>(block.stored_size), '\0');
+
+    if (!seek(log_file, block.file_offset) ||
+        std::fread(stored.data(), 1, stored.size(), log_file) != stored.size())
+    {
+        return false;
+    }
+
+    if (codec == nullptr)
+    {
+        out += stored;
+        return true;
+    }
+
+    return codec->decompress(stored, out);
+}
+
+}  // namespace SimpleCppLogger
@@ -1,16 +1,78 @@
 #include "SimpleCppLogger/LogMessage.h"
 
+#include "SimpleCppLogger/Utf8Conversion.h"
+
 namespace SimpleCppLogger
 {
 /**
  * @brief Constructs a LogMessage object with the given log level and message.
+ *
+ * The creation time is captured here so that formatters and sinks see the time the
+ * message was produced rather than the time it was written.
+ *
  * @param level The log level of the message.
  * @param message The content of the log message.
  */
 LogMessage::LogMessage(LogLevel level, std::string message)
-    : m_level(level), m_message(std::move(message))
+    : m_level(level), m_message(std::move(message)), m_timestamp(Clock::now())
+{}
+
+/**
+ * @brief Constructs a LogMessage object that belongs to a logging category.
+ * @param level The log level of the message.
+ * @param message The content of the log message.
+ * @param category The category name. It is not copied and must outlive the message, which
+ * holds for names owned by a LogCategoryRegistry.
+ */
+LogMessage::LogMessage(LogLevel level, std::string message, std::string_view category)
+    : m_level(level), m_message(std::move(message)), m_timestamp(Clock::now()), m_category(category)
 {}
 
+/**
+ * @brief Constructs a LogMessage object with an explicit source context.
+ *
+ * Used when the origin of a message is not the C++ call site, e.g. for messages forwarded from
+ * a scripting bridge. The context is kept as structured data instead of being appended to the
+ * message text. File and function are owned by the message, since their origin (e.g. a script
+ * frame) usually does not outlive it.
+ *
+ * @param level The log level of the message.
+ * @param message The content of the log message.
+ * @param category The category name. It is not copied and must outlive the message.
+ * @param file The source file.
+ * @param line The source line, or 0 if unknown.
+ * @param function The function name.
+ */
+LogMessage::LogMessage(LogLevel level, std::string message, std::string_view category,
+                       std::string file, std::uint32_t line, std::string function)
+    : m_level(level),
+      m_message(std::move(message)),
+      m_timestamp(Clock::now()),
+      m_category(category),
+      m_file(std::move(file)),
+      m_line(line),
+      m_function(std::move(function))
+{}
+
+/**
+ * @brief Constructs a LogMessage object with a wide-character payload.
+ *
+ * The text is stored as-is. It is converted to UTF-8 only when get_message() is first called,
+ * e.g. by a formatter of a narrow sink.
+ *
+ * @param level The log level of the message.
+ * @param message The wide content of the log message.
+ * @param category The category name. It is not copied and must outlive the message.
+ */
+LogMessage::LogMessage(LogLevel level, std::wstring message, std::string_view category)
+    : m_level(level),
+      m_timestamp(Clock::now()),
+      m_category(category),
+      m_wide(std::make_shared<WidePayload>())
+{
+    m_wide->text = std::move(message);
+}
+
 /**
  * @brief Gets the log level of the log message.
  * @return The log level of the log message.
@@ -22,10 +84,92 @@ auto LogMessage::get_level() const -> LogLevel
 
 /**
  * @brief Gets the content of the log message.
+ *
+ * For wide messages, the UTF-8 form is created on the first call (thread-safe) and cached.
+ *
  * @return The content of the log message.
  */
 auto LogMessage::get_message() const -> const std::string&
 {
+    if (m_wide)
+    {
+        std::call_once(m_wide->converted,
+                       [payload = m_wide.get()] { payload->utf8 = to_utf8(payload->text); });
+        return m_wide->utf8;
+    }
+
     return m_message;
 }
+
+/**
+ * @brief Checks whether the message was created with a wide-character payload.
+ * @return True for wide messages, false otherwise.
+ */
+auto LogMessage::is_wide() const -> bool
+{
+    return m_wide != nullptr;
+}
+
+/**
+ * @brief Gets the wide content of the log message without conversion.
+ * @return The wide content, or an empty view for narrow messages.
+ */
+auto LogMessage::get_wide_message() const -> std::wstring_view
+{
+    return m_wide ? std::wstring_view(m_wide->text) : std::wstring_view();
+}
+
+/**
+ * @brief Gets the time at which the log message was created.
+ * @return The creation timestamp of the log message.
+ */
+auto LogMessage::get_timestamp() const -> Clock::time_point
+{
+    return m_timestamp;
+}
+
+/**
+ * @brief Gets the name of the category the log message belongs to.
+ * @return The category name, or an empty view for uncategorized messages.
+ */
+auto LogMessage::get_category() const -> std::string_view
+{
+    return m_category;
+}
+
+/**
+ * @brief Gets the source file of an explicit source context.
+ * @return The file name, or an empty view if none was given.
+ */
+auto LogMessage::get_file() const -> std::string_view
+{
+    return m_file;
+}
+
+/**
+ * @brief Gets the source line of an explicit source context.
+ * @return The line number, or 0 if none was given.
+ */
+auto LogMessage::get_line() const -> std::uint32_t
+{
+    return m_line;
+}
+
+/**
+ * @brief Gets the function name of an explicit source context.
+ * @return The function name, or an empty view if none was given.
+ */
+auto LogMessage::get_function() const -> std::string_view
+{
+    return m_function;
+}
+
+/**
+ * @brief Checks whether the message carries an explicit source context.
+ * @return True if a file, line or function was given, false otherwise.
+ */
+auto LogMessage::has_source_context() const -> bool
+{
+    return !m_file.empty() || m_line > 0 || !m_function.empty();
+}
 }  // namespace SimpleCppLogger
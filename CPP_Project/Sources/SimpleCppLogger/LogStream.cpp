@@ -3,13 +3,29 @@
 
 #include "SimpleCppLogger/LogStream.h"
 
+#include <utility>
+
 #include "SimpleCppLogger/Logger.h"
 
 namespace SimpleCppLogger
 {
 
 LogStream::LogStream(LogLevel level, std::source_location location)
-    : m_level(level), m_location(location)
+    : m_context(&Logger::get_instance()), m_level(level), m_location(location)
+{}
+
+LogStream::LogStream(const LogCategory& category, LogLevel level, std::source_location location)
+    : m_context(&Logger::get_instance()), m_level(level), m_location(location),
+      m_category(category)
+{}
+
+LogStream::LogStream(LoggerContext& context, LogLevel level, std::source_location location)
+    : m_context(&context), m_level(level), m_location(location)
+{}
+
+LogStream::LogStream(LoggerContext& context, const LogCategory& category, LogLevel level,
+                     std::source_location location)
+    : m_context(&context), m_level(level), m_location(location), m_category(category)
 {}
 
 LogStream& LogStream::operator<<(std::ostream& (*manip)(std::ostream&))
@@ -20,7 +36,14 @@ LogStream& LogStream::operator<<(std::ostream& (*manip)(std::ostream&))
 
 LogStream::~LogStream()
 {
-    Logger::get_instance().log(m_level, m_stream.str(), m_location);
+    if (m_category.is_valid())
+    {
+        m_context->log(m_category, m_level, std::move(m_stream).str(), m_location);
+    }
+    else
+    {
+        m_context->log(m_level, std::move(m_stream).str(), m_location);
+    }
 }
 
 }  // namespace SimpleCppLogger
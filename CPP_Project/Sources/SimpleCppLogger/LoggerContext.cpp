@@ -0,0 +1,749 @@
+#include "SimpleCppLogger/LoggerContext.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "SimpleCppLogger/BacktraceBuffer.h"
+#include "SimpleCppLogger/FormattingPipeline.h"
+#include "SimpleCppLogger/LogAppender.h"
+#include "SimpleCppLogger/LogCategoryRegistry.h"
+#include "SimpleCppLogger/LogLevel.h"
+#include "SimpleCppLogger/LogMessage.h"
+#include "SimpleCppLogger/StagingBackend.h"
+
+namespace SimpleCppLogger
+{
+
+/**
+ * @class LoggerContext::Impl
+ * @brief Internal implementation for LoggerContext (Pimpl idiom).
+ */
+class LoggerContext::Impl
+{
+        /**
+         * @brief The owning string type for a message text: std::string or std::wstring.
+         */
+        template <typename Text>
+        using Payload = std::basic_string<typename std::remove_cvref_t<Text>::value_type>;
+
+    public:
+        Impl(): m_log_level(LogLevel::Debug), m_appender_level(LogLevel::Debug) {}
+
+        ~Impl()
+        {
+            // The backends deliver their remaining records through m_appenders.
+            m_active_backend.store(nullptr, std::memory_order_release);
+            m_backends.clear();
+            m_pipeline.reset();
+
+            // Appenders that queue messages (e.g. AsyncAppender) deliver them when destroyed, and
+            // the messages still refer to category names, so the appenders must go before the
+            // registry.
+            std::vector<std::shared_ptr<LogAppender>> appenders;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                appenders.swap(m_appenders);
+            }
+            appenders.clear();
+        }
+
+        /**
+         * @brief Logs a message. Text is a narrow or wide string view, which is copied once into
+         * the message if the level is enabled, or a string rvalue, which is moved.
+         *
+         * Messages below the logger level are kept in the backtrace buffer if backtrace mode
+         * covers their level.
+         */
+        template <typename Text>
+        auto log(LogLevel level, Text&& message, const std::source_location& location) -> void
+        {
+            if (level < LogLevel::Trace || level >= LogLevel::Count)
+            {
+                return;
+            }
+
+            if (level >= m_log_level.load(std::memory_order_relaxed))
+            {
+                dispatch(LogMessage(level, Payload<Text>(std::forward<Text>(message))), location);
+            }
+            else if (level >= m_backtrace_level.load(std::memory_order_relaxed))
+            {
+                m_backtrace.push(LogMessage(level, Payload<Text>(std::forward<Text>(message))),
+                                 location);
+            }
+        }
+
+        template <typename Text>
+        auto log(const LogCategory& category, LogLevel level, Text&& message,
+                 const std::source_location& location) -> void
+        {
+            if (level < LogLevel::Trace || level >= LogLevel::Count)
+            {
+                return;
+            }
+
+            bool enabled = category.is_valid()
+                               ? category.is_enabled(level)
+                               : level >= m_log_level.load(std::memory_order_relaxed);
+
+            if (enabled)
+            {
+                dispatch(LogMessage(level, Payload<Text>(std::forward<Text>(message)),
+                                    category.get_name()),
+                         location);
+            }
+            else if (level >= m_backtrace_level.load(std::memory_order_relaxed))
+            {
+                m_backtrace.push(LogMessage(level, Payload<Text>(std::forward<Text>(message)),
+                                            category.get_name()),
+                                 location);
+            }
+        }
+
+        /**
+         * @brief Logs a message with an explicit source context.
+         *
+         * The category is interned through the registry, so its threshold applies and its name
+         * outlives the message. File and function are copied into the message, since a backend,
+         * the backtrace buffer or an appender's queue (e.g. AsyncAppender) may keep it after this
+         * call returns.
+         */
+        auto log(LogLevel level, const std::string& message, std::string_view file, int line,
+                 std::string_view function, std::string_view category) -> void
+        {
+            if (level < LogLevel::Trace || level >= LogLevel::Count)
+            {
+                return;
+            }
+
+            const LogCategory handle =
+                category.empty() ? LogCategory() : m_categories.get_or_register(category);
+            const bool enabled = handle.get_id() != 0
+                                     ? handle.is_enabled(level)
+                                     : level >= m_log_level.load(std::memory_order_relaxed);
+
+            if (!enabled)
+            {
+                if (level >= m_backtrace_level.load(std::memory_order_relaxed))
+                {
+                    m_backtrace.push(LogMessage(level, message, handle.get_name(),
+                                                std::string(file), static_cast<std::uint32_t>(line),
+                                                std::string(function)),
+                                     std::source_location{});
+                }
+                return;
+            }
+
+            dispatch(LogMessage(level, message, handle.get_name(), std::string(file),
+                                static_cast<std::uint32_t>(line), std::string(function)),
+                     std::source_location{});
+        }
+
+        auto add_appender(const std::shared_ptr<LogAppender>& appender) -> void
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_appenders.push_back(appender);
+        }
+
+        auto clear_appenders() -> void
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_appenders.clear();
+        }
+
+        auto set_log_level(LogLevel level) -> void
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_log_level.store(level, std::memory_order_relaxed);
+            m_categories.set_default_level(level);
+            apply_appender_level(get_lowest_level());
+        }
+
+        auto get_log_level() const -> LogLevel
+        {
+            return m_log_level.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Hands everything logged so far to the appenders, then flushes them and calls
+         * the callback once the last one is done.
+         */
+        auto flush(FlushCallback callback, FlushMode mode) -> void
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_backend_mutex);
+                StagingBackend* backend = m_active_backend.load(std::memory_order_acquire);
+
+                if (backend != nullptr)
+                {
+                    backend->drain();
+                    if (m_pipeline)
+                    {
+                        m_pipeline->wait_idle();
+                    }
+                }
+            }
+
+            std::vector<std::shared_ptr<LogAppender>> appenders;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                appenders = m_appenders;
+            }
+
+            struct FlushState {
+                    std::atomic<std::size_t> remaining{0};
+                    std::atomic<bool> success{true};
+                    FlushCallback callback;
+            };
+
+            auto state = std::make_shared<FlushState>();
+            state->remaining.store(appenders.size() + 1, std::memory_order_relaxed);
+            state->callback = std::move(callback);
+
+            auto done = [state](bool success) {
+                if (!success)
+                {
+                    state->success.store(false, std::memory_order_relaxed);
+                }
+                if (state->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                {
+                    state->callback(state->success.load(std::memory_order_relaxed));
+                }
+            };
+
+            for (const auto& appender: appenders)
+            {
+                if (appender)
+                {
+                    appender->flush(done, mode);
+                }
+                else
+                {
+                    done(true);
+                }
+            }
+
+            // Keeps the callback from running before every appender has been asked.
+            done(true);
+        }
+
+        auto is_enabled(LogLevel level) const -> bool
+        {
+            return level >= LogLevel::Trace && level < LogLevel::Count &&
+                   level >= std::min(m_log_level.load(std::memory_order_relaxed),
+                                     m_backtrace_level.load(std::memory_order_relaxed));
+        }
+
+        auto enable_backtrace(std::size_t capacity, LogLevel level) -> void
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_backtrace.reset(capacity);
+            m_backtrace_level.store(capacity > 0 ? level : LogLevel::Count,
+                                    std::memory_order_relaxed);
+            update_appender_level();
+        }
+
+        auto disable_backtrace() -> void
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_backtrace_level.store(LogLevel::Count, std::memory_order_relaxed);
+            m_backtrace.reset(0);
+            update_appender_level();
+        }
+
+        auto is_backtrace_enabled() const -> bool
+        {
+            return m_backtrace_level.load(std::memory_order_relaxed) != LogLevel::Count;
+        }
+
+        auto dump_backtrace() -> void
+        {
+            dump_backtrace(m_active_backend.load(std::memory_order_acquire));
+        }
+
+        auto get_category(std::string_view name) -> LogCategory
+        {
+            return m_categories.get_or_register(name);
+        }
+
+        auto set_category_level(const LogCategory& category, LogLevel level) -> void
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_categories.set_level(category, level);
+            update_appender_level();
+        }
+
+        auto reset_category_level(const LogCategory& category) -> void
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_categories.reset_level(category);
+            update_appender_level();
+        }
+
+        auto get_category_level(const LogCategory& category) const -> LogLevel
+        {
+            return m_categories.get_level(category);
+        }
+
+        auto start_backend(const BackendOptions& options) -> void
+        {
+            std::lock_guard<std::mutex> lock(m_backend_mutex);
+
+            if (m_active_backend.load(std::memory_order_relaxed) != nullptr)
+            {
+                return;
+            }
+
+            // Producers may still hold a pointer to a stopped backend, so backends are kept
+            // alive until the context is destroyed.
+            if (m_backends.empty() || m_backends.back()->get_options() != options)
+            {
+                m_backends.push_back(std::make_unique<StagingBackend>(
+                    options, [this](std::vector<StagedRecord>& records) { deliver(records); }));
+            }
+
+            m_active_options = options;
+            if (options.formatting_threads > 0)
+            {
+                m_pipeline = std::make_unique<FormattingPipeline>(
+                    options.formatting_threads, options.formatting_threads * 4,
+                    [this](FormattingTask& task) { write(task); });
+            }
+
+            m_backends.back()->start();
+            m_active_backend.store(m_backends.back().get(), std::memory_order_release);
+        }
+
+        auto stop_backend() -> void
+        {
+            std::lock_guard<std::mutex> lock(m_backend_mutex);
+            StagingBackend* backend = m_active_backend.exchange(nullptr, std::memory_order_acq_rel);
+
+            if (backend != nullptr)
+            {
+                backend->stop();
+                m_pipeline.reset();
+            }
+        }
+
+        auto is_backend_running() const -> bool
+        {
+            return m_active_backend.load(std::memory_order_acquire) != nullptr;
+        }
+
+    private:
+        /**
+         * @brief Stages the message if the backend is running, delivers it directly otherwise.
+         */
+        auto dispatch(LogMessage&& log_message, const std::source_location& location) -> void
+        {
+            StagingBackend* backend = m_active_backend.load(std::memory_order_acquire);
+
+            if (log_message.get_level() >= BacktraceTrigger && is_backtrace_enabled())
+            {
+                dump_backtrace(backend);
+            }
+
+            if (backend != nullptr)
+            {
+                backend->submit(std::move(log_message), location);
+                return;
+            }
+
+            deliver(log_message, location);
+        }
+
+        /**
+         * @brief Delivers the backtrace buffer ahead of the message that triggered it.
+         *
+         * The records keep their original timestamps, so the backend merges them in order.
+         */
+        auto dump_backtrace(StagingBackend* backend) -> void
+        {
+            std::vector<StagedRecord> records;
+            if (m_backtrace.take_all(records) == 0)
+            {
+                return;
+            }
+
+            if (backend == nullptr)
+            {
+                deliver(records);
+                return;
+            }
+
+            for (auto& record: records)
+            {
+                backend->submit(std::move(record.message), record.location);
+            }
+        }
+
+        /**
+         * @brief Delivers a merged batch from the backend to all appenders.
+         *
+         * Without formatting workers, each appender receives the whole batch with one
+         * append_batch() call.
+         *
+         * With formatting workers, the batch is split into tasks that carry a snapshot of the
+         * appenders and their levels; the pipeline formats them in parallel and calls write()
+         * in order. The tasks are submitted after m_mutex is released because the writer needs
+         * it.
+         */
+        auto deliver(std::vector<StagedRecord>& records) -> void
+        {
+            if (m_pipeline)
+            {
+                for (auto& task: make_tasks(records))
+                {
+                    m_pipeline->submit(std::move(task));
+                }
+                return;
+            }
+
+            // Declared before the lock, so durable appenders are waited for after it is
+            // released and other threads can append to the same group commit meanwhile.
+            const DurableWaitScope durable_waits;
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for (const auto& appender: m_appenders)
+            {
+                if (appender)
+                {
+                    appender->append_batch(records);
+                }
+            }
+        }
+
+        auto make_tasks(std::vector<StagedRecord>& records) -> std::vector<FormattingTask>
+        {
+            const std::size_t chunk =
+                std::max<std::size_t>(m_active_options.records_per_task, 1);
+            std::vector<FormattingTask> tasks;
+
+            std::lock_guard<std::mutex> lock(m_mutex);
+            std::vector<LogLevel> levels;
+            for (const auto& appender: m_appenders)
+            {
+                levels.push_back(appender ? appender->get_log_level() : LogLevel::Count);
+            }
+
+            for (std::size_t begin = 0; begin < records.size(); begin += chunk)
+            {
+                const std::size_t end = std::min(records.size(), begin + chunk);
+                FormattingTask& task = tasks.emplace_back();
+                task.records.assign(std::make_move_iterator(records.begin() + begin),
+                                    std::make_move_iterator(records.begin() + end));
+                task.appenders = m_appenders;
+                task.levels = levels;
+            }
+
+            return tasks;
+        }
+
+        /**
+         * @brief Emits a formatted task to its appenders. Called on the pipeline's writer thread.
+         */
+        auto write(FormattingTask& task) -> void
+        {
+            const DurableWaitScope durable_waits;
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for (std::size_t record = 0; record < task.records.size(); ++record)
+            {
+                const StagedRecord& staged = task.records[record];
+
+                for (std::size_t appender = 0; appender < task.appenders.size(); ++appender)
+                {
+                    const auto& target = task.appenders[appender];
+
+                    if (!target || staged.message.get_level() < task.levels[appender])
+                    {
+                        continue;
+                    }
+
+                    if (task.formatted[appender].empty())
+                    {
+                        target->append(staged.message, staged.location);
+                    }
+                    else
+                    {
+                        target->append_formatted(staged.message, staged.location,
+                                                 std::move(task.formatted[appender][record]));
+                    }
+                }
+            }
+        }
+
+        auto deliver(const LogMessage& log_message, const std::source_location& location)
+            -> void
+        {
+            const DurableWaitScope durable_waits;
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for (const auto& appender: m_appenders)
+            {
+                if (appender)
+                {
+                    appender->append(log_message, location);
+                }
+            }
+        }
+
+        /**
+         * @brief Sets the level of all appenders. The caller must hold m_mutex.
+         */
+        auto apply_appender_level(LogLevel level) -> void
+        {
+            m_appender_level = level;
+            for (const auto& appender: m_appenders)
+            {
+                if (appender)
+                {
+                    appender->set_log_level(level);
+                }
+            }
+        }
+
+        /**
+         * @brief Returns the lowest level that can reach the appenders: the logger level, the
+         * most verbose category or the backtrace level.
+         */
+        auto get_lowest_level() const -> LogLevel
+        {
+            return std::min({m_log_level.load(std::memory_order_relaxed),
+                             m_categories.get_lowest_level(),
+                             m_backtrace_level.load(std::memory_order_relaxed)});
+        }
+
+        /**
+         * @brief Lowers or restores the appender levels after a category threshold or the
+         * backtrace level changed so that the most verbose messages still reach them. The
+         * caller must hold m_mutex.
+         */
+        auto update_appender_level() -> void
+        {
+            const LogLevel level = get_lowest_level();
+            if (level != m_appender_level)
+            {
+                apply_appender_level(level);
+            }
+        }
+
+        mutable std::mutex m_mutex;
+        std::vector<std::shared_ptr<LogAppender>> m_appenders;
+        std::atomic<LogLevel> m_log_level;
+        LogLevel m_appender_level;
+        LogCategoryRegistry m_categories;
+
+        static constexpr LogLevel BacktraceTrigger = LogLevel::Error;
+        std::atomic<LogLevel> m_backtrace_level{LogLevel::Count};  ///< Count while disabled.
+        BacktraceBuffer m_backtrace;
+
+        std::mutex m_backend_mutex;
+        std::vector<std::unique_ptr<StagingBackend>> m_backends;
+        std::atomic<StagingBackend*> m_active_backend{nullptr};
+        BackendOptions m_active_options;
+        std::unique_ptr<FormattingPipeline> m_pipeline;
+};
+
+LoggerContext::LoggerContext(): m_impl(std::make_unique<Impl>()) {}
+
+LoggerContext::~LoggerContext() = default;
+
+auto LoggerContext::log(LogLevel level, const std::string& message,
+                        const std::source_location& location) -> void
+{
+    m_impl->log(level, std::string_view(message), location);
+}
+
+auto LoggerContext::log(LogLevel level, std::string_view message,
+                        const std::source_location& location) -> void
+{
+    m_impl->log(level, message, location);
+}
+
+auto LoggerContext::log(LogLevel level, const char* message,
+                        const std::source_location& location) -> void
+{
+    m_impl->log(level, std::string_view(message != nullptr ? message : ""), location);
+}
+
+auto LoggerContext::log(LogLevel level, std::string&& message,
+                        const std::source_location& location) -> void
+{
+    m_impl->log(level, std::move(message), location);
+}
+
+auto LoggerContext::log(LogLevel level, std::wstring_view message,
+                        const std::source_location& location) -> void
+{
+    m_impl->log(level, message, location);
+}
+
+auto LoggerContext::log(LogLevel level, const wchar_t* message,
+                        const std::source_location& location) -> void
+{
+    m_impl->log(level, std::wstring_view(message != nullptr ? message : L""), location);
+}
+
+auto LoggerContext::log(LogLevel level, std::wstring&& message,
+                        const std::source_location& location) -> void
+{
+    m_impl->log(level, std::move(message), location);
+}
+
+auto LoggerContext::log(LogLevel level, const std::string& message, const char* file, int line,
+                        const char* function, const char* category) -> void
+{
+    m_impl->log(level, message, file != nullptr ? file : "", line > 0 ? line : 0,
+                function != nullptr ? function : "", category != nullptr ? category : "");
+}
+
+auto LoggerContext::log(const LogCategory& category, LogLevel level, const std::string& message,
+                        const std::source_location& location) -> void
+{
+    m_impl->log(category, level, std::string_view(message), location);
+}
+
+auto LoggerContext::log(const LogCategory& category, LogLevel level, std::string_view message,
+                        const std::source_location& location) -> void
+{
+    m_impl->log(category, level, message, location);
+}
+
+auto LoggerContext::log(const LogCategory& category, LogLevel level, const char* message,
+                        const std::source_location& location) -> void
+{
+    m_impl->log(category, level, std::string_view(message != nullptr ? message : ""), location);
+}
+
+auto LoggerContext::log(const LogCategory& category, LogLevel level, std::string&& message,
+                        const std::source_location& location) -> void
+{
+    m_impl->log(category, level, std::move(message), location);
+}
+
+auto LoggerContext::log(const LogCategory& category, LogLevel level, std::wstring_view message,
+                        const std::source_location& location) -> void
+{
+    m_impl->log(category, level, message, location);
+}
+
+auto LoggerContext::log(const LogCategory& category, LogLevel level, const wchar_t* message,
+                        const std::source_location& location) -> void
+{
+    m_impl->log(category, level, std::wstring_view(message != nullptr ? message : L""), location);
+}
+
+auto LoggerContext::log(const LogCategory& category, LogLevel level, std::wstring&& message,
+                        const std::source_location& location) -> void
+{
+    m_impl->log(category, level, std::move(message), location);
+}
+
+auto LoggerContext::get_category(std::string_view name) -> LogCategory
+{
+    return m_impl->get_category(name);
+}
+
+auto LoggerContext::set_category_level(const LogCategory& category, LogLevel level) -> void
+{
+    m_impl->set_category_level(category, level);
+}
+
+auto LoggerContext::reset_category_level(const LogCategory& category) -> void
+{
+    m_impl->reset_category_level(category);
+}
+
+auto LoggerContext::get_category_level(const LogCategory& category) const -> LogLevel
+{
+    return m_impl->get_category_level(category);
+}
+
+auto LoggerContext::add_appender(const std::shared_ptr<LogAppender>& appender) -> void
+{
+    m_impl->add_appender(appender);
+}
+
+auto LoggerContext::clear_appenders() -> void
+{
+    m_impl->clear_appenders();
+}
+
+auto LoggerContext::set_log_level(LogLevel level) -> void
+{
+    m_impl->set_log_level(level);
+}
+
+auto LoggerContext::get_log_level() const -> LogLevel
+{
+    return m_impl->get_log_level();
+}
+
+auto LoggerContext::is_enabled(LogLevel level) const -> bool
+{
+    return m_impl->is_enabled(level);
+}
+
+auto LoggerContext::flush(FlushMode mode) -> std::future<bool>
+{
+    auto promise = std::make_shared<std::promise<bool>>();
+    std::future<bool> result = promise->get_future();
+    m_impl->flush([promise](bool success) { promise->set_value(success); }, mode);
+    return result;
+}
+
+auto LoggerContext::flush(FlushCallback callback, FlushMode mode) -> void
+{
+    if (!callback)
+    {
+        callback = [](bool /*success*/) {};
+    }
+
+    m_impl->flush(std::move(callback), mode);
+}
+
+auto LoggerContext::enable_backtrace(std::size_t capacity, LogLevel level) -> void
+{
+    m_impl->enable_backtrace(capacity, level);
+}
+
+auto LoggerContext::disable_backtrace() -> void
+{
+    m_impl->disable_backtrace();
+}
+
+auto LoggerContext::is_backtrace_enabled() const -> bool
+{
+    return m_impl->is_backtrace_enabled();
+}
+
+auto LoggerContext::dump_backtrace() -> void
+{
+    m_impl->dump_backtrace();
+}
+
+auto LoggerContext::start_backend(const BackendOptions& options) -> void
+{
+    m_impl->start_backend(options);
+}
+
+auto LoggerContext::stop_backend() -> void
+{
+    m_impl->stop_backend();
+}
+
+auto LoggerContext::is_backend_running() const -> bool
+{
+    return m_impl->is_backend_running();
+}
+
+}  // namespace SimpleCppLogger
@@ -0,0 +1,193 @@
+#include "SimpleCppLogger/MemoryAppender.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <utility>
+
+namespace SimpleCppLogger
+{
+
+/**
+ * @struct MemoryAppender::Slot
+ * @brief The header of one ring slot. The text lives in the shared word array.
+ *
+ * version is 2 * position + 2 once the record at that position is complete and odd while a
+ * writer fills the slot. All fields are atomics, so readers racing with a writer see stale or
+ * mixed values but never cause undefined behavior; the version check discards such copies.
+ */
+struct alignas(64) MemoryAppender::Slot {
+        std::atomic<std::uint64_t> version{0};
+        std::atomic<std::uint64_t> header{0};  ///< Level in the low byte, length above it.
+        std::atomic<std::int64_t> timestamp{0};
+};
+
+namespace
+{
+constexpr std::size_t WordSize = sizeof(std::uint64_t);
+
+auto pack_header(LogLevel level, std::size_t length) -> std::uint64_t
+{
+    return static_cast<std::uint64_t>(level) | (static_cast<std::uint64_t>(length) << 8);
+}
+}  // namespace
+
+/**
+ * @brief Constructs a MemoryAppender object.
+ *
+ * @param capacity The number of records kept, rounded up to a power of two.
+ * @param record_size The maximum number of bytes of text kept per record.
+ * @param formatter The formatter to apply, or nullptr to keep the raw message text.
+ */
+MemoryAppender::MemoryAppender(std::size_t capacity, std::size_t record_size,
+                               const std::shared_ptr<LogFormatter>& formatter)
+    : LogAppender(formatter),
+      m_capacity(std::bit_ceil(std::max<std::size_t>(capacity, 1))),
+      m_record_size(record_size),
+      m_words_per_slot((record_size + WordSize - 1) / WordSize),
+      m_slots(std::make_unique<Slot[]>(m_capacity)),
+      m_words(std::make_unique<std::atomic<std::uint64_t>[]>(m_capacity * m_words_per_slot))
+{}
+
+MemoryAppender::~MemoryAppender() = default;
+
+auto MemoryAppender::supports_preformatted() const -> bool
+{
+    return true;
+}
+
+auto MemoryAppender::internal_append(const LogMessage& message,
+                                     const std::source_location& location) -> void
+{
+    if (m_formatter)
+    {
+        store(message, m_formatter->format(message, location));
+    }
+    else
+    {
+        store(message, message.get_message());
+    }
+}
+
+auto MemoryAppender::internal_append_formatted(const LogMessage& message,
+                                               const std::source_location&,
+                                               std::string&& formatted) -> void
+{
+    store(message, formatted);
+}
+
+/**
+ * @brief Copies a record into the slot of the next position.
+ *
+ * The slot is claimed by moving its version from the even value of an older position to the
+ * odd value of this one. If another writer holds the slot or has already stored a newer
+ * position, the record is dropped.
+ */
+auto MemoryAppender::store(const LogMessage& message, std::string_view text) -> void
+{
+    const std::uint64_t position = m_next.fetch_add(1, std::memory_order_relaxed);
+    Slot& slot = m_slots[position & (m_capacity - 1)];
+    const std::uint64_t writing = 2 * position + 1;
+
+    std::uint64_t version = slot.version.load(std::memory_order_relaxed);
+    if ((version & 1) != 0 || version > writing ||
+        !slot.version.compare_exchange_strong(version, writing, std::memory_order_relaxed))
+    {
+        m_dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    std::atomic_thread_fence(std::memory_order_release);
+
+    const std::size_t length = std::min(text.size(), m_record_size);
+    std::atomic<std::uint64_t>* words = &m_words[(position & (m_capacity - 1)) * m_words_per_slot];
+
+    for (std::size_t offset = 0, word = 0; offset < length; offset += WordSize, ++word)
+    {
+        std::uint64_t value = 0;
+        std::memcpy(&value, text.data() + offset, std::min(WordSize, length - offset));
+        words[word].store(value, std::memory_order_relaxed);
+    }
+
+    slot.header.store(pack_header(message.get_level(), length), std::memory_order_relaxed);
+    slot.timestamp.store(message.get_timestamp().time_since_epoch().count(),
+                         std::memory_order_relaxed);
+    slot.version.store(writing + 1, std::memory_order_release);
+}
+
+auto MemoryAppender::snapshot() const -> std::vector<MemoryRecord>
+{
+    const std::uint64_t end = m_next.load(std::memory_order_acquire);
+    const std::uint64_t begin = end > m_capacity ? end - m_capacity : 0;
+
+    std::vector<MemoryRecord> records;
+    records.reserve(static_cast<std::size_t>(end - begin));
+
+    for (std::uint64_t position = begin; position < end; ++position)
+    {
+        const Slot& slot = m_slots[position & (m_capacity - 1)];
+        const std::uint64_t complete = 2 * position + 2;
+
+        if (slot.version.load(std::memory_order_acquire) != complete)
+        {
+            continue;
+        }
+
+        const std::uint64_t header = slot.header.load(std::memory_order_relaxed);
+        const std::int64_t timestamp = slot.timestamp.load(std::memory_order_relaxed);
+        const std::size_t length = std::min<std::size_t>(header >> 8, m_record_size);
+        const std::atomic<std::uint64_t>* words =
+            &m_words[(position & (m_capacity - 1)) * m_words_per_slot];
+
+        std::string text(length, '\0');
+        for (std::size_t offset = 0, word = 0; offset < length; offset += WordSize, ++word)
+        {
+            const std::uint64_t value = words[word].load(std::memory_order_relaxed);
+            std::memcpy(text.data() + offset, &value, std::min(WordSize, length - offset));
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.version.load(std::memory_order_relaxed) != complete)
+        {
+            continue;
+        }
+
+        records.push_back(MemoryRecord{
+            position, static_cast<LogLevel>(header & 0xFF),
+            LogMessage::Clock::time_point(LogMessage::Clock::duration(timestamp)),
+            std::move(text)});
+    }
+
+    return records;
+}
+
+auto MemoryAppender::get_texts() const -> std::vector<std::string>
+{
+    std::vector<std::string> texts;
+    for (auto& record: snapshot())
+    {
+        texts.push_back(std::move(record.text));
+    }
+    return texts;
+}
+
+auto MemoryAppender::get_capacity() const -> std::size_t
+{
+    return m_capacity;
+}
+
+auto MemoryAppender::get_record_size() const -> std::size_t
+{
+    return m_record_size;
+}
+
+auto MemoryAppender::get_total_count() const -> std::uint64_t
+{
+    return m_next.load(std::memory_order_relaxed);
+}
+
+auto MemoryAppender::get_dropped_count() const -> std::uint64_t
+{
+    return m_dropped.load(std::memory_order_relaxed);
+}
+
+}  // namespace SimpleCppLogger
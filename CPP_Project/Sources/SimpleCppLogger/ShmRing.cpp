@@ -0,0 +1,323 @@
+#include "SimpleCppLogger/ShmRing.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace SimpleCppLogger
+{
+
+/**
+ * @struct ShmRing::Header
+ * @brief The layout at the start of the shared-memory object.
+ *
+ * The producer and the reader write to separate cache lines. ready is set last when a ring is
+ * created, so a process that attaches concurrently never sees a half-initialized header.
+ */
+struct ShmRing::Header {
+        std::atomic<std::uint32_t> ready;
+        std::uint32_t version;
+        std::uint64_t capacity;
+        alignas(64) std::atomic<std::uint64_t> write_position;
+        std::atomic<std::uint64_t> dropped;
+        alignas(64) std::atomic<std::uint64_t> read_position;
+};
+
+namespace
+{
+constexpr std::uint32_t RingMagic = 0x53434C52;  // "SCLR"
+constexpr std::uint32_t RingVersion = 1;
+constexpr std::size_t RecordAlignment = 16;
+constexpr std::uint16_t PaddingFlag = 1;
+
+/**
+ * @brief The header in front of each record in the data area.
+ */
+struct RecordHeader {
+        std::uint32_t size;
+        std::uint16_t level;
+        std::uint16_t flags;
+        std::int64_t timestamp;
+};
+
+static_assert(sizeof(RecordHeader) == RecordAlignment);
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free,
+              "The ring positions must be address-free atomics");
+
+constexpr auto align_record(std::size_t size) -> std::size_t
+{
+    return (size + RecordAlignment - 1) & ~(RecordAlignment - 1);
+}
+}  // namespace
+
+/**
+ * @brief The size reserved for the ring header in front of the data area.
+ */
+constexpr std::size_t HeaderSize = 256;
+
+#ifndef _WIN32
+
+ShmRing::ShmRing(const std::string& name, std::size_t capacity)
+{
+    const int fd = ::shm_open(name.c_str(), capacity > 0 ? O_RDWR | O_CREAT : O_RDWR, 0600);
+    if (fd < 0)
+    {
+        return;
+    }
+
+    struct stat info{};
+    if (::fstat(fd, &info) != 0)
+    {
+        ::close(fd);
+        return;
+    }
+
+    std::size_t size = static_cast<std::size_t>(info.st_size);
+    const bool created = size == 0;
+
+    if (created)
+    {
+        if (capacity == 0)
+        {
+            ::close(fd);
+            return;
+        }
+
+        size = HeaderSize + std::bit_ceil(std::max(capacity, MinCapacity));
+        if (::ftruncate(fd, static_cast<off_t>(size)) != 0)
+        {
+            ::close(fd);
+            return;
+        }
+    }
+
+    void* mapping = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+
+    if (mapping == MAP_FAILED)
+    {
+        return;
+    }
+
+    auto* header = static_cast<Header*>(mapping);
+
+    if (created)
+    {
+        header->version = RingVersion;
+        header->capacity = size - HeaderSize;
+        header->write_position.store(0, std::memory_order_relaxed);
+        header->dropped.store(0, std::memory_order_relaxed);
+        header->read_position.store(0, std::memory_order_relaxed);
+        header->ready.store(RingMagic, std::memory_order_release);
+    }
+    else if (size < HeaderSize || header->ready.load(std::memory_order_acquire) != RingMagic ||
+             header->version != RingVersion || header->capacity != size - HeaderSize ||
+             !std::has_single_bit(header->capacity))
+    {
+        ::munmap(mapping, size);
+        return;
+    }
+
+    m_header = header;
+    m_mapped_size = size;
+}
+
+ShmRing::~ShmRing()
+{
+    if (m_header != nullptr)
+    {
+        ::munmap(m_header, m_mapped_size);
+    }
+}
+
+auto ShmRing::remove(const std::string& name) -> bool
+{
+    return ::shm_unlink(name.c_str()) == 0;
+}
+
+#else
+
+ShmRing::ShmRing(const std::string&, std::size_t) {}
+
+ShmRing::~ShmRing() = default;
+
+auto ShmRing::remove(const std::string&) -> bool
+{
+    return false;
+}
+
+#endif
+
+auto ShmRing::is_open() const -> bool
+{
+    return m_header != nullptr;
+}
+
+auto ShmRing::data() const -> unsigned char*
+{
+    static_assert(sizeof(Header) <= HeaderSize);
+    return reinterpret_cast<unsigned char*>(m_header) + HeaderSize;
+}
+
+/**
+ * @brief Writes a record. Must only be called by one producer at a time.
+ *
+ * The record is copied first; the write position is advanced with release semantics afterwards.
+ * If the record would cross the end of the data area, a padding record is published first so
+ * that the record can start at offset 0 once the reader has freed that space.
+ */
+auto ShmRing::write(LogLevel level, LogMessage::Clock::time_point timestamp,
+                    std::string_view text, ShmOverflowPolicy policy,
+                    std::chrono::milliseconds timeout) -> bool
+{
+    if (m_header == nullptr)
+    {
+        return false;
+    }
+
+    const std::uint64_t capacity = m_header->capacity;
+    text = text.substr(0, get_max_record_size());
+
+    const std::uint64_t record_size = align_record(sizeof(RecordHeader) + text.size());
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    unsigned char* base = data();
+
+    for (;;)
+    {
+        const std::uint64_t position = m_header->write_position.load(std::memory_order_relaxed);
+        const std::uint64_t offset = position & (capacity - 1);
+        const std::uint64_t tail = capacity - offset;
+        const std::uint64_t free =
+            capacity - (position - m_header->read_position.load(std::memory_order_acquire));
+
+        if (record_size > tail && free >= tail)
+        {
+            const RecordHeader filler{static_cast<std::uint32_t>(tail - sizeof(RecordHeader)),
+                                      0, PaddingFlag, 0};
+            std::memcpy(base + offset, &filler, sizeof(filler));
+            m_header->write_position.store(position + tail, std::memory_order_release);
+            continue;
+        }
+
+        if (record_size <= tail && free >= record_size)
+        {
+            const RecordHeader record{
+                static_cast<std::uint32_t>(text.size()), static_cast<std::uint16_t>(level), 0,
+                static_cast<std::int64_t>(timestamp.time_since_epoch().count())};
+            std::memcpy(base + offset, &record, sizeof(record));
+            std::memcpy(base + offset + sizeof(record), text.data(), text.size());
+            m_header->write_position.store(position + record_size, std::memory_order_release);
+            return true;
+        }
+
+        if (policy == ShmOverflowPolicy::Drop || std::chrono::steady_clock::now() >= deadline)
+        {
+            m_header->dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        std::this_thread::yield();
+    }
+}
+
+/**
+ * @brief Passes all published records to the callback in one batch and then releases their
+ * space.
+ *
+ * The views point into the mapping; the read position is only advanced after the callback has
+ * returned, so the producer cannot overwrite them in the meantime.
+ *
+ * The positions and record headers are written by another process, so they are checked against
+ * the mapping before use: reading stops at a record that is misaligned, would cross the end of
+ * the data area or extends past the write position.
+ */
+auto ShmRing::read(const std::function<bool(std::span<const ShmRecordView>)>& callback)
+    -> std::size_t
+{
+    if (m_header == nullptr)
+    {
+        return 0;
+    }
+
+    // The mapped size was validated on attach; the capacity in the header may change since.
+    const std::uint64_t capacity = m_mapped_size - HeaderSize;
+    const std::uint64_t end = m_header->write_position.load(std::memory_order_acquire);
+    std::uint64_t position = m_header->read_position.load(std::memory_order_relaxed);
+    const unsigned char* base = data();
+    std::vector<ShmRecordView> records;
+
+    if (end < position || end - position > capacity)
+    {
+        return 0;
+    }
+
+    while (position < end && position % RecordAlignment == 0)
+    {
+        const std::uint64_t offset = position & (capacity - 1);
+        RecordHeader record{};
+        std::memcpy(&record, base + offset, sizeof(record));
+
+        const std::uint64_t record_size = align_record(sizeof(record) + record.size);
+        if (record_size > capacity - offset || record_size > end - position)
+        {
+            break;
+        }
+
+        if ((record.flags & PaddingFlag) == 0)
+        {
+            const auto* text = reinterpret_cast<const char*>(base + offset + sizeof(record));
+            records.push_back(ShmRecordView{
+                static_cast<LogLevel>(record.level),
+                LogMessage::Clock::time_point(LogMessage::Clock::duration(record.timestamp)),
+                std::string_view(text, record.size)});
+        }
+
+        position += record_size;
+    }
+
+    if (!records.empty() && !callback(records))
+    {
+        return 0;
+    }
+
+    m_header->read_position.store(position, std::memory_order_release);
+    return records.size();
+}
+
+auto ShmRing::get_capacity() const -> std::size_t
+{
+    return m_header != nullptr ? static_cast<std::size_t>(m_header->capacity) : 0;
+}
+
+auto ShmRing::get_max_record_size() const -> std::size_t
+{
+    return m_header != nullptr ? get_capacity() / 2 - sizeof(RecordHeader) : 0;
+}
+
+auto ShmRing::get_pending_bytes() const -> std::size_t
+{
+    if (m_header == nullptr)
+    {
+        return 0;
+    }
+
+    return static_cast<std::size_t>(m_header->write_position.load(std::memory_order_acquire) -
+                                     m_header->read_position.load(std::memory_order_acquire));
+}
+
+auto ShmRing::get_dropped_count() const -> std::uint64_t
+{
+    return m_header != nullptr ? m_header->dropped.load(std::memory_order_relaxed) : 0;
+}
+
+}  // namespace SimpleCppLogger
@@ -0,0 +1,77 @@
+#include "SimpleCppLogger/ShmRingAppender.h"
+
+namespace SimpleCppLogger
+{
+
+/**
+ * @brief Creates or attaches to the ring with the given name.
+ *
+ * @param name The shared-memory object name, starting with '/'.
+ * @param options The ring configuration.
+ * @param formatter The LogFormatter to use.
+ */
+ShmRingAppender::ShmRingAppender(const std::string& name, const ShmRingAppenderOptions& options,
+                                 const std::shared_ptr<LogFormatter>& formatter)
+    : LogAppender(formatter), m_name(name), m_options(options), m_ring(name, options.capacity)
+{}
+
+/**
+ * @brief Unmaps the ring and removes it if remove_on_destroy is set.
+ */
+ShmRingAppender::~ShmRingAppender()
+{
+    if (m_options.remove_on_destroy)
+    {
+        ShmRing::remove(m_name);
+    }
+}
+
+auto ShmRingAppender::is_open() const -> bool
+{
+    return m_ring.is_open();
+}
+
+auto ShmRingAppender::get_name() const -> const std::string&
+{
+    return m_name;
+}
+
+auto ShmRingAppender::get_dropped_count() const -> std::uint64_t
+{
+    return m_ring.get_dropped_count();
+}
+
+auto ShmRingAppender::supports_preformatted() const -> bool
+{
+    return true;
+}
+
+/**
+ * @brief Formats the message and writes it into the ring.
+ *
+ * @param message The log message to append.
+ * @param location The source location of the log message.
+ */
+auto ShmRingAppender::internal_append(const LogMessage& message,
+                                      const std::source_location& location) -> void
+{
+    internal_append_formatted(message, location, format(message, location));
+}
+
+/**
+ * @brief Writes already formatted text into the ring, applying the overflow policy.
+ *
+ * @param message The log message to append.
+ * @param location The source location of the log message.
+ * @param formatted The formatted text.
+ */
+auto ShmRingAppender::internal_append_formatted(const LogMessage& message,
+                                                const std::source_location& /*location*/,
+                                                std::string&& formatted) -> void
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_ring.write(message.get_level(), message.get_timestamp(), formatted,
+                 m_options.overflow_policy, m_options.block_timeout);
+}
+
+}  // namespace SimpleCppLogger
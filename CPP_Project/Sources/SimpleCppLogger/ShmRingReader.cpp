@@ -0,0 +1,147 @@
+#include "SimpleCppLogger/ShmRingReader.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <climits>
+#endif
+
+namespace SimpleCppLogger
+{
+
+namespace
+{
+#ifndef _WIN32
+#ifdef IOV_MAX
+constexpr std::size_t MaxIovecs = IOV_MAX;
+#else
+constexpr std::size_t MaxIovecs = 1024;
+#endif
+
+/**
+ * @brief Writes all iovecs to the descriptor, retrying on EINTR and partial writes.
+ * @return False if writing failed.
+ */
+auto writev_all(int fd, iovec* iov, std::size_t count) -> bool
+{
+    while (count > 0)
+    {
+        const auto batch = static_cast<int>(std::min(count, MaxIovecs));
+        const ssize_t written = ::writev(fd, iov, batch);
+
+        if (written < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return false;
+        }
+
+        auto remaining = static_cast<std::size_t>(written);
+        while (count > 0 && remaining >= iov->iov_len)
+        {
+            remaining -= iov->iov_len;
+            ++iov;
+            --count;
+        }
+
+        if (count > 0 && remaining > 0)
+        {
+            iov->iov_base = static_cast<char*>(iov->iov_base) + remaining;
+            iov->iov_len -= remaining;
+        }
+    }
+
+    return true;
+}
+#endif
+}  // namespace
+
+/**
+ * @brief Attaches to an existing ring.
+ *
+ * Drops that happened before the reader attached are reported with the first poll.
+ *
+ * @param name The shared-memory object name.
+ */
+ShmRingReader::ShmRingReader(const std::string& name): m_ring(name, 0) {}
+
+auto ShmRingReader::is_open() const -> bool
+{
+    return m_ring.is_open();
+}
+
+/**
+ * @brief Writes all records published since the last poll to the file descriptor.
+ *
+ * The iovecs point into the shared mapping; the ring only releases the records after the
+ * callback has written them. If writing fails, the records stay in the ring and the next poll
+ * writes them again, so the lines before the failure may appear twice.
+ *
+ * @param fd The descriptor to write to.
+ * @return The number of records written.
+ */
+auto ShmRingReader::poll(int fd) -> std::size_t
+{
+#ifndef _WIN32
+    static char newline = '\n';
+    std::string drop_notice;
+    const std::uint64_t dropped = m_ring.get_dropped_count();
+
+    if (dropped > m_reported_drops)
+    {
+        drop_notice = "[ShmRingReader]: " + std::to_string(dropped - m_reported_drops) +
+                      " records dropped by the producer\n";
+    }
+
+    std::vector<iovec> iov;
+    if (!drop_notice.empty())
+    {
+        iov.push_back({drop_notice.data(), drop_notice.size()});
+    }
+
+    bool written = true;
+    const std::size_t count =
+        m_ring.read([&iov, &written, fd](std::span<const ShmRecordView> records) {
+            iov.reserve(iov.size() + 2 * records.size());
+            for (const auto& record: records)
+            {
+                iov.push_back({const_cast<char*>(record.text.data()), record.text.size()});
+                iov.push_back({&newline, 1});
+            }
+
+            written = writev_all(fd, iov.data(), iov.size());
+            iov.clear();
+            return written;
+        });
+
+    if (!iov.empty())
+    {
+        written = writev_all(fd, iov.data(), iov.size());
+    }
+
+    // The drops are reported again with the next poll if the notice was not written.
+    if (written)
+    {
+        m_reported_drops = dropped;
+    }
+    return count;
+#else
+    static_cast<void>(fd);
+    return 0;
+#endif
+}
+
+auto ShmRingReader::get_dropped_count() const -> std::uint64_t
+{
+    return m_ring.get_dropped_count();
+}
+
+}  // namespace SimpleCppLogger
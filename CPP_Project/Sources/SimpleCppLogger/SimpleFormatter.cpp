@@ -6,9 +6,11 @@
 #include "SimpleCppLogger/SimpleFormatter.h"
 
 #include <chrono>
+#include <cstdint>
 #include <ctime>
 #include <iomanip>
 #include <sstream>
+#include <string_view>
 
 #include "CommonLib/Utils/DateTimeUtils.h"
 #include "SimpleCppLogger/LogLevel.h"
@@ -16,6 +18,13 @@
 namespace SimpleCppLogger
 {
 
+SimpleFormatter::SimpleFormatter(bool use_colors): m_use_colors(use_colors) {}
+
+auto SimpleFormatter::uses_colors() const -> bool
+{
+    return m_use_colors;
+}
+
 auto SimpleFormatter::format(const LogMessage& log_message,
                              const std::source_location& location) const -> std::string
 {
@@ -54,32 +63,55 @@ auto SimpleFormatter::format(const LogMessage& log_message,
         break;
     }
 
-    const std::string reset_code = "\033[0m";
-    const std::string context_color_code = "\033[95m";  // Light Purple
+    if (!m_use_colors)
+    {
+        color_code.clear();
+    }
+
+    const std::string reset_code = m_use_colors ? "\033[0m" : "";
+    const std::string context_color_code = m_use_colors ? "\033[95m" : "";  // Light Purple
+
+    // Messages with an explicit source context are logged with an empty source_location.
+    std::string_view file = location.file_name();
+    std::string_view function = location.function_name();
+    std::uint_least32_t line = location.line();
 
-    const bool has_file = location.file_name()[0] != '\0';
-    const bool has_function = location.function_name()[0] != '\0';
-    const bool has_line = location.line() > 0;
+    if (file.empty() && function.empty() && line == 0)
+    {
+        file = log_message.get_file();
+        function = log_message.get_function();
+        line = log_message.get_line();
+    }
+
+    const bool has_file = !file.empty();
+    const bool has_function = !function.empty();
+    const bool has_line = line > 0;
     const bool has_any_location = has_file || has_function || has_line;
 
     std::ostringstream oss;
-    oss << color_code << msg_type << reset_code << " " << CommonLib::DateTimeUtils::now() << " "
-        << log_message.get_message();
+    oss << color_code << msg_type << reset_code << " " << CommonLib::DateTimeUtils::now() << " ";
+
+    if (!log_message.get_category().empty())
+    {
+        oss << "[" << log_message.get_category() << "] ";
+    }
+
+    oss << log_message.get_message();
 
     if (has_any_location)
     {
         oss << " - ";
         if (has_file)
         {
-            oss << context_color_code << location.file_name() << reset_code;
+            oss << context_color_code << file << reset_code;
             if (has_line)
             {
-                oss << ":" << context_color_code << location.line() << reset_code;
+                oss << ":" << context_color_code << line << reset_code;
             }
         }
         else if (has_line)
         {
-            oss << ":" << context_color_code << location.line() << reset_code;
+            oss << ":" << context_color_code << line << reset_code;
         }
 
         if (has_function)
@@ -88,7 +120,7 @@ auto SimpleFormatter::format(const LogMessage& log_message,
             {
                 oss << ", ";
             }
-            oss << context_color_code << location.function_name() << reset_code;
+            oss << context_color_code << function << reset_code;
         }
     }
 
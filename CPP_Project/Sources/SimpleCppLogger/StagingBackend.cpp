@@ -0,0 +1,723 @@
+#include "SimpleCppLogger/StagingBackend.h"
+
+#include <algorithm>
+#include <queue>
+#include <utility>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+#include "SimpleCppLogger/CpuTopology.h"
+
+namespace SimpleCppLogger
+{
+
+namespace
+{
+std::atomic<std::uint64_t> g_next_backend_id{1};
+
+/**
+ * @brief Tells the CPU that the caller is spin-waiting.
+ */
+auto cpu_relax() -> void
+{
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    _mm_pause();
+#elif defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield");
+#endif
+}
+
+/**
+ * @brief The staging buffers of the current thread, one per backend it has logged to.
+ *
+ * Backends are identified by a unique id rather than by address, so a backend created at the
+ * address of a destroyed one never picks up a stale buffer. On thread exit all buffers are
+ * retired; the backend releases them once they are drained.
+ */
+struct LocalBufferTable {
+        struct Entry {
+                std::uint64_t backend_id;
+                std::shared_ptr<StagingBuffer> buffer;
+        };
+
+        LocalBufferTable() = default;
+        LocalBufferTable(const LocalBufferTable&) = delete;
+        auto operator=(const LocalBufferTable&) -> LocalBufferTable& = delete;
+
+        ~LocalBufferTable()
+        {
+            for (const auto& entry: entries)
+            {
+                entry.buffer->retire();
+            }
+        }
+
+        std::vector<Entry> entries;
+        Entry* last_used = nullptr;
+};
+
+thread_local LocalBufferTable t_local_buffers;
+
+/**
+ * @brief A contiguous run of drained records from one buffer, in producer order.
+ */
+struct Run {
+        std::size_t next;
+        std::size_t end;
+        std::size_t buffer_index;
+        std::size_t shard = 0;
+};
+}  // namespace
+
+/**
+ * @brief The producer buffers of one NUMA node or core group and the records drained from them.
+ */
+struct StagingBackend::Shard {
+        std::vector<int> cpus;
+
+        mutable std::mutex buffers_mutex;
+        std::vector<std::shared_ptr<StagingBuffer>> buffers;
+        std::uint64_t released_dropped = 0;
+
+        std::vector<StagedRecord> drained;
+        std::vector<Run> runs;
+
+        std::uint64_t generation = 0;  ///< Last drain request handled by the drain thread.
+        std::thread thread;
+};
+
+/**
+ * @brief Constructs a stopped backend.
+ * @param options The backend configuration.
+ * @param sink The function that receives the merged records.
+ */
+StagingBackend::StagingBackend(const BackendOptions& options, Sink sink)
+    : m_options(options),
+      m_sink(std::move(sink)),
+      m_id(g_next_backend_id.fetch_add(1, std::memory_order_relaxed))
+{
+    const CpuTopology& topology = CpuTopology::get();
+    m_shard_of_cpu.assign(topology.get_cpu_count(), 0);
+
+    if (m_options.sharding == BackendSharding::None)
+    {
+        m_shards.push_back(std::make_unique<Shard>());
+        return;
+    }
+
+    // Core groups never span two nodes.
+    const std::size_t group_size = m_options.sharding == BackendSharding::CoreGroup
+                                       ? std::max<std::size_t>(m_options.cores_per_group, 1)
+                                       : topology.get_cpu_count();
+
+    for (std::size_t node = 0; node < topology.get_node_count(); ++node)
+    {
+        const auto cpus = topology.get_cpus_of_node(node);
+
+        for (std::size_t begin = 0; begin < cpus.size(); begin += group_size)
+        {
+            auto& shard = m_shards.emplace_back(std::make_unique<Shard>());
+            const std::size_t end = std::min(cpus.size(), begin + group_size);
+            shard->cpus.assign(cpus.begin() + static_cast<std::ptrdiff_t>(begin),
+                               cpus.begin() + static_cast<std::ptrdiff_t>(end));
+
+            for (const int cpu: shard->cpus)
+            {
+                m_shard_of_cpu[static_cast<std::size_t>(cpu)] = m_shards.size() - 1;
+            }
+        }
+    }
+
+    if (m_shards.empty())
+    {
+        m_shards.push_back(std::make_unique<Shard>());
+    }
+}
+
+/**
+ * @brief Stops the backend and delivers all remaining records.
+ */
+StagingBackend::~StagingBackend()
+{
+    stop();
+    while (drain() > 0)
+    {
+    }
+}
+
+/**
+ * @brief Starts the backend thread. Has no effect if it is already running.
+ */
+auto StagingBackend::start() -> void
+{
+    std::lock_guard<std::mutex> lock(m_state_mutex);
+
+    if (m_thread.joinable())
+    {
+        return;
+    }
+
+    if (m_options.sharding != BackendSharding::None)
+    {
+        start_shard_threads();
+    }
+
+    m_stop_requested = false;
+    m_running.store(true, std::memory_order_release);
+    m_thread = std::thread([this] { run(); });
+}
+
+/**
+ * @brief Stops the backend thread and delivers all records staged so far.
+ */
+auto StagingBackend::stop() -> void
+{
+    {
+        std::lock_guard<std::mutex> lock(m_state_mutex);
+
+        if (!m_thread.joinable())
+        {
+            return;
+        }
+
+        m_stop_requested = true;
+    }
+
+    m_state_cv.notify_all();
+    m_thread.join();
+    m_thread = std::thread();
+    stop_shard_threads();
+    m_running.store(false, std::memory_order_release);
+
+    while (drain() > 0)
+    {
+    }
+}
+
+/**
+ * @brief Returns whether the backend thread is running.
+ * @return True if running, false otherwise.
+ */
+auto StagingBackend::is_running() const -> bool
+{
+    return m_running.load(std::memory_order_acquire);
+}
+
+/**
+ * @brief Stages a record in the calling thread's buffer.
+ *
+ * @param message The message to stage.
+ * @param location The source location of the message.
+ * @return True if the record was staged, false if it was dropped.
+ */
+auto StagingBackend::submit(LogMessage&& message, const std::source_location& location) -> bool
+{
+    if (!local_buffer().push(std::move(message), location, m_options.full_policy))
+    {
+        return false;
+    }
+
+    if (m_options.wait_strategy == BackendWaitStrategy::Block ||
+        m_options.wait_strategy == BackendWaitStrategy::Hybrid)
+    {
+        // Pairs with the fence in wait_for_records(): either the backend sees the record before
+        // it sleeps or this thread sees it asleep.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if (m_backend_sleeping.load(std::memory_order_relaxed))
+        {
+            wake_backend();
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief Drains all buffers once and delivers the merged records to the sink.
+ *
+ * Each buffer yields a run that is already in producer order. The runs are merged with a
+ * min-heap keyed by the timestamp of their next record, the shard and the buffer's registration
+ * index, so records of one thread are never reordered relative to each other and the result
+ * does not depend on which drain thread finished first.
+ *
+ * @return The number of delivered records.
+ */
+auto StagingBackend::drain() -> std::size_t
+{
+    std::lock_guard<std::mutex> drain_lock(m_drain_mutex);
+    collect_shards();
+
+    std::vector<Run> runs;
+    for (std::size_t index = 0; index < m_shards.size(); ++index)
+    {
+        for (const Run& run: m_shards[index]->runs)
+        {
+            runs.push_back(run);
+            runs.back().shard = index;
+        }
+    }
+
+    if (runs.empty())
+    {
+        return 0;
+    }
+
+    std::vector<StagedRecord>* batch = &m_shards[runs.front().shard]->drained;
+
+    if (runs.size() > 1)
+    {
+        auto record = [this](const Run& run) -> const StagedRecord& {
+            return m_shards[run.shard]->drained[run.next];
+        };
+        auto later = [&runs, &record](std::size_t lhs, std::size_t rhs) {
+            const auto lhs_time = record(runs[lhs]).message.get_timestamp();
+            const auto rhs_time = record(runs[rhs]).message.get_timestamp();
+            if (lhs_time != rhs_time)
+            {
+                return lhs_time > rhs_time;
+            }
+            return runs[lhs].shard != runs[rhs].shard
+                       ? runs[lhs].shard > runs[rhs].shard
+                       : runs[lhs].buffer_index > runs[rhs].buffer_index;
+        };
+        std::priority_queue<std::size_t, std::vector<std::size_t>, decltype(later)> heap(later);
+
+        std::size_t total = 0;
+        for (std::size_t run = 0; run < runs.size(); ++run)
+        {
+            total += runs[run].end - runs[run].next;
+            heap.push(run);
+        }
+
+        m_merged.clear();
+        m_merged.reserve(total);
+
+        while (!heap.empty())
+        {
+            const std::size_t run = heap.top();
+            heap.pop();
+            m_merged.push_back(std::move(m_shards[runs[run].shard]->drained[runs[run].next++]));
+
+            if (runs[run].next != runs[run].end)
+            {
+                heap.push(run);
+            }
+        }
+
+        batch = &m_merged;
+    }
+
+    const std::size_t count = batch->size();
+
+    if (m_sink)
+    {
+        m_sink(*batch);
+    }
+
+    return count;
+}
+
+/**
+ * @brief Returns the number of shards.
+ * @return 1 without sharding, otherwise the number of NUMA nodes or core groups.
+ */
+auto StagingBackend::get_shard_count() const -> std::size_t
+{
+    return m_shards.size();
+}
+
+/**
+ * @brief Assigns the calling thread's buffer to a shard instead of the one of its CPU.
+ *
+ * @param shard The shard, less than get_shard_count().
+ * @return True if the buffer was registered with the shard.
+ */
+auto StagingBackend::bind_current_thread(std::size_t shard) -> bool
+{
+    if (shard >= m_shards.size() || find_local_buffer() != nullptr)
+    {
+        return false;
+    }
+
+    register_buffer(shard);
+    return true;
+}
+
+/**
+ * @brief Returns the number of registered producer buffers that have not been released.
+ * @return The number of buffers.
+ */
+auto StagingBackend::get_buffer_count() const -> std::size_t
+{
+    std::size_t count = 0;
+
+    for (const auto& shard: m_shards)
+    {
+        std::lock_guard<std::mutex> lock(shard->buffers_mutex);
+        count += shard->buffers.size();
+    }
+
+    return count;
+}
+
+/**
+ * @brief Returns the number of records dropped by all producers so far.
+ * @return The drop count.
+ */
+auto StagingBackend::get_dropped_count() const -> std::uint64_t
+{
+    std::uint64_t dropped = 0;
+
+    for (const auto& shard: m_shards)
+    {
+        std::lock_guard<std::mutex> lock(shard->buffers_mutex);
+        dropped += shard->released_dropped;
+
+        for (const auto& buffer: shard->buffers)
+        {
+            dropped += buffer->get_dropped_count();
+        }
+    }
+
+    return dropped;
+}
+
+/**
+ * @brief Returns the options the backend was created with.
+ * @return The backend options.
+ */
+auto StagingBackend::get_options() const -> const BackendOptions&
+{
+    return m_options;
+}
+
+/**
+ * @brief Returns the calling thread's buffer for this backend, registering it on first use.
+ */
+auto StagingBackend::local_buffer() -> StagingBuffer&
+{
+    StagingBuffer* buffer = find_local_buffer();
+    return buffer != nullptr ? *buffer : register_buffer(get_current_shard());
+}
+
+/**
+ * @brief Looks up the calling thread's buffer for this backend.
+ * @return The buffer, or nullptr if the thread has not registered one yet.
+ */
+auto StagingBackend::find_local_buffer() -> StagingBuffer*
+{
+    LocalBufferTable& table = t_local_buffers;
+
+    if (table.last_used != nullptr && table.last_used->backend_id == m_id)
+    {
+        return table.last_used->buffer.get();
+    }
+
+    for (auto& entry: table.entries)
+    {
+        if (entry.backend_id == m_id)
+        {
+            table.last_used = &entry;
+            return entry.buffer.get();
+        }
+    }
+
+    return nullptr;
+}
+
+/**
+ * @brief Creates a buffer for the calling thread and adds it to the shard's buffer list.
+ *
+ * The buffer is allocated here, on the producer thread, so that its memory is placed on the
+ * producer's NUMA node.
+ */
+auto StagingBackend::register_buffer(std::size_t shard) -> StagingBuffer&
+{
+    LocalBufferTable& table = t_local_buffers;
+
+    // Buffers only referenced by this table belong to destroyed backends.
+    std::erase_if(table.entries, [](const LocalBufferTable::Entry& entry) {
+        return entry.buffer.use_count() == 1;
+    });
+
+    auto buffer = std::make_shared<StagingBuffer>(m_options.buffer_capacity);
+    {
+        std::lock_guard<std::mutex> lock(m_shards[shard]->buffers_mutex);
+        m_shards[shard]->buffers.push_back(buffer);
+    }
+
+    table.entries.push_back(LocalBufferTable::Entry{m_id, std::move(buffer)});
+    table.last_used = &table.entries.back();
+
+    return *table.last_used->buffer;
+}
+
+/**
+ * @brief Returns the shard of the CPU the calling thread runs on.
+ */
+auto StagingBackend::get_current_shard() const -> std::size_t
+{
+    if (m_shards.size() == 1)
+    {
+        return 0;
+    }
+
+    const int cpu = CpuTopology::get_current_cpu();
+    return cpu >= 0 && static_cast<std::size_t>(cpu) < m_shard_of_cpu.size()
+               ? m_shard_of_cpu[static_cast<std::size_t>(cpu)]
+               : 0;
+}
+
+/**
+ * @brief Pops all records of the shard's buffers into its drained list, one run per buffer, and
+ * releases the buffers of exited threads.
+ */
+auto StagingBackend::drain_shard(Shard& shard) -> void
+{
+    std::vector<std::shared_ptr<StagingBuffer>> buffers;
+    {
+        std::lock_guard<std::mutex> lock(shard.buffers_mutex);
+        buffers = shard.buffers;
+    }
+
+    shard.drained.clear();
+    shard.runs.clear();
+    std::vector<std::shared_ptr<StagingBuffer>> released;
+
+    for (std::size_t index = 0; index < buffers.size(); ++index)
+    {
+        // A buffer retired before this drain has received its last record already.
+        const bool retired = buffers[index]->is_retired();
+        const std::size_t begin = shard.drained.size();
+
+        if (buffers[index]->pop_all(shard.drained) > 0)
+        {
+            shard.runs.push_back(Run{begin, shard.drained.size(), index});
+        }
+
+        if (retired)
+        {
+            released.push_back(buffers[index]);
+        }
+    }
+
+    if (!released.empty())
+    {
+        std::lock_guard<std::mutex> lock(shard.buffers_mutex);
+
+        for (const auto& buffer: released)
+        {
+            shard.released_dropped += buffer->get_dropped_count();
+            std::erase(shard.buffers, buffer);
+        }
+    }
+}
+
+/**
+ * @brief Drains every shard, on the shards' drain threads if they run or inline otherwise, and
+ * returns when all shards are done. The caller must hold m_drain_mutex.
+ */
+auto StagingBackend::collect_shards() -> void
+{
+    std::unique_lock<std::mutex> lock(m_shard_mutex);
+
+    if (!m_shard_threads_running)
+    {
+        lock.unlock();
+        for (const auto& shard: m_shards)
+        {
+            drain_shard(*shard);
+        }
+        return;
+    }
+
+    ++m_shard_generation;
+    m_shards_pending = m_shards.size();
+    m_shard_work.notify_all();
+    m_shard_done.wait(lock, [this] { return m_shards_pending == 0; });
+}
+
+/**
+ * @brief Starts one drain thread per shard. The caller must hold m_state_mutex.
+ */
+auto StagingBackend::start_shard_threads() -> void
+{
+    {
+        std::lock_guard<std::mutex> lock(m_shard_mutex);
+        m_shard_threads_running = true;
+    }
+
+    for (const auto& shard: m_shards)
+    {
+        shard->generation = m_shard_generation;
+        shard->thread = std::thread([this, &shard = *shard] { run_shard(shard); });
+    }
+}
+
+/**
+ * @brief Stops the drain threads of all shards, if they run.
+ */
+auto StagingBackend::stop_shard_threads() -> void
+{
+    {
+        // Waits for a drain in progress, which still needs the threads.
+        std::lock_guard<std::mutex> drain_lock(m_drain_mutex);
+        std::lock_guard<std::mutex> lock(m_shard_mutex);
+
+        if (!m_shard_threads_running)
+        {
+            return;
+        }
+
+        m_shard_threads_running = false;
+    }
+
+    m_shard_work.notify_all();
+
+    for (const auto& shard: m_shards)
+    {
+        shard->thread.join();
+    }
+}
+
+/**
+ * @brief A shard's drain thread: pins itself to the shard's CPUs and drains the shard whenever
+ * collect_shards() asks for it.
+ */
+auto StagingBackend::run_shard(Shard& shard) -> void
+{
+    if (m_options.pin_threads)
+    {
+        CpuTopology::pin_current_thread(shard.cpus);
+    }
+
+    std::unique_lock<std::mutex> lock(m_shard_mutex);
+
+    for (;;)
+    {
+        m_shard_work.wait(lock, [this, &shard] {
+            return !m_shard_threads_running || m_shard_generation != shard.generation;
+        });
+
+        if (!m_shard_threads_running)
+        {
+            return;
+        }
+
+        shard.generation = m_shard_generation;
+        lock.unlock();
+        drain_shard(shard);
+        lock.lock();
+
+        if (--m_shards_pending == 0)
+        {
+            m_shard_done.notify_one();
+        }
+    }
+}
+
+/**
+ * @brief Returns whether any producer buffer holds records.
+ */
+auto StagingBackend::has_pending_records() const -> bool
+{
+    for (const auto& shard: m_shards)
+    {
+        std::lock_guard<std::mutex> lock(shard->buffers_mutex);
+
+        for (const auto& buffer: shard->buffers)
+        {
+            if (!buffer->is_empty())
+            {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief Wakes the sleeping backend thread.
+ */
+auto StagingBackend::wake_backend() -> void
+{
+    {
+        std::lock_guard<std::mutex> lock(m_state_mutex);
+        m_wake_requested = true;
+    }
+
+    m_state_cv.notify_one();
+}
+
+/**
+ * @brief Waits after an empty drain as selected by wait_strategy.
+ * @param idle_polls The number of empty drains since the last delivered record.
+ */
+auto StagingBackend::wait_for_records(std::size_t idle_polls) -> void
+{
+    switch (m_options.wait_strategy)
+    {
+        case BackendWaitStrategy::Spin:
+            cpu_relax();
+            return;
+        case BackendWaitStrategy::Yield:
+            std::this_thread::yield();
+            return;
+        case BackendWaitStrategy::Hybrid:
+            if (idle_polls < m_options.spin_polls)
+            {
+                cpu_relax();
+                return;
+            }
+            if (idle_polls - m_options.spin_polls < m_options.yield_polls)
+            {
+                std::this_thread::yield();
+                return;
+            }
+            break;
+        case BackendWaitStrategy::Block:
+            break;
+    }
+
+    std::unique_lock<std::mutex> lock(m_state_mutex);
+    m_backend_sleeping.store(true, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    if (!has_pending_records())
+    {
+        // poll_interval only bounds the sleep; producers wake the backend when they submit.
+        m_state_cv.wait_for(lock, m_options.poll_interval,
+                            [this] { return m_stop_requested || m_wake_requested; });
+    }
+
+    m_wake_requested = false;
+    m_backend_sleeping.store(false, std::memory_order_relaxed);
+}
+
+/**
+ * @brief The backend thread: drains until stopped and waits by wait_strategy when idle.
+ */
+auto StagingBackend::run() -> void
+{
+    std::size_t idle_polls = 0;
+
+    while (!m_stop_requested.load(std::memory_order_acquire))
+    {
+        if (drain() > 0)
+        {
+            idle_polls = 0;
+        }
+        else
+        {
+            wait_for_records(idle_polls++);
+        }
+    }
+}
+
+}  // namespace SimpleCppLogger
@@ -0,0 +1,129 @@
+#include "SimpleCppLogger/StagingBuffer.h"
+
+#include <bit>
+#include <thread>
+#include <utility>
+
+namespace SimpleCppLogger
+{
+
+/**
+ * @brief Constructs a buffer that holds at least the given number of records.
+ * @param capacity The requested capacity, rounded up to a power of two.
+ */
+StagingBuffer::StagingBuffer(std::size_t capacity)
+    : m_slots(std::bit_ceil(capacity < 2 ? std::size_t{2} : capacity)),
+      m_mask(m_slots.size() - 1)
+{}
+
+/**
+ * @brief Appends a record. Must only be called by the owning producer thread.
+ *
+ * The consumer's head index is only re-read when the cached copy says the buffer is full.
+ *
+ * @param message The message to stage.
+ * @param location The source location of the message.
+ * @param policy What to do if the buffer is full.
+ * @return True if the record was staged, false if it was dropped.
+ */
+auto StagingBuffer::push(LogMessage&& message, const std::source_location& location,
+                         StagingFullPolicy policy) -> bool
+{
+    const std::size_t tail = m_tail.load(std::memory_order_relaxed);
+
+    while (tail - m_cached_head >= m_slots.size())
+    {
+        m_cached_head = m_head.load(std::memory_order_acquire);
+
+        if (tail - m_cached_head < m_slots.size())
+        {
+            break;
+        }
+
+        if (policy == StagingFullPolicy::Drop)
+        {
+            m_dropped.store(m_dropped.load(std::memory_order_relaxed) + 1,
+                            std::memory_order_relaxed);
+            return false;
+        }
+
+        std::this_thread::yield();
+    }
+
+    StagedRecord& slot = m_slots[tail & m_mask];
+    slot.message = std::move(message);
+    slot.location = location;
+    slot.sequence = m_next_sequence++;
+
+    m_tail.store(tail + 1, std::memory_order_release);
+
+    return true;
+}
+
+/**
+ * @brief Moves all staged records to the end of the given vector. Must only be called by the
+ * consumer.
+ *
+ * @param out The vector to append to.
+ * @return The number of records moved.
+ */
+auto StagingBuffer::pop_all(std::vector<StagedRecord>& out) -> std::size_t
+{
+    const std::size_t head = m_head.load(std::memory_order_relaxed);
+    const std::size_t tail = m_tail.load(std::memory_order_acquire);
+
+    for (std::size_t index = head; index != tail; ++index)
+    {
+        out.push_back(std::move(m_slots[index & m_mask]));
+    }
+
+    m_head.store(tail, std::memory_order_release);
+
+    return tail - head;
+}
+
+/**
+ * @brief Returns whether no records are staged.
+ * @return True if the buffer is empty.
+ */
+auto StagingBuffer::is_empty() const -> bool
+{
+    return m_head.load(std::memory_order_acquire) == m_tail.load(std::memory_order_acquire);
+}
+
+/**
+ * @brief Returns the capacity of the buffer.
+ * @return The number of records the buffer can hold.
+ */
+auto StagingBuffer::get_capacity() const -> std::size_t
+{
+    return m_slots.size();
+}
+
+/**
+ * @brief Returns the number of records dropped because the buffer was full.
+ * @return The drop count.
+ */
+auto StagingBuffer::get_dropped_count() const -> std::uint64_t
+{
+    return m_dropped.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Marks the buffer as retired because its producer thread has exited.
+ */
+auto StagingBuffer::retire() -> void
+{
+    m_retired.store(true, std::memory_order_release);
+}
+
+/**
+ * @brief Returns whether the producer thread has exited.
+ * @return True if the buffer is retired.
+ */
+auto StagingBuffer::is_retired() const -> bool
+{
+    return m_retired.load(std::memory_order_acquire);
+}
+
+}  // namespace SimpleCppLogger
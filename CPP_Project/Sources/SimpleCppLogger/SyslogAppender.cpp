@@ -0,0 +1,354 @@
+#include "SimpleCppLogger/SyslogAppender.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+namespace SimpleCppLogger
+{
+
+namespace
+{
+constexpr auto ReconnectInterval = std::chrono::seconds(1);
+
+/**
+ * @brief Returns the value for a header field: printable ASCII without spaces, at most
+ * max_length characters, or "-" if nothing remains.
+ */
+auto header_field(std::string_view value, std::size_t max_length) -> std::string
+{
+    std::string field;
+    for (char c: value.substr(0, max_length))
+    {
+        if (c > ' ' && c < 127)
+        {
+            field += c;
+        }
+    }
+    return field.empty() ? "-" : field;
+}
+
+/**
+ * @brief Appends the timestamp as RFC 3339 UTC with microseconds.
+ */
+auto append_timestamp(std::string& out, LogMessage::Clock::time_point timestamp) -> void
+{
+    const auto day_point = std::chrono::floor<std::chrono::days>(timestamp);
+    const std::chrono::year_month_day date{day_point};
+    const std::chrono::hh_mm_ss time{
+        std::chrono::floor<std::chrono::microseconds>(timestamp - day_point)};
+
+    char buffer[40];
+    const int length = std::snprintf(
+        buffer, sizeof(buffer), "%04d-%02u-%02uT%02d:%02d:%02d.%06dZ",
+        static_cast<int>(date.year()), static_cast<unsigned>(date.month()),
+        static_cast<unsigned>(date.day()), static_cast<int>(time.hours().count()),
+        static_cast<int>(time.minutes().count()), static_cast<int>(time.seconds().count()),
+        static_cast<int>(time.subseconds().count()));
+
+    if (length > 0)
+    {
+        out.append(buffer, static_cast<std::size_t>(length));
+    }
+}
+}  // namespace
+
+/**
+ * @brief Creates the socket and connects it to the configured path.
+ *
+ * The HOSTNAME, APP-NAME and PROCID fields are the same for every message and are encoded once.
+ *
+ * @param options The socket and header configuration.
+ * @param formatter The LogFormatter for the MSG part, or nullptr for the raw message.
+ */
+SyslogAppender::SyslogAppender(const SyslogAppenderOptions& options,
+                               const std::shared_ptr<LogFormatter>& formatter)
+    : LogAppender(formatter), m_options(options)
+{
+    m_options.facility = std::clamp(m_options.facility, 0, 23);
+
+    std::string hostname = m_options.hostname;
+    std::string process_id = "-";
+#ifndef _WIN32
+    if (hostname.empty())
+    {
+        char buffer[256] = {};
+        if (::gethostname(buffer, sizeof(buffer) - 1) == 0)
+        {
+            hostname = buffer;
+        }
+    }
+    process_id = std::to_string(::getpid());
+#endif
+
+    const std::string host_field = header_field(hostname, 255);
+    const std::string app_field = header_field(m_options.app_name, 48);
+    m_header_suffix.reserve(host_field.size() + app_field.size() + process_id.size() + 4);
+    m_header_suffix.append(" ").append(host_field).append(" ").append(app_field);
+    m_header_suffix.append(" ").append(process_id).append(" ");
+
+    std::unique_lock<std::shared_mutex> lock(m_socket_mutex);
+    connect_socket();
+}
+
+/**
+ * @brief Closes the socket.
+ */
+SyslogAppender::~SyslogAppender()
+{
+#ifndef _WIN32
+    if (m_socket >= 0)
+    {
+        ::close(m_socket);
+    }
+#endif
+}
+
+auto SyslogAppender::is_connected() const -> bool
+{
+    std::shared_lock<std::shared_mutex> lock(m_socket_mutex);
+    return m_socket >= 0;
+}
+
+auto SyslogAppender::get_sent_count() const -> std::uint64_t
+{
+    return m_sent.load(std::memory_order_relaxed);
+}
+
+auto SyslogAppender::get_dropped_count() const -> std::uint64_t
+{
+    return m_dropped.load(std::memory_order_relaxed);
+}
+
+auto SyslogAppender::supports_preformatted() const -> bool
+{
+    return true;
+}
+
+auto SyslogAppender::to_severity(LogLevel level) -> int
+{
+    switch (level)
+    {
+    case LogLevel::Trace:
+    case LogLevel::Debug:
+        return 7;
+    case LogLevel::Info:
+        return 6;
+    case LogLevel::Warning:
+        return 4;
+    case LogLevel::Error:
+        return 3;
+    case LogLevel::Fatal:
+        return 2;
+    default:
+        return 5;
+    }
+}
+
+/**
+ * @brief Encodes a record as "<PRI>1 TIMESTAMP HOSTNAME APP-NAME PROCID MSGID - MSG".
+ */
+auto SyslogAppender::encode(const LogMessage& message, std::string_view text) const
+    -> std::string
+{
+    std::string out;
+    out.reserve(64 + m_header_suffix.size() + text.size());
+
+    out += '<';
+    out += std::to_string(m_options.facility * 8 + to_severity(message.get_level()));
+    out += ">1 ";
+    append_timestamp(out, message.get_timestamp());
+    out += m_header_suffix;
+    out += header_field(message.get_category(), 32);
+    out += " - ";
+    out += text;
+
+    if (out.size() > m_options.max_message_size)
+    {
+        out.resize(m_options.max_message_size);
+    }
+
+    return out;
+}
+
+auto SyslogAppender::append_batch(std::span<const StagedRecord> records) -> void
+{
+    std::vector<std::string> datagrams;
+    datagrams.reserve(records.size());
+
+    for (const auto& record: records)
+    {
+        if (record.message.get_level() >= m_log_level)
+        {
+            datagrams.push_back(
+                encode(record.message, format(record.message, record.location)));
+        }
+    }
+
+    send(datagrams);
+}
+
+auto SyslogAppender::internal_append(const LogMessage& message,
+                                     const std::source_location& location) -> void
+{
+    std::string datagram = encode(message, format(message, location));
+    send(std::span<std::string>(&datagram, 1));
+}
+
+auto SyslogAppender::internal_append_formatted(const LogMessage& message,
+                                               const std::source_location& /*location*/,
+                                               std::string&& formatted) -> void
+{
+    std::string datagram = encode(message, formatted);
+    send(std::span<std::string>(&datagram, 1));
+}
+
+/**
+ * @brief Sends the datagrams without blocking. Whatever cannot be sent is dropped and counted.
+ *
+ * If the daemon went away (ECONNREFUSED, ENOTCONN), the socket is closed and reconnected on a
+ * later call, at most once per ReconnectInterval.
+ */
+auto SyslogAppender::send(std::span<std::string> datagrams) -> void
+{
+    if (datagrams.empty())
+    {
+        return;
+    }
+
+#ifndef _WIN32
+    std::size_t sent = 0;
+    bool disconnected = false;
+
+    {
+        std::shared_lock<std::shared_mutex> lock(m_socket_mutex);
+
+        if (m_socket >= 0)
+        {
+#ifdef __linux__
+            std::vector<mmsghdr> headers(datagrams.size());
+            std::vector<iovec> iov(datagrams.size());
+
+            for (std::size_t i = 0; i < datagrams.size(); ++i)
+            {
+                iov[i] = {datagrams[i].data(), datagrams[i].size()};
+                headers[i] = {};
+                headers[i].msg_hdr.msg_iov = &iov[i];
+                headers[i].msg_hdr.msg_iovlen = 1;
+            }
+
+            while (sent < datagrams.size())
+            {
+                const int count =
+                    ::sendmmsg(m_socket, headers.data() + sent,
+                               static_cast<unsigned int>(datagrams.size() - sent), MSG_DONTWAIT);
+                if (count > 0)
+                {
+                    sent += static_cast<std::size_t>(count);
+                    continue;
+                }
+                if (count < 0 && errno == EINTR)
+                {
+                    continue;
+                }
+                disconnected = count < 0 && (errno == ECONNREFUSED || errno == ENOTCONN);
+                break;
+            }
+#else
+            for (auto& datagram: datagrams)
+            {
+                ssize_t result;
+                do
+                {
+                    result = ::send(m_socket, datagram.data(), datagram.size(), MSG_DONTWAIT);
+                } while (result < 0 && errno == EINTR);
+
+                if (result < 0)
+                {
+                    disconnected = errno == ECONNREFUSED || errno == ENOTCONN;
+                    break;
+                }
+                ++sent;
+            }
+#endif
+        }
+    }
+
+    m_sent.fetch_add(sent, std::memory_order_relaxed);
+    m_dropped.fetch_add(datagrams.size() - sent, std::memory_order_relaxed);
+
+    if (disconnected || sent == 0)
+    {
+        std::unique_lock<std::shared_mutex> lock(m_socket_mutex);
+        if (disconnected && m_socket >= 0)
+        {
+            ::close(m_socket);
+            m_socket = -1;
+        }
+        if (m_socket < 0)
+        {
+            connect_socket();
+        }
+    }
+#else
+    m_dropped.fetch_add(datagrams.size(), std::memory_order_relaxed);
+#endif
+}
+
+/**
+ * @brief Opens a non-blocking datagram socket and connects it to the configured path. Does
+ * nothing if the last attempt was less than ReconnectInterval ago. The caller must hold
+ * m_socket_mutex exclusively.
+ */
+auto SyslogAppender::connect_socket() -> bool
+{
+#ifndef _WIN32
+    const auto now = std::chrono::steady_clock::now();
+    if (now < m_next_connect)
+    {
+        return false;
+    }
+    m_next_connect = now + ReconnectInterval;
+
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    if (m_options.socket_path.size() >= sizeof(address.sun_path))
+    {
+        return false;
+    }
+    std::memcpy(address.sun_path, m_options.socket_path.c_str(), m_options.socket_path.size());
+
+    const int fd = ::socket(AF_UNIX, SOCK_DGRAM, 0);
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    ::fcntl(fd, F_SETFD, FD_CLOEXEC);
+    ::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL) | O_NONBLOCK);
+
+    if (::connect(fd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0)
+    {
+        ::close(fd);
+        return false;
+    }
+
+    m_socket = fd;
+    return true;
+#else
+    return false;
+#endif
+}
+
+}  // namespace SimpleCppLogger
@@ -0,0 +1,134 @@
+#include "SimpleCppLogger/Utf8Conversion.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace SimpleCppLogger
+{
+
+namespace
+{
+constexpr char32_t ReplacementCharacter = 0xFFFD;
+
+/**
+ * @brief Appends the UTF-8 encoding of a single code point.
+ */
+auto append_code_point(std::string& out, char32_t code_point) -> void
+{
+    if (code_point < 0x80)
+    {
+        out += static_cast<char>(code_point);
+    }
+    else if (code_point < 0x800)
+    {
+        out += static_cast<char>(0xC0 | (code_point >> 6));
+        out += static_cast<char>(0x80 | (code_point & 0x3F));
+    }
+    else if (code_point < 0x10000)
+    {
+        out += static_cast<char>(0xE0 | (code_point >> 12));
+        out += static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (code_point & 0x3F));
+    }
+    else
+    {
+        out += static_cast<char>(0xF0 | (code_point >> 18));
+        out += static_cast<char>(0x80 | ((code_point >> 12) & 0x3F));
+        out += static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (code_point & 0x3F));
+    }
+}
+
+constexpr auto is_high_surrogate(std::uint32_t unit) -> bool
+{
+    return unit >= 0xD800 && unit <= 0xDBFF;
+}
+
+constexpr auto is_low_surrogate(std::uint32_t unit) -> bool
+{
+    return unit >= 0xDC00 && unit <= 0xDFFF;
+}
+
+/**
+ * @brief Decodes the code point starting at pos and advances pos past it.
+ */
+auto decode(std::wstring_view text, std::size_t& pos) -> char32_t
+{
+    const auto unit = static_cast<std::uint32_t>(text[pos++]);
+
+    if constexpr (sizeof(wchar_t) == 2)
+    {
+        if (is_high_surrogate(unit))
+        {
+            if (pos < text.size() && is_low_surrogate(static_cast<std::uint32_t>(text[pos])))
+            {
+                const auto low = static_cast<std::uint32_t>(text[pos++]);
+                return static_cast<char32_t>(0x10000 + ((unit - 0xD800) << 10) + (low - 0xDC00));
+            }
+            return ReplacementCharacter;
+        }
+
+        return is_low_surrogate(unit) ? ReplacementCharacter : static_cast<char32_t>(unit);
+    }
+    else
+    {
+        const bool valid = unit <= 0x10FFFF && !is_high_surrogate(unit) && !is_low_surrogate(unit);
+        return valid ? static_cast<char32_t>(unit) : ReplacementCharacter;
+    }
+}
+}  // namespace
+
+/**
+ * @brief Appends the UTF-8 encoding of a wide string.
+ *
+ * The output is reserved for the all-ASCII case; ASCII runs are narrowed in a tight loop that
+ * the compiler can vectorize, and only the remaining characters go through the decoder.
+ *
+ * @param out The string to append to.
+ * @param text The wide text to convert.
+ */
+auto append_utf8(std::string& out, std::wstring_view text) -> void
+{
+    out.reserve(out.size() + text.size());
+    std::size_t pos = 0;
+
+    while (pos < text.size())
+    {
+        std::size_t run_end = pos;
+        while (run_end < text.size() && static_cast<std::uint32_t>(text[run_end]) < 0x80)
+        {
+            ++run_end;
+        }
+
+        if (run_end > pos)
+        {
+            const std::size_t offset = out.size();
+            out.resize(offset + (run_end - pos));
+            char* dest = out.data() + offset;
+
+            for (std::size_t i = pos; i < run_end; ++i)
+            {
+                *dest++ = static_cast<char>(text[i]);
+            }
+
+            pos = run_end;
+            continue;
+        }
+
+        append_code_point(out, decode(text, pos));
+    }
+}
+
+/**
+ * @brief Converts a wide string to UTF-8.
+ * @param text The wide text to convert.
+ * @return The UTF-8 encoded text.
+ */
+auto to_utf8(std::wstring_view text) -> std::string
+{
+    std::string out;
+    append_utf8(out, text);
+    return out;
+}
+
+}  // namespace SimpleCppLogger
@@ -0,0 +1,44 @@
+/// @file WLogStream.cpp
+/// @brief Implements the WLogStream class.
+
+#include "SimpleCppLogger/WLogStream.h"
+
+#include <utility>
+
+#include "SimpleCppLogger/Logger.h"
+
+namespace SimpleCppLogger
+{
+
+WLogStream::WLogStream(LogLevel level, std::source_location location)
+    : m_context(&Logger::get_instance()), m_level(level), m_location(location)
+{}
+
+WLogStream::WLogStream(const LogCategory& category, LogLevel level, std::source_location location)
+    : m_context(&Logger::get_instance()), m_level(level), m_location(location),
+      m_category(category)
+{}
+
+WLogStream::WLogStream(LoggerContext& context, LogLevel level, std::source_location location)
+    : m_context(&context), m_level(level), m_location(location)
+{}
+
+WLogStream& WLogStream::operator<<(std::wostream& (*manip)(std::wostream&))
+{
+    m_stream << manip;
+    return *this;
+}
+
+WLogStream::~WLogStream()
+{
+    if (m_category.is_valid())
+    {
+        m_context->log(m_category, m_level, std::move(m_stream).str(), m_location);
+    }
+    else
+    {
+        m_context->log(m_level, std::move(m_stream).str(), m_location);
+    }
+}
+
+}  // namespace SimpleCppLogger
@@ -0,0 +1,214 @@
+/**
+ * @file LogQuery.cpp
+ * @brief Command-line tool that prints the parts of a log file selected by its sidecar index.
+ *
+ * Usage: LogQuery <log file> [--index <file>] [--from <time>] [--to <time>] [--level <level>]
+ *                 [--token <text>] [--stats]
+ *
+ * Times are UTC in the form YYYY-MM-DDTHH:MM:SS or seconds since the epoch. Only the frames
+ * that may contain matching records are read and decompressed; the other frames are skipped
+ * without touching the log file. Time range and level select whole frames, so the output may
+ * contain neighbouring records. With --token, only the lines that contain the text are printed.
+ * With --stats, the number of frames read and skipped is printed to stderr.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "SimpleCppLogger/CompressionCodec.h"
+#include "SimpleCppLogger/LogIndex.h"
+
+namespace
+{
+using SimpleCppLogger::LogMessage;
+
+/**
+ * @brief Parses YYYY-MM-DDTHH:MM:SS (UTC) or seconds since the epoch.
+ */
+auto parse_time(const char* text) -> std::optional<LogMessage::Clock::time_point>
+{
+    int year = 0;
+    unsigned month = 0;
+    unsigned day = 0;
+    int hour = 0;
+    int minute = 0;
+    int second = 0;
+
+    if (std::sscanf(text, "%d-%u-%uT%d:%d:%d", &year, &month, &day, &hour, &minute, &second) ==
+        6)
+    {
+        const std::chrono::year_month_day date{std::chrono::year(year), std::chrono::month(month),
+                                               std::chrono::day(day)};
+        if (!date.ok())
+        {
+            return std::nullopt;
+        }
+
+        return std::chrono::sys_days(date) + std::chrono::hours(hour) +
+               std::chrono::minutes(minute) + std::chrono::seconds(second);
+    }
+
+    char* end = nullptr;
+    const long long seconds = std::strtoll(text, &end, 10);
+    if (end == text || *end != '\0')
+    {
+        return std::nullopt;
+    }
+
+    return LogMessage::Clock::time_point(std::chrono::seconds(seconds));
+}
+
+/**
+ * @brief Writes the lines of the text that contain the token, or all of it without a token.
+ */
+auto print_lines(std::string_view text, std::string_view token) -> void
+{
+    if (token.empty())
+    {
+        std::fwrite(text.data(), 1, text.size(), stdout);
+        return;
+    }
+
+    while (!text.empty())
+    {
+        const std::size_t end = text.find('\n');
+        const std::size_t length = end == std::string_view::npos ? text.size() : end + 1;
+        const std::string_view line = text.substr(0, length);
+
+        if (line.find(token) != std::string_view::npos)
+        {
+            std::fwrite(line.data(), 1, line.size(), stdout);
+        }
+
+        text.remove_prefix(length);
+    }
+}
+}  // namespace
+
+/**
+ * @brief Parses the arguments, selects the frames and prints them.
+ *
+ * @param argc Number of command-line arguments.
+ * @param argv Array of command-line arguments.
+ * @return 0 on success, 1 for invalid arguments, 2 if a file cannot be read.
+ */
+auto main(int argc, char* argv[]) -> int
+{
+    if (argc < 2)
+    {
+        std::fprintf(stderr,
+                     "Usage: %s <log file> [--index <file>] [--from <time>] [--to <time>] "
+                     "[--level <level>] [--token <text>] [--stats]\n",
+                     argv[0]);
+        return 1;
+    }
+
+    const std::string log_path = argv[1];
+    std::string index_path = SimpleCppLogger::get_index_path(log_path);
+    SimpleCppLogger::LogIndexQuery query;
+    bool stats = false;
+
+    for (int i = 2; i < argc; ++i)
+    {
+        const std::string_view argument = argv[i];
+        const bool has_value = i + 1 < argc;
+
+        if (argument == "--stats")
+        {
+            stats = true;
+        }
+        else if (argument == "--index" && has_value)
+        {
+            index_path = argv[++i];
+        }
+        else if ((argument == "--from" || argument == "--to") && has_value)
+        {
+            const auto time = parse_time(argv[++i]);
+            if (!time)
+            {
+                std::fprintf(stderr, "Invalid time: %s\n", argv[i]);
+                return 1;
+            }
+            (argument == "--from" ? query.from : query.to) = time;
+        }
+        else if (argument == "--level" && has_value)
+        {
+            const auto level = SimpleCppLogger::from_string_view(argv[++i]);
+            if (!level)
+            {
+                std::fprintf(stderr, "Unknown level: %s\n", argv[i]);
+                return 1;
+            }
+            query.min_level = *level;
+        }
+        else if (argument == "--token" && has_value)
+        {
+            query.tokens = argv[++i];
+        }
+        else
+        {
+            std::fprintf(stderr, "Unknown argument: %s\n", argv[i]);
+            return 1;
+        }
+    }
+
+    const SimpleCppLogger::LogIndexReader index(index_path);
+    if (!index.is_open())
+    {
+        std::fprintf(stderr, "Cannot read index %s\n", index_path.c_str());
+        return 2;
+    }
+
+    std::unique_ptr<SimpleCppLogger::CompressionCodec> codec;
+    if (!index.get_codec_name().empty())
+    {
+        codec = SimpleCppLogger::CompressionCodec::create(index.get_codec_name());
+        if (!codec)
+        {
+            std::fprintf(stderr, "Unsupported codec: %.*s\n",
+                         static_cast<int>(index.get_codec_name().size()),
+                         index.get_codec_name().data());
+            return 2;
+        }
+    }
+
+    std::FILE* log_file = std::fopen(log_path.c_str(), "rb");
+    if (log_file == nullptr)
+    {
+        std::fprintf(stderr, "Cannot open %s\n", log_path.c_str());
+        return 2;
+    }
+
+    const auto blocks = index.find(query);
+    std::string text;
+    int result = 0;
+
+    for (const auto& block: blocks)
+    {
+        text.clear();
+        if (!SimpleCppLogger::LogIndexReader::read_block(log_file, block, codec.get(), text))
+        {
+            std::fprintf(stderr, "Cannot read the frame at offset %llu\n",
+                         static_cast<unsigned long long>(block.file_offset));
+            result = 2;
+            break;
+        }
+
+        print_lines(text, query.tokens);
+    }
+
+    std::fclose(log_file);
+
+    if (stats)
+    {
+        std::fprintf(stderr, "%zu of %zu frames read\n", blocks.size(),
+                     index.get_blocks().size());
+    }
+
+    return result;
+}
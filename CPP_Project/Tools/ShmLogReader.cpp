@@ -0,0 +1,116 @@
+/**
+ * @file ShmLogReader.cpp
+ * @brief Command-line reader that drains the shared-memory ring of a ShmRingAppender into a file.
+ *
+ * Usage: ShmLogReader <ring name> <output file> [--poll-ms <ms>] [--once] [--remove]
+ *
+ * The reader appends to the output file until it receives SIGINT or SIGTERM, then drains the
+ * ring once more and exits. With --once it drains the ring a single time. With --remove the
+ * shared-memory object is removed on exit.
+ */
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+#include <thread>
+
+#include "SimpleCppLogger/ShmRing.h"
+#include "SimpleCppLogger/ShmRingReader.h"
+
+namespace
+{
+volatile std::sig_atomic_t g_stop = 0;
+
+auto handle_signal(int /*signal*/) -> void
+{
+    g_stop = 1;
+}
+}  // namespace
+
+/**
+ * @brief Parses the arguments and runs the poll loop.
+ *
+ * @param argc Number of command-line arguments.
+ * @param argv Array of command-line arguments.
+ * @return 0 on success, 1 for invalid arguments, 2 if the ring or the file cannot be opened.
+ */
+auto main(int argc, char* argv[]) -> int
+{
+    if (argc < 3)
+    {
+        std::fprintf(stderr,
+                     "Usage: %s <ring name> <output file> [--poll-ms <ms>] [--once] [--remove]\n",
+                     argv[0]);
+        return 1;
+    }
+
+    const std::string name = argv[1];
+    const std::string path = argv[2];
+    auto poll_interval = std::chrono::milliseconds(10);
+    bool once = false;
+    bool remove = false;
+
+    for (int i = 3; i < argc; ++i)
+    {
+        const std::string_view argument = argv[i];
+
+        if (argument == "--once")
+        {
+            once = true;
+        }
+        else if (argument == "--remove")
+        {
+            remove = true;
+        }
+        else if (argument == "--poll-ms" && i + 1 < argc)
+        {
+            poll_interval = std::chrono::milliseconds(std::atoi(argv[++i]));
+        }
+        else
+        {
+            std::fprintf(stderr, "Unknown argument: %s\n", argv[i]);
+            return 1;
+        }
+    }
+
+    SimpleCppLogger::ShmRingReader reader(name);
+    if (!reader.is_open())
+    {
+        std::fprintf(stderr, "Cannot attach to shared-memory ring %s\n", name.c_str());
+        return 2;
+    }
+
+    const int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+    if (fd < 0)
+    {
+        std::fprintf(stderr, "Cannot open %s\n", path.c_str());
+        return 2;
+    }
+
+    std::signal(SIGINT, handle_signal);
+    std::signal(SIGTERM, handle_signal);
+
+    while (!once && g_stop == 0)
+    {
+        if (reader.poll(fd) == 0)
+        {
+            std::this_thread::sleep_for(poll_interval);
+        }
+    }
+
+    reader.poll(fd);
+    ::close(fd);
+
+    if (remove)
+    {
+        SimpleCppLogger::ShmRing::remove(name);
+    }
+
+    return 0;
+}
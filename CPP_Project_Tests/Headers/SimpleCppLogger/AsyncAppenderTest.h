@@ -0,0 +1,39 @@
+#pragma once
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <source_location>
+
+#include "SimpleCppLogger/AsyncAppender.h"
+#include "SimpleCppLogger/LogAppender.h"
+#include "SimpleCppLogger/LogMessage.h"
+
+/**
+ * @file AsyncAppenderTest.h
+ * @brief Test fixture for SimpleCppLogger::AsyncAppender.
+ */
+
+class MockLogAppenderAsync: public SimpleCppLogger::LogAppender
+{
+    public:
+        MockLogAppenderAsync(): LogAppender() {}
+
+        MOCK_METHOD(void, internal_append,
+                    (const SimpleCppLogger::LogMessage& message,
+                     const std::source_location& location),
+                    (override));
+};
+
+class AsyncAppenderTest: public ::testing::Test
+{
+    protected:
+        AsyncAppenderTest() = default;
+        ~AsyncAppenderTest() override = default;
+
+        void SetUp() override;
+        void TearDown() override;
+
+        std::shared_ptr<MockLogAppenderAsync> m_inner;
+};
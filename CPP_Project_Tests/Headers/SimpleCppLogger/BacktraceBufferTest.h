@@ -0,0 +1,18 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+/**
+ * @file BacktraceBufferTest.h
+ * @brief Test fixture for SimpleCppLogger::BacktraceBuffer.
+ */
+
+class BacktraceBufferTest: public ::testing::Test
+{
+    protected:
+        BacktraceBufferTest() = default;
+        ~BacktraceBufferTest() override = default;
+
+        void SetUp() override {}
+        void TearDown() override {}
+};
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <string>
+
+#include "SimpleCppLogger/BatchedConsoleAppender.h"
+#include "SimpleCppLogger/LogMessage.h"
+
+/**
+ * @file BatchedConsoleAppenderTest.h
+ * @brief Test fixture for SimpleCppLogger::BatchedConsoleAppender.
+ *
+ * The appender writes to descriptors of temporary files instead of the real stdout/stderr so
+ * that the written bytes can be inspected.
+ */
+class BatchedConsoleAppenderTest: public ::testing::Test
+{
+    protected:
+        BatchedConsoleAppenderTest() = default;
+        ~BatchedConsoleAppenderTest() override = default;
+
+        void SetUp() override;
+        void TearDown() override;
+
+        [[nodiscard]] auto make_options(SimpleCppLogger::ConsoleFlushPolicy policy) const
+            -> SimpleCppLogger::ConsoleOutputOptions;
+        static auto read_all(std::FILE* file) -> std::string;
+
+        std::FILE* m_out_file = nullptr;
+        std::FILE* m_err_file = nullptr;
+};
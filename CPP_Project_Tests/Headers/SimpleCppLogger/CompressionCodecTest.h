@@ -0,0 +1,17 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+/**
+ * @file CompressionCodecTest.h
+ * @brief Test fixture for SimpleCppLogger::CompressionCodec.
+ */
+class CompressionCodecTest: public ::testing::Test
+{
+    protected:
+        CompressionCodecTest() = default;
+        ~CompressionCodecTest() override = default;
+
+        void SetUp() override {}
+        void TearDown() override {}
+};
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+/**
+ * @file CpuTopologyTest.h
+ * @brief Test fixture for SimpleCppLogger::CpuTopology.
+ */
+
+class CpuTopologyTest: public ::testing::Test
+{
+    protected:
+        CpuTopologyTest() = default;
+        ~CpuTopologyTest() override = default;
+
+        void SetUp() override {}
+        void TearDown() override {}
+};
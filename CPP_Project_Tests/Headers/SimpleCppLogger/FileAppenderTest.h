@@ -0,0 +1,25 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+/**
+ * @file FileAppenderTest.h
+ * @brief Test fixture for SimpleCppLogger::FileAppender.
+ *
+ * Every test writes to its own file in the temporary directory, which is removed in TearDown().
+ */
+class FileAppenderTest: public ::testing::Test
+{
+    protected:
+        FileAppenderTest() = default;
+        ~FileAppenderTest() override = default;
+
+        void SetUp() override;
+        void TearDown() override;
+
+        static auto read_file(const std::string& path) -> std::string;
+
+        std::string m_path;
+};
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+/**
+ * @file FormattingPipelineTest.h
+ * @brief Test fixture for SimpleCppLogger::FormattingPipeline.
+ */
+
+class FormattingPipelineTest: public ::testing::Test
+{
+    protected:
+        FormattingPipelineTest() = default;
+        ~FormattingPipelineTest() override = default;
+
+        void SetUp() override {}
+        void TearDown() override {}
+};
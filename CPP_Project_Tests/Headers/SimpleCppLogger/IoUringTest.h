@@ -0,0 +1,24 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+/**
+ * @file IoUringTest.h
+ * @brief Test fixture for SimpleCppLogger::IoUring.
+ *
+ * Every test writes to its own file in the temporary directory, which is removed in TearDown().
+ * Tests are skipped where io_uring is not available.
+ */
+class IoUringTest: public ::testing::Test
+{
+    protected:
+        IoUringTest() = default;
+        ~IoUringTest() override = default;
+
+        void SetUp() override;
+        void TearDown() override;
+
+        std::string m_path;
+};
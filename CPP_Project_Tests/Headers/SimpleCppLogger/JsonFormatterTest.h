@@ -0,0 +1,18 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+/**
+ * @file JsonFormatterTest.h
+ * @brief Test fixture for SimpleCppLogger::JsonFormatter.
+ */
+
+class JsonFormatterTest: public ::testing::Test
+{
+    protected:
+        JsonFormatterTest() = default;
+        ~JsonFormatterTest() override = default;
+
+        void SetUp() override {}
+        void TearDown() override {}
+};
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+/**
+ * @file LogCategoryRegistryTest.h
+ * @brief Test fixture for SimpleCppLogger::LogCategoryRegistry and SimpleCppLogger::LogCategory.
+ */
+
+class LogCategoryRegistryTest: public ::testing::Test
+{
+    protected:
+        LogCategoryRegistryTest() = default;
+        ~LogCategoryRegistryTest() override = default;
+
+        void SetUp() override {}
+        void TearDown() override {}
+};
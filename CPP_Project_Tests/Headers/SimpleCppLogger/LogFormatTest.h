@@ -0,0 +1,18 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+/**
+ * @file LogFormatTest.h
+ * @brief Test fixture for the std::format-style formatting in SimpleCppLogger/LogFormat.h.
+ */
+
+class LogFormatTest: public ::testing::Test
+{
+    protected:
+        LogFormatTest() = default;
+        ~LogFormatTest() override = default;
+
+        void SetUp() override {}
+        void TearDown() override {}
+};
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+/**
+ * @file LogIndexTest.h
+ * @brief Test fixture for SimpleCppLogger::LogIndexWriter, LogIndexReader and the index written
+ * by FileAppender.
+ *
+ * Every test writes to its own log and index file, which are removed in TearDown().
+ */
+class LogIndexTest: public ::testing::Test
+{
+    protected:
+        LogIndexTest() = default;
+        ~LogIndexTest() override = default;
+
+        void SetUp() override;
+        void TearDown() override;
+
+        std::string m_path;
+        std::string m_index_path;
+};
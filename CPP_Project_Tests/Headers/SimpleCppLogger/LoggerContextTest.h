@@ -0,0 +1,42 @@
+#pragma once
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <source_location>
+#include <string>
+
+#include "SimpleCppLogger/LogAppender.h"
+#include "SimpleCppLogger/LogLevel.h"
+#include "SimpleCppLogger/LoggerContext.h"
+
+/**
+ * @file LoggerContextTest.h
+ * @brief Test fixture for SimpleCppLogger::LoggerContext.
+ */
+
+class MockLogAppenderContext: public SimpleCppLogger::LogAppender
+{
+    public:
+        MockLogAppenderContext(): LogAppender() {}
+
+        MOCK_METHOD(void, internal_append,
+                    (const SimpleCppLogger::LogMessage& message,
+                     const std::source_location& location),
+                    (override));
+};
+
+class LoggerContextTest: public ::testing::Test
+{
+    protected:
+        LoggerContextTest() = default;
+        ~LoggerContextTest() override = default;
+
+        void SetUp() override;
+        void TearDown() override;
+
+        std::unique_ptr<SimpleCppLogger::LoggerContext> m_context;
+        std::shared_ptr<MockLogAppenderContext> m_context_appender;
+        std::shared_ptr<MockLogAppenderContext> m_global_appender;
+};
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+/**
+ * @file MemoryAppenderTest.h
+ * @brief Test fixture for SimpleCppLogger::MemoryAppender.
+ */
+
+class MemoryAppenderTest: public ::testing::Test
+{
+    protected:
+        MemoryAppenderTest() = default;
+        ~MemoryAppenderTest() override = default;
+
+        void SetUp() override {}
+        void TearDown() override {}
+};
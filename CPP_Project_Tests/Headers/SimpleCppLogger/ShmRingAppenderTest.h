@@ -0,0 +1,25 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+/**
+ * @file ShmRingAppenderTest.h
+ * @brief Test fixture for SimpleCppLogger::ShmRingAppender, ShmRing and ShmRingReader.
+ *
+ * Every test uses its own shared-memory object, which is removed in TearDown().
+ */
+class ShmRingAppenderTest: public ::testing::Test
+{
+    protected:
+        ShmRingAppenderTest() = default;
+        ~ShmRingAppenderTest() override = default;
+
+        void SetUp() override;
+        void TearDown() override;
+
+        static auto read_all(int fd) -> std::string;
+
+        std::string m_name;
+};
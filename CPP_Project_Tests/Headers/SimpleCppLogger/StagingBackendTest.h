@@ -0,0 +1,18 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+/**
+ * @file StagingBackendTest.h
+ * @brief Test fixture for SimpleCppLogger::StagingBackend and SimpleCppLogger::StagingBuffer.
+ */
+
+class StagingBackendTest: public ::testing::Test
+{
+    protected:
+        StagingBackendTest() = default;
+        ~StagingBackendTest() override = default;
+
+        void SetUp() override {}
+        void TearDown() override {}
+};
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+/**
+ * @file StaticFormatterTest.h
+ * @brief Test fixture for the StaticFormatter class template.
+ */
+
+class StaticFormatterTest: public ::testing::Test
+{
+    protected:
+        StaticFormatterTest() = default;
+        ~StaticFormatterTest() override = default;
+
+        void SetUp() override {}
+        void TearDown() override {}
+};
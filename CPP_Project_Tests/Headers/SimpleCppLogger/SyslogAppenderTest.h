@@ -0,0 +1,27 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+/**
+ * @file SyslogAppenderTest.h
+ * @brief Test fixture for SimpleCppLogger::SyslogAppender.
+ *
+ * Every test binds its own datagram socket that stands in for the syslog daemon.
+ */
+class SyslogAppenderTest: public ::testing::Test
+{
+    protected:
+        SyslogAppenderTest() = default;
+        ~SyslogAppenderTest() override = default;
+
+        void SetUp() override;
+        void TearDown() override;
+
+        auto receive_all() const -> std::vector<std::string>;
+
+        std::string m_path;
+        int m_listener = -1;
+};
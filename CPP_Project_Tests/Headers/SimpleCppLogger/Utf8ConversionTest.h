@@ -0,0 +1,18 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+/**
+ * @file Utf8ConversionTest.h
+ * @brief Test fixture for the wide-to-UTF-8 conversion in SimpleCppLogger/Utf8Conversion.h.
+ */
+
+class Utf8ConversionTest: public ::testing::Test
+{
+    protected:
+        Utf8ConversionTest() = default;
+        ~Utf8ConversionTest() override = default;
+
+        void SetUp() override {}
+        void TearDown() override {}
+};
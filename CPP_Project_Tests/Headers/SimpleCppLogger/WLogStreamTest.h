@@ -0,0 +1,39 @@
+#pragma once
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <source_location>
+
+#include "SimpleCppLogger/LogAppender.h"
+#include "SimpleCppLogger/LogLevel.h"
+#include "SimpleCppLogger/WLogStream.h"
+
+/**
+ * @file WLogStreamTest.h
+ * @brief Test fixture for SimpleCppLogger::WLogStream and wide-character messages.
+ */
+
+class MockLogAppenderWStream: public SimpleCppLogger::LogAppender
+{
+    public:
+        MockLogAppenderWStream(): LogAppender() {}
+
+        MOCK_METHOD(void, internal_append,
+                    (const SimpleCppLogger::LogMessage& message,
+                     const std::source_location& location),
+                    (override));
+};
+
+class WLogStreamTest: public ::testing::Test
+{
+    protected:
+        WLogStreamTest() = default;
+        ~WLogStreamTest() override = default;
+
+        void SetUp() override;
+        void TearDown() override;
+
+        std::shared_ptr<MockLogAppenderWStream> m_mock_appender;
+};
@@ -0,0 +1,193 @@
+#include "SimpleCppLogger/AsyncAppenderTest.h"
+
+#include <future>
+#include <string>
+#include <vector>
+
+#include "SimpleCppLogger/LogLevel.h"
+#include "SimpleCppLogger/MemoryAppender.h"
+
+using namespace SimpleCppLogger;
+
+/**
+ * @brief Sets up the test fixture by creating the wrapped mock appender.
+ */
+void AsyncAppenderTest::SetUp()
+{
+    m_inner = std::make_shared<MockLogAppenderAsync>();
+    m_inner->set_log_level(LogLevel::Debug);
+}
+
+/**
+ * @brief Tears down the test fixture.
+ */
+void AsyncAppenderTest::TearDown()
+{
+    m_inner.reset();
+}
+
+/**
+ * @brief Tests that queued messages reach the wrapped appender in order.
+ */
+TEST_F(AsyncAppenderTest, DeliversMessagesInOrder)
+{
+    std::vector<std::string> received;
+    EXPECT_CALL(*m_inner, internal_append(::testing::_, ::testing::_))
+        .Times(100)
+        .WillRepeatedly([&received](const LogMessage& message, const std::source_location&) {
+            received.push_back(message.get_message());
+        });
+
+    AsyncAppender appender(m_inner);
+    for (int i = 0; i < 100; ++i)
+    {
+        appender.append(LogMessage(LogLevel::Info, std::to_string(i)));
+    }
+    appender.flush().wait();
+
+    EXPECT_EQ(appender.get_queue_size(), 0u);
+    ASSERT_EQ(received.size(), 100u);
+    for (int i = 0; i < 100; ++i)
+    {
+        EXPECT_EQ(received[i], std::to_string(i));
+    }
+}
+
+/**
+ * @brief Tests that the decorator takes over the wrapped appender's level.
+ */
+TEST_F(AsyncAppenderTest, DecoratorLevelFilters)
+{
+    m_inner->set_log_level(LogLevel::Warning);
+    AsyncAppender appender(m_inner);
+
+    EXPECT_EQ(appender.get_log_level(), LogLevel::Warning);
+    EXPECT_EQ(m_inner->get_log_level(), LogLevel::Trace);
+
+    EXPECT_CALL(*m_inner, internal_append(::testing::_, ::testing::_)).Times(2);
+    appender.append(LogMessage(LogLevel::Info, "filtered"));
+    appender.append(LogMessage(LogLevel::Error, "passes"));
+    appender.set_log_level(LogLevel::Debug);
+    appender.append(LogMessage(LogLevel::Debug, "passes too"));
+    appender.flush().wait();
+}
+
+/**
+ * @brief Tests that a blocked sink does not block the caller with the Drop policy and that
+ * overflowing messages are counted.
+ */
+TEST_F(AsyncAppenderTest, DropPolicyCountsDroppedMessages)
+{
+    std::promise<void> entered;
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    bool first = true;
+
+    EXPECT_CALL(*m_inner, internal_append(::testing::_, ::testing::_))
+        .Times(3)
+        .WillRepeatedly([&](const LogMessage&, const std::source_location&) {
+            if (first)
+            {
+                first = false;
+                entered.set_value();
+                released.wait();
+            }
+        });
+
+    AsyncAppenderOptions options;
+    options.queue_capacity = 2;
+    options.overflow_policy = AsyncOverflowPolicy::Drop;
+    AsyncAppender appender(m_inner, options);
+
+    appender.append(LogMessage(LogLevel::Info, "blocks the sink"));
+    entered.get_future().wait();
+
+    for (int i = 0; i < 4; ++i)
+    {
+        appender.append(LogMessage(LogLevel::Info, "queued or dropped"));
+    }
+
+    EXPECT_EQ(appender.get_queue_size(), 2u);
+    EXPECT_EQ(appender.get_dropped_count(), 2u);
+
+    release.set_value();
+    appender.flush().wait();
+}
+
+/**
+ * @brief Tests that destroying the decorator delivers all queued messages.
+ */
+TEST_F(AsyncAppenderTest, DestructorDrainsQueue)
+{
+    EXPECT_CALL(*m_inner, internal_append(::testing::_, ::testing::_)).Times(10);
+
+    {
+        AsyncAppender appender(m_inner);
+        for (int i = 0; i < 10; ++i)
+        {
+            appender.append(LogMessage(LogLevel::Info, "pending"));
+        }
+    }
+
+    ::testing::Mock::VerifyAndClearExpectations(m_inner.get());
+}
+
+/**
+ * @brief Tests that a batch larger than the queue is delivered in order with the Block policy
+ * and that the decorator level applies to each record.
+ */
+TEST_F(AsyncAppenderTest, BatchIsQueuedInOrder)
+{
+    auto inner = std::make_shared<MemoryAppender>(64);
+    inner->set_log_level(LogLevel::Info);
+
+    AsyncAppenderOptions options;
+    options.queue_capacity = 2;
+    AsyncAppender appender(inner, options);
+
+    std::vector<StagedRecord> records;
+    std::vector<std::string> expected;
+    for (int i = 0; i < 20; ++i)
+    {
+        const LogLevel level = (i % 3 == 0) ? LogLevel::Debug : LogLevel::Info;
+        records.push_back({LogMessage(level, std::to_string(i)), std::source_location{}});
+        if (level == LogLevel::Info)
+        {
+            expected.push_back(std::to_string(i));
+        }
+    }
+
+    appender.append_batch(records);
+    appender.flush().wait();
+
+    EXPECT_EQ(inner->get_texts(), expected);
+    EXPECT_EQ(appender.get_dropped_count(), 0u);
+}
+
+/**
+ * @brief Tests that a flush callback runs after every earlier message reached the wrapped
+ * appender.
+ */
+TEST_F(AsyncAppenderTest, FlushCallbackFollowsQueuedMessages)
+{
+    std::size_t received = 0;
+    EXPECT_CALL(*m_inner, internal_append(::testing::_, ::testing::_))
+        .Times(50)
+        .WillRepeatedly([&received](const LogMessage&, const std::source_location&) {
+            ++received;
+        });
+
+    AsyncAppender appender(m_inner);
+    for (int i = 0; i < 50; ++i)
+    {
+        appender.append(LogMessage(LogLevel::Info, std::to_string(i)));
+    }
+
+    std::promise<std::size_t> flushed;
+    appender.flush([&flushed, &received](bool success) {
+        EXPECT_TRUE(success);
+        flushed.set_value(received);
+    });
+
+    EXPECT_EQ(flushed.get_future().get(), 50u);
+}
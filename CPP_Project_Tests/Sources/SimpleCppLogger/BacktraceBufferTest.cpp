@@ -0,0 +1,71 @@
+#include "SimpleCppLogger/BacktraceBufferTest.h"
+
+#include <source_location>
+#include <string>
+#include <vector>
+
+#include "SimpleCppLogger/BacktraceBuffer.h"
+
+using namespace SimpleCppLogger;
+
+/**
+ * @brief Tests that records are returned oldest first and the buffer is emptied.
+ */
+TEST_F(BacktraceBufferTest, TakeAllReturnsRecordsInOrder)
+{
+    BacktraceBuffer buffer(4);
+    buffer.push(LogMessage(LogLevel::Debug, "a"), std::source_location::current());
+    buffer.push(LogMessage(LogLevel::Trace, "b"), std::source_location::current());
+
+    std::vector<StagedRecord> records;
+    EXPECT_EQ(buffer.take_all(records), 2u);
+    ASSERT_EQ(records.size(), 2u);
+    EXPECT_EQ(records[0].message.get_message(), "a");
+    EXPECT_EQ(records[1].message.get_message(), "b");
+    EXPECT_EQ(buffer.size(), 0u);
+}
+
+/**
+ * @brief Tests that the oldest records are overwritten when the buffer is full.
+ */
+TEST_F(BacktraceBufferTest, OverwritesOldestRecords)
+{
+    BacktraceBuffer buffer(3);
+    for (int i = 0; i < 7; ++i)
+    {
+        buffer.push(LogMessage(LogLevel::Debug, std::to_string(i)), std::source_location{});
+    }
+
+    EXPECT_EQ(buffer.size(), 3u);
+
+    std::vector<StagedRecord> records;
+    buffer.take_all(records);
+    ASSERT_EQ(records.size(), 3u);
+    EXPECT_EQ(records[0].message.get_message(), "4");
+    EXPECT_EQ(records[1].message.get_message(), "5");
+    EXPECT_EQ(records[2].message.get_message(), "6");
+
+    buffer.push(LogMessage(LogLevel::Debug, "next"), std::source_location{});
+    records.clear();
+    buffer.take_all(records);
+    ASSERT_EQ(records.size(), 1u);
+    EXPECT_EQ(records[0].message.get_message(), "next");
+}
+
+/**
+ * @brief Tests that a buffer without capacity keeps nothing and reset changes the capacity.
+ */
+TEST_F(BacktraceBufferTest, ZeroCapacityAndReset)
+{
+    BacktraceBuffer buffer;
+    buffer.push(LogMessage(LogLevel::Debug, "ignored"), std::source_location{});
+    EXPECT_EQ(buffer.size(), 0u);
+
+    buffer.reset(2);
+    EXPECT_EQ(buffer.get_capacity(), 2u);
+    buffer.push(LogMessage(LogLevel::Debug, "kept"), std::source_location{});
+    EXPECT_EQ(buffer.size(), 1u);
+
+    buffer.reset(5);
+    EXPECT_EQ(buffer.size(), 0u);
+}
@@ -0,0 +1,240 @@
+#include "SimpleCppLogger/BatchedConsoleAppenderTest.h"
+
+#include <memory>
+#include <source_location>
+#include <vector>
+
+#include "SimpleCppLogger/SimpleFormatter.h"
+
+using namespace SimpleCppLogger;
+
+/**
+ * @brief Sets up the test fixture by creating temporary files for both output streams.
+ */
+void BatchedConsoleAppenderTest::SetUp()
+{
+    m_out_file = std::tmpfile();
+    m_err_file = std::tmpfile();
+    ASSERT_NE(m_out_file, nullptr);
+    ASSERT_NE(m_err_file, nullptr);
+}
+
+/**
+ * @brief Tears down the test fixture by closing the temporary files.
+ */
+void BatchedConsoleAppenderTest::TearDown()
+{
+    std::fclose(m_out_file);
+    std::fclose(m_err_file);
+}
+
+/**
+ * @brief Creates options that route both streams to the temporary files.
+ */
+auto BatchedConsoleAppenderTest::make_options(ConsoleFlushPolicy policy) const
+    -> ConsoleOutputOptions
+{
+    ConsoleOutputOptions options;
+    options.flush_policy = policy;
+    options.stdout_fd = fileno(m_out_file);
+    options.stderr_fd = fileno(m_err_file);
+    return options;
+}
+
+/**
+ * @brief Reads the whole content of a temporary file.
+ */
+auto BatchedConsoleAppenderTest::read_all(std::FILE* file) -> std::string
+{
+    std::string content;
+    char buffer[4096];
+
+    std::fflush(file);
+    std::rewind(file);
+    while (std::size_t read = std::fread(buffer, 1, sizeof(buffer), file))
+    {
+        content.append(buffer, read);
+    }
+
+    return content;
+}
+
+/**
+ * @brief Tests that with EveryMessage each line is written immediately.
+ */
+TEST_F(BatchedConsoleAppenderTest, EveryMessageWritesImmediately)
+{
+    BatchedConsoleAppender appender(make_options(ConsoleFlushPolicy::EveryMessage));
+    LogMessage msg(LogLevel::Info, "Immediate message");
+    auto location = std::source_location::current();
+    auto expected = SimpleFormatter(false).format(msg, location);
+
+    appender.append(msg, location);
+
+    EXPECT_EQ(appender.get_pending_count(), 0u);
+    EXPECT_EQ(read_all(m_out_file), expected + "\n");
+}
+
+/**
+ * @brief Tests that levels are routed to the stdout and stderr descriptors.
+ */
+TEST_F(BatchedConsoleAppenderTest, LevelsAreRoutedToDescriptors)
+{
+    BatchedConsoleAppender appender(make_options(ConsoleFlushPolicy::EveryMessage));
+
+    appender.append(LogMessage(LogLevel::Debug, "to stdout"));
+    appender.append(LogMessage(LogLevel::Warning, "to stderr"));
+
+    auto out = read_all(m_out_file);
+    auto err = read_all(m_err_file);
+    EXPECT_NE(out.find("to stdout"), std::string::npos);
+    EXPECT_EQ(out.find("to stderr"), std::string::npos);
+    EXPECT_NE(err.find("to stderr"), std::string::npos);
+    EXPECT_EQ(err.find("to stdout"), std::string::npos);
+}
+
+/**
+ * @brief Tests that Batched holds lines until flush() and writes them in order.
+ */
+TEST_F(BatchedConsoleAppenderTest, BatchedHoldsUntilFlush)
+{
+    BatchedConsoleAppender appender(make_options(ConsoleFlushPolicy::Batched));
+
+    appender.append(LogMessage(LogLevel::Info, "first"));
+    appender.append(LogMessage(LogLevel::Info, "second"));
+
+    EXPECT_EQ(appender.get_pending_count(), 2u);
+    EXPECT_TRUE(read_all(m_out_file).empty());
+
+    appender.flush().wait();
+
+    auto out = read_all(m_out_file);
+    EXPECT_EQ(appender.get_pending_count(), 0u);
+    ASSERT_NE(out.find("first"), std::string::npos);
+    ASSERT_NE(out.find("second"), std::string::npos);
+    EXPECT_LT(out.find("first"), out.find("second"));
+}
+
+/**
+ * @brief Tests that Batched flushes once the record limit is reached.
+ */
+TEST_F(BatchedConsoleAppenderTest, BatchedFlushesAtRecordLimit)
+{
+    auto options = make_options(ConsoleFlushPolicy::Batched);
+    options.max_batch_records = 3;
+    BatchedConsoleAppender appender(options);
+
+    appender.append(LogMessage(LogLevel::Info, "one"));
+    appender.append(LogMessage(LogLevel::Info, "two"));
+    EXPECT_EQ(appender.get_pending_count(), 2u);
+
+    appender.append(LogMessage(LogLevel::Info, "three"));
+    EXPECT_EQ(appender.get_pending_count(), 0u);
+    EXPECT_NE(read_all(m_out_file).find("three"), std::string::npos);
+}
+
+/**
+ * @brief Tests that Batched flushes immediately at the flush level, preserving order.
+ */
+TEST_F(BatchedConsoleAppenderTest, BatchedFlushesAtFlushLevel)
+{
+    auto options = make_options(ConsoleFlushPolicy::Batched);
+    options.stderr_fd = options.stdout_fd;
+    BatchedConsoleAppender appender(options);
+
+    appender.append(LogMessage(LogLevel::Info, "context"));
+    appender.append(LogMessage(LogLevel::Warning, "warning"));
+    EXPECT_EQ(appender.get_pending_count(), 2u);
+
+    appender.append(LogMessage(LogLevel::Error, "failure"));
+    EXPECT_EQ(appender.get_pending_count(), 0u);
+
+    auto out = read_all(m_out_file);
+    ASSERT_NE(out.find("failure"), std::string::npos);
+    EXPECT_LT(out.find("context"), out.find("warning"));
+    EXPECT_LT(out.find("warning"), out.find("failure"));
+}
+
+/**
+ * @brief Tests that pending lines are written when the appender is destroyed.
+ */
+TEST_F(BatchedConsoleAppenderTest, DestructorFlushesPendingLines)
+{
+    {
+        BatchedConsoleAppender appender(make_options(ConsoleFlushPolicy::Batched));
+        appender.append(LogMessage(LogLevel::Info, "pending at exit"));
+    }
+
+    EXPECT_NE(read_all(m_out_file).find("pending at exit"), std::string::npos);
+}
+
+/**
+ * @brief Tests that no color codes are written when the outputs are not terminals.
+ */
+TEST_F(BatchedConsoleAppenderTest, NoColorCodesForNonTerminals)
+{
+    EXPECT_FALSE(BatchedConsoleAppender::is_terminal(fileno(m_out_file)));
+
+    BatchedConsoleAppender appender(make_options(ConsoleFlushPolicy::EveryMessage));
+    appender.append(LogMessage(LogLevel::Info, "plain"));
+
+    auto out = read_all(m_out_file);
+    EXPECT_NE(out.find("[Info     ]:"), std::string::npos);
+    EXPECT_EQ(out.find("\033["), std::string::npos);
+}
+
+/**
+ * @brief Tests that an explicitly provided formatter is used as is.
+ */
+TEST_F(BatchedConsoleAppenderTest, ExplicitFormatterIsUsed)
+{
+    BatchedConsoleAppender appender(make_options(ConsoleFlushPolicy::EveryMessage),
+                                    std::make_shared<SimpleFormatter>(true));
+    appender.append(LogMessage(LogLevel::Info, "colored"));
+
+    EXPECT_NE(read_all(m_out_file).find("\033[94m"), std::string::npos);
+}
+
+/**
+ * @brief Tests that messages below the appender level are not written.
+ */
+TEST_F(BatchedConsoleAppenderTest, MessagesBelowLogLevelAreDropped)
+{
+    BatchedConsoleAppender appender(make_options(ConsoleFlushPolicy::EveryMessage));
+    appender.set_log_level(LogLevel::Warning);
+
+    appender.append(LogMessage(LogLevel::Info, "dropped"));
+    appender.flush().wait();
+
+    EXPECT_TRUE(read_all(m_out_file).empty());
+}
+
+/**
+ * @brief Tests that a batch is written at once, after pending lines and routed by level.
+ */
+TEST_F(BatchedConsoleAppenderTest, BatchIsWrittenAfterPendingLines)
+{
+    BatchedConsoleAppender appender(make_options(ConsoleFlushPolicy::Batched));
+    appender.set_log_level(LogLevel::Info);
+    appender.append(LogMessage(LogLevel::Info, "pending"));
+
+    std::vector<StagedRecord> records;
+    records.push_back({LogMessage(LogLevel::Info, "one"), std::source_location{}});
+    records.push_back({LogMessage(LogLevel::Debug, "filtered"), std::source_location{}});
+    records.push_back({LogMessage(LogLevel::Warning, "warning"), std::source_location{}});
+    records.push_back({LogMessage(LogLevel::Info, "two"), std::source_location{}});
+
+    appender.append_batch(records);
+
+    EXPECT_EQ(appender.get_pending_count(), 0u);
+
+    auto out = read_all(m_out_file);
+    auto err = read_all(m_err_file);
+    ASSERT_NE(out.find("pending"), std::string::npos);
+    ASSERT_NE(out.find("one"), std::string::npos);
+    ASSERT_NE(out.find("two"), std::string::npos);
+    EXPECT_LT(out.find("pending"), out.find("one"));
+    EXPECT_LT(out.find("one"), out.find("two"));
+    EXPECT_EQ(out.find("filtered"), std::string::npos);
+    EXPECT_NE(err.find("warning"), std::string::npos);
+}
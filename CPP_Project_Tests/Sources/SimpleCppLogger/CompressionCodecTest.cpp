@@ -0,0 +1,64 @@
+#include "SimpleCppLogger/CompressionCodecTest.h"
+
+#include <string>
+
+#include "SimpleCppLogger/CompressionCodec.h"
+
+using namespace SimpleCppLogger;
+
+/**
+ * @brief Tests that every available codec restores concatenated frames and that create() matches
+ * is_available().
+ */
+TEST_F(CompressionCodecTest, RoundTripOfConcatenatedFrames)
+{
+    for (const auto type: {CompressionType::Zlib, CompressionType::Zstd, CompressionType::Lz4})
+    {
+        auto codec = CompressionCodec::create(type);
+        ASSERT_EQ(codec != nullptr, CompressionCodec::is_available(type));
+
+        if (!codec)
+        {
+            continue;
+        }
+
+        std::string first;
+        std::string second;
+        for (int i = 0; i < 1000; ++i)
+        {
+            first += "[Info]: request " + std::to_string(i) + " completed\n";
+            second += "[Debug]: cache miss for key " + std::to_string(i * 7) + "\n";
+        }
+
+        std::string compressed;
+        ASSERT_TRUE(codec->compress(first, compressed)) << codec->get_name();
+        ASSERT_TRUE(codec->compress(second, compressed)) << codec->get_name();
+        EXPECT_LT(compressed.size(), (first.size() + second.size()) / 4) << codec->get_name();
+
+        std::string restored;
+        ASSERT_TRUE(codec->decompress(compressed, restored)) << codec->get_name();
+        EXPECT_EQ(restored, first + second) << codec->get_name();
+    }
+}
+
+/**
+ * @brief Tests that truncated input is rejected.
+ */
+TEST_F(CompressionCodecTest, RejectsTruncatedFrame)
+{
+    for (const auto type: {CompressionType::Zlib, CompressionType::Zstd, CompressionType::Lz4})
+    {
+        auto codec = CompressionCodec::create(type);
+        if (!codec)
+        {
+            continue;
+        }
+
+        std::string compressed;
+        ASSERT_TRUE(codec->compress(std::string(4096, 'a') + "tail", compressed));
+        compressed.resize(compressed.size() - 4);
+
+        std::string restored;
+        EXPECT_FALSE(codec->decompress(compressed, restored)) << codec->get_name();
+    }
+}
@@ -3,6 +3,7 @@
 #include <iostream>
 #include <source_location>
 #include <string>
+#include <vector>
 
 using namespace SimpleCppLogger;
 
@@ -192,3 +193,45 @@ TEST_F(ConsoleAppenderTest, LogLevelCanBeChangedDynamically)
 
     ASSERT_NE(output.find(expected), std::string::npos);
 }
+
+/**
+ * @brief Tests that preformatted text is written unchanged to the stream selected by the level.
+ */
+TEST_F(ConsoleAppenderTest, PreformattedTextIsWrittenUnchanged)
+{
+    EXPECT_TRUE(m_console_appender->supports_preformatted());
+
+    LogMessage msg(LogLevel::Error, "Preformatted");
+    auto location = std::source_location::current();
+    std::string formatted = m_console_appender->format(msg, location);
+    const std::string expected = formatted + "\n";
+
+    m_console_appender->append_formatted(msg, location, std::move(formatted));
+
+    EXPECT_EQ(m_cerr_stream.str(), expected);
+    EXPECT_TRUE(m_cout_stream.str().empty());
+}
+
+/**
+ * @brief Tests that a batch is written in order and filtered by the appender level.
+ */
+TEST_F(ConsoleAppenderTest, BatchIsWrittenInOrder)
+{
+    m_console_appender->set_log_level(LogLevel::Info);
+
+    std::vector<StagedRecord> records;
+    records.push_back({LogMessage(LogLevel::Info, "first"), std::source_location{}});
+    records.push_back({LogMessage(LogLevel::Debug, "filtered"), std::source_location{}});
+    records.push_back({LogMessage(LogLevel::Error, "error"), std::source_location{}});
+    records.push_back({LogMessage(LogLevel::Info, "second"), std::source_location{}});
+
+    SimpleFormatter formatter;
+    const std::string expected_out = formatter.format(records[0].message, {}) + "\n" +
+                                     formatter.format(records[3].message, {}) + "\n";
+    const std::string expected_err = formatter.format(records[2].message, {}) + "\n";
+
+    m_console_appender->append_batch(records);
+
+    EXPECT_EQ(m_cout_stream.str(), expected_out);
+    EXPECT_EQ(m_cerr_stream.str(), expected_err);
+}
@@ -0,0 +1,37 @@
+#include "SimpleCppLogger/CpuTopologyTest.h"
+
+#include <vector>
+
+#include "SimpleCppLogger/CpuTopology.h"
+
+using namespace SimpleCppLogger;
+
+/**
+ * @brief Tests that an explicit CPU to node table is grouped per node.
+ */
+TEST_F(CpuTopologyTest, GroupsCpusByNode)
+{
+    const CpuTopology topology({0, 0, 1, 1, 0});
+
+    EXPECT_EQ(topology.get_cpu_count(), 5u);
+    EXPECT_EQ(topology.get_node_count(), 2u);
+    EXPECT_EQ(topology.get_node_of_cpu(3), 1u);
+
+    const auto node0 = topology.get_cpus_of_node(0);
+    const auto node1 = topology.get_cpus_of_node(1);
+    EXPECT_EQ(std::vector<int>(node0.begin(), node0.end()), (std::vector<int>{0, 1, 4}));
+    EXPECT_EQ(std::vector<int>(node1.begin(), node1.end()), (std::vector<int>{2, 3}));
+    EXPECT_TRUE(topology.get_cpus_of_node(2).empty());
+}
+
+/**
+ * @brief Tests that the detected topology covers at least one CPU on one node.
+ */
+TEST_F(CpuTopologyTest, DetectsSystemTopology)
+{
+    const CpuTopology& topology = CpuTopology::get();
+
+    EXPECT_GE(topology.get_node_count(), 1u);
+    EXPECT_GE(topology.get_cpu_count(), 1u);
+    EXPECT_FALSE(topology.get_cpus_of_node(0).empty());
+}
@@ -0,0 +1,468 @@
+#include "SimpleCppLogger/FileAppenderTest.h"
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <iterator>
+#include <memory>
+#include <source_location>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <sys/stat.h>
+#endif
+
+#include "SimpleCppLogger/CompressionCodec.h"
+#include "SimpleCppLogger/FileAppender.h"
+#include "SimpleCppLogger/LoggerContext.h"
+
+using namespace SimpleCppLogger;
+
+/**
+ * @brief Chooses a file name that is unique to the test.
+ */
+void FileAppenderTest::SetUp()
+{
+    const auto* test_info = ::testing::UnitTest::GetInstance()->current_test_info();
+    m_path = (std::filesystem::temp_directory_path() /
+              ("SimpleCppLoggerFileAppenderTest_" + std::string(test_info->name()) + ".log"))
+                 .string();
+    std::filesystem::remove(m_path);
+}
+
+/**
+ * @brief Removes the file of the test.
+ */
+void FileAppenderTest::TearDown()
+{
+    std::filesystem::remove(m_path);
+}
+
+/**
+ * @brief Reads the whole file in binary mode.
+ */
+auto FileAppenderTest::read_file(const std::string& path) -> std::string
+{
+    std::ifstream stream(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+}
+
+/**
+ * @brief Tests that lines are written in order and the destructor writes the last frame.
+ */
+TEST_F(FileAppenderTest, WritesLinesOnDestruction)
+{
+    {
+        FileAppender appender(m_path, {}, nullptr);
+        ASSERT_TRUE(appender.is_open());
+        EXPECT_EQ(appender.get_path(), m_path);
+
+        appender.append(LogMessage(LogLevel::Info, "first"));
+        appender.append(LogMessage(LogLevel::Warning, "second"));
+    }
+
+    EXPECT_EQ(read_file(m_path), "first\nsecond\n");
+}
+
+/**
+ * @brief Tests that an existing file is appended to or truncated as configured.
+ */
+TEST_F(FileAppenderTest, AppendOrTruncate)
+{
+    {
+        FileAppender appender(m_path, {}, nullptr);
+        appender.append(LogMessage(LogLevel::Info, "old"));
+    }
+    {
+        FileAppender appender(m_path, {}, nullptr);
+        appender.append(LogMessage(LogLevel::Info, "appended"));
+    }
+    EXPECT_EQ(read_file(m_path), "old\nappended\n");
+
+    {
+        FileAppenderOptions options;
+        options.append = false;
+        FileAppender appender(m_path, options, nullptr);
+        appender.append(LogMessage(LogLevel::Info, "new"));
+    }
+    EXPECT_EQ(read_file(m_path), "new\n");
+}
+
+/**
+ * @brief Tests that a record at the flush level is written without waiting for the interval.
+ */
+TEST_F(FileAppenderTest, FlushLevelCompletesFrame)
+{
+    FileAppenderOptions options;
+    options.flush_interval = std::chrono::hours(1);
+    options.flush_level = LogLevel::Error;
+
+    FileAppender appender(m_path, options, nullptr);
+    appender.append(LogMessage(LogLevel::Info, "buffered"));
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_EQ(appender.get_frame_count(), 0u);
+
+    appender.append(LogMessage(LogLevel::Error, "urgent"));
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (appender.get_frame_count() == 0 && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    EXPECT_EQ(appender.get_frame_count(), 1u);
+    EXPECT_EQ(read_file(m_path), "buffered\nurgent\n");
+}
+
+/**
+ * @brief Tests that buffered lines are written once the flush interval has passed.
+ */
+TEST_F(FileAppenderTest, FlushIntervalCompletesFrame)
+{
+    FileAppenderOptions options;
+    options.flush_interval = std::chrono::milliseconds(20);
+
+    FileAppender appender(m_path, options, nullptr);
+    appender.append(LogMessage(LogLevel::Info, "eventually"));
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (appender.get_frame_count() == 0 && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    EXPECT_EQ(read_file(m_path), "eventually\n");
+}
+
+/**
+ * @brief Tests that a batch is level-filtered and written in order.
+ */
+TEST_F(FileAppenderTest, BatchIsWrittenInOrder)
+{
+    {
+        FileAppender appender(m_path, {}, nullptr);
+        appender.set_log_level(LogLevel::Info);
+
+        std::vector<StagedRecord> records;
+        for (int i = 0; i < 6; ++i)
+        {
+            const LogLevel level = i % 2 == 0 ? LogLevel::Info : LogLevel::Debug;
+            records.push_back({LogMessage(level, std::to_string(i)), std::source_location{}});
+        }
+        appender.append_batch(records);
+    }
+
+    EXPECT_EQ(read_file(m_path), "0\n2\n4\n");
+}
+
+/**
+ * @brief Tests that compressed output consists of independent frames that restore the text.
+ */
+TEST_F(FileAppenderTest, CompressedFramesRestoreText)
+{
+    if (!CompressionCodec::is_available(CompressionType::Zlib))
+    {
+        GTEST_SKIP() << "built without zlib";
+    }
+
+    std::string expected;
+
+    {
+        FileAppenderOptions options;
+        options.codec = CompressionCodec::create(CompressionType::Zlib);
+        options.frame_size = 4096;
+
+        FileAppender appender(m_path, options, nullptr);
+
+        for (int i = 0; i < 2000; ++i)
+        {
+            const std::string text = "request " + std::to_string(i) + " served from cache";
+            appender.append(LogMessage(LogLevel::Info, text));
+            expected += text + "\n";
+        }
+
+        // Full frames are written while logging; only the last one waits for destruction.
+        while (appender.get_input_bytes() + 4096 < expected.size())
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        EXPECT_GT(appender.get_frame_count(), 1u);
+        EXPECT_LT(appender.get_written_bytes() * 4, appender.get_input_bytes());
+    }
+
+    const std::string compressed = read_file(m_path);
+    EXPECT_LT(compressed.size() * 4, expected.size());
+
+    auto codec = CompressionCodec::create(CompressionType::Zlib);
+    std::string restored;
+    ASSERT_TRUE(codec->decompress(compressed, restored));
+    EXPECT_EQ(restored, expected);
+}
+
+/**
+ * @brief Tests that flush() writes the pending frame without waiting for flush_interval.
+ */
+TEST_F(FileAppenderTest, FlushWritesPendingFrame)
+{
+    FileAppenderOptions options;
+    options.flush_interval = std::chrono::minutes(1);
+    FileAppender appender(m_path, options, nullptr);
+
+    appender.append(LogMessage(LogLevel::Info, "first"));
+    EXPECT_TRUE(appender.flush().get());
+    EXPECT_EQ(read_file(m_path), "first\n");
+
+    appender.append(LogMessage(LogLevel::Info, "second"));
+    std::promise<bool> durable;
+    appender.flush([&durable](bool success) { durable.set_value(success); }, FlushMode::Durable);
+    EXPECT_TRUE(durable.get_future().get());
+    EXPECT_EQ(read_file(m_path), "first\nsecond\n");
+
+    EXPECT_TRUE(appender.flush().get());
+    EXPECT_EQ(appender.get_frame_count(), 2u);
+}
+
+/**
+ * @brief Tests that a record at durable_level returns only after it has been synced.
+ */
+TEST_F(FileAppenderTest, DurableLevelWaitsForSync)
+{
+    FileAppenderOptions options;
+    options.flush_interval = std::chrono::minutes(1);
+    options.durable_level = LogLevel::Error;
+    FileAppender appender(m_path, options, nullptr);
+
+    appender.append(LogMessage(LogLevel::Info, "buffered"));
+    EXPECT_EQ(appender.get_sync_count(), 0u);
+
+    appender.append(LogMessage(LogLevel::Error, "committed"));
+    EXPECT_EQ(appender.get_sync_count(), 1u);
+    EXPECT_EQ(read_file(m_path), "buffered\ncommitted\n");
+}
+
+/**
+ * @brief Tests that durable records of concurrent threads share syncs with a sync_interval.
+ */
+TEST_F(FileAppenderTest, GroupCommitSharesSyncs)
+{
+    constexpr int thread_count = 4;
+    constexpr int records_per_thread = 10;
+
+    FileAppenderOptions options;
+    options.sync_interval = std::chrono::milliseconds(20);
+    options.durable_level = LogLevel::Error;
+    FileAppender appender(m_path, options, nullptr);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < thread_count; ++t)
+    {
+        threads.emplace_back([&appender] {
+            for (int i = 0; i < records_per_thread; ++i)
+            {
+                appender.append(LogMessage(LogLevel::Error, "audit"));
+            }
+        });
+    }
+
+    for (auto& thread: threads)
+    {
+        thread.join();
+    }
+
+    const std::string content = read_file(m_path);
+    EXPECT_EQ(std::count(content.begin(), content.end(), '\n'), thread_count * records_per_thread);
+    EXPECT_GE(appender.get_sync_count(), 1u);
+    EXPECT_LT(appender.get_sync_count(),
+              static_cast<std::uint64_t>(thread_count * records_per_thread));
+}
+
+/**
+ * @brief Tests that durable records logged through a LoggerContext from concurrent threads share
+ * syncs, i.e. the context does not hold its lock while the threads wait for the sync.
+ */
+TEST_F(FileAppenderTest, ContextGroupCommitSharesSyncs)
+{
+    constexpr int thread_count = 4;
+    constexpr int records_per_thread = 10;
+
+    FileAppenderOptions options;
+    options.sync_interval = std::chrono::milliseconds(20);
+    options.durable_level = LogLevel::Error;
+    auto appender = std::make_shared<FileAppender>(m_path, options, nullptr);
+
+    LoggerContext context;
+    context.add_appender(appender);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < thread_count; ++t)
+    {
+        threads.emplace_back([&context] {
+            for (int i = 0; i < records_per_thread; ++i)
+            {
+                context.log(LogLevel::Error, std::string("audit"));
+            }
+        });
+    }
+
+    for (auto& thread: threads)
+    {
+        thread.join();
+    }
+
+    const std::string content = read_file(m_path);
+    EXPECT_EQ(std::count(content.begin(), content.end(), '\n'), thread_count * records_per_thread);
+    EXPECT_GE(appender->get_sync_count(), 1u);
+    EXPECT_LT(appender->get_sync_count(),
+              static_cast<std::uint64_t>(thread_count * records_per_thread));
+}
+
+/**
+ * @brief Tests that io_uring writes compressed, indexed frames in order, falling back to write(2)
+ * where io_uring is not available.
+ */
+TEST_F(FileAppenderTest, IoUringWritesFramesInOrder)
+{
+    FileAppenderOptions options;
+    options.frame_size = 16;
+    options.io_uring = true;
+    options.io_uring_depth = 2;
+    options.write_index = true;
+    std::string expected;
+    {
+        FileAppender appender(m_path, options, nullptr);
+
+        for (int i = 0; i < 100; ++i)
+        {
+            const std::string text = "line " + std::to_string(i);
+            appender.append(LogMessage(LogLevel::Info, text));
+            expected += text + '\n';
+        }
+
+        appender.flush().wait();
+        EXPECT_EQ(read_file(m_path), expected);
+        EXPECT_EQ(appender.get_input_bytes(), expected.size());
+    }
+
+    EXPECT_EQ(read_file(m_path), expected);
+
+    const LogIndexReader index(get_index_path(m_path));
+    ASSERT_TRUE(index.is_open());
+    std::uint64_t offset = 0;
+    for (const auto& block: index.get_blocks())
+    {
+        EXPECT_EQ(block.file_offset, offset);
+        offset += block.stored_size;
+    }
+    EXPECT_EQ(offset, expected.size());
+    std::filesystem::remove(get_index_path(m_path));
+}
+
+/**
+ * @brief Tests that io_uring appends to an existing file and that durable records wait for the
+ * submitted sync.
+ */
+TEST_F(FileAppenderTest, IoUringDurableLevelWaitsForSync)
+{
+    std::ofstream(m_path) << "old\n";
+
+    FileAppenderOptions options;
+    options.flush_interval = std::chrono::minutes(1);
+    options.durable_level = LogLevel::Error;
+    options.io_uring = true;
+    FileAppender appender(m_path, options, nullptr);
+
+    appender.append(LogMessage(LogLevel::Info, "buffered"));
+    appender.append(LogMessage(LogLevel::Error, "committed"));
+    EXPECT_EQ(appender.get_sync_count(), 1u);
+    EXPECT_EQ(read_file(m_path), "old\nbuffered\ncommitted\n");
+    EXPECT_TRUE(appender.flush(FlushMode::Durable).get());
+}
+
+/**
+ * @brief Tests that preallocation reserves extents ahead of the content without growing the file,
+ * so readers never see the reservation, and that closing releases the unused reservation.
+ */
+TEST_F(FileAppenderTest, PreallocationKeepsFileSize)
+{
+    constexpr std::uint64_t preallocate_size = 1024 * 1024;
+
+    FileAppenderOptions options;
+    options.preallocate_size = preallocate_size;
+    std::string expected;
+    {
+        FileAppender appender(m_path, options, nullptr);
+
+        for (int i = 0; i < 100; ++i)
+        {
+            const std::string text = "line " + std::to_string(i);
+            appender.append(LogMessage(LogLevel::Info, text));
+            expected += text + '\n';
+        }
+
+        appender.flush().wait();
+        EXPECT_EQ(read_file(m_path), expected);
+        EXPECT_EQ(std::filesystem::file_size(m_path), expected.size());
+#ifdef __linux__
+        struct stat status{};
+        ASSERT_EQ(::stat(m_path.c_str(), &status), 0);
+        EXPECT_GE(static_cast<std::uint64_t>(status.st_blocks) * 512, preallocate_size);
+#endif
+    }
+
+    EXPECT_EQ(read_file(m_path), expected);
+#ifdef __linux__
+    struct stat status{};
+    ASSERT_EQ(::stat(m_path.c_str(), &status), 0);
+    EXPECT_LE(static_cast<std::uint64_t>(status.st_blocks) * 512,
+              static_cast<std::uint64_t>(status.st_size) + 64 * 1024);
+#endif
+}
+
+/**
+ * @brief Tests that O_DIRECT output, written in whole pages, continues an existing file across
+ * several stages and partial pages, and that the index entries match the written frames.
+ */
+TEST_F(FileAppenderTest, DirectIoContinuesPartialPages)
+{
+    std::ofstream(m_path) << "old\n";
+
+    FileAppenderOptions options;
+    options.frame_size = 1000;
+    options.direct_io = true;
+    options.write_index = true;
+    std::string expected = "old\n";
+    {
+        FileAppender appender(m_path, options, nullptr);
+
+        for (int i = 0; i < 20000; ++i)
+        {
+            const std::string text = "line " + std::to_string(i);
+            appender.append(LogMessage(LogLevel::Info, text));
+            expected += text + '\n';
+
+            if (i % 5000 == 0)
+            {
+                EXPECT_TRUE(appender.flush().get());
+                EXPECT_EQ(read_file(m_path).substr(0, expected.size()), expected);
+            }
+        }
+    }
+
+    EXPECT_EQ(read_file(m_path), expected);
+
+    const LogIndexReader index(get_index_path(m_path));
+    ASSERT_TRUE(index.is_open());
+    std::uint64_t offset = 4;
+    for (const auto& block: index.get_blocks())
+    {
+        EXPECT_EQ(block.file_offset, offset);
+        offset += block.stored_size;
+    }
+    EXPECT_EQ(offset, expected.size());
+    std::filesystem::remove(get_index_path(m_path));
+}
@@ -0,0 +1,103 @@
+#include "SimpleCppLogger/FormattingPipelineTest.h"
+
+#include <cstdint>
+#include <memory>
+#include <source_location>
+#include <string>
+#include <vector>
+
+#include "SimpleCppLogger/ConsoleAppender.h"
+#include "SimpleCppLogger/FormattingPipeline.h"
+#include "SimpleCppLogger/LogAppender.h"
+#include "SimpleCppLogger/LogLevel.h"
+#include "SimpleCppLogger/LogMessage.h"
+
+using namespace SimpleCppLogger;
+
+namespace
+{
+/**
+ * @brief An appender that does not support preformatted output and ignores all messages.
+ */
+class PlainAppender: public LogAppender
+{
+    private:
+        auto internal_append(const LogMessage& /*message*/,
+                             const std::source_location& /*location*/) -> void override
+        {}
+};
+
+auto make_task(int first, int count) -> FormattingTask
+{
+    FormattingTask task;
+    for (int i = first; i < first + count; ++i)
+    {
+        task.records.push_back(
+            StagedRecord{LogMessage(LogLevel::Info, std::to_string(i)), {}, 0});
+    }
+    return task;
+}
+}  // namespace
+
+/**
+ * @brief Tests that only appenders supporting preformatted output get formatted text, and only
+ * for records that pass the appender's level.
+ */
+TEST_F(FormattingPipelineTest, FormatsOnlyPreformattingAppenders)
+{
+    auto console = std::make_shared<ConsoleAppender>();
+    auto plain = std::make_shared<PlainAppender>();
+
+    FormattingTask task = make_task(0, 2);
+    task.records[0] = StagedRecord{LogMessage(LogLevel::Debug, "quiet"), {}, 0};
+    task.appenders = {console, plain};
+    task.levels = {LogLevel::Info, LogLevel::Info};
+
+    FormattingPipeline::format_task(task);
+
+    ASSERT_EQ(task.formatted.size(), 2u);
+    ASSERT_EQ(task.formatted[0].size(), 2u);
+    EXPECT_TRUE(task.formatted[0][0].empty());
+    EXPECT_EQ(task.formatted[0][1],
+              console->format(task.records[1].message, task.records[1].location));
+    EXPECT_TRUE(task.formatted[1].empty());
+}
+
+/**
+ * @brief Tests that tasks are written in submission order regardless of which worker finishes
+ * first.
+ */
+TEST_F(FormattingPipelineTest, WritesTasksInSubmissionOrder)
+{
+    std::vector<std::uint64_t> sequences;
+    std::vector<std::string> messages;
+
+    {
+        FormattingPipeline pipeline(4, 8, [&](FormattingTask& task) {
+            sequences.push_back(task.sequence);
+            for (const auto& record: task.records)
+            {
+                messages.push_back(record.message.get_message());
+            }
+        });
+        EXPECT_EQ(pipeline.get_worker_count(), 4u);
+
+        for (int i = 0; i < 100; ++i)
+        {
+            pipeline.submit(make_task(i * 10, 10));
+        }
+
+        pipeline.wait_idle();
+        EXPECT_EQ(sequences.size(), 100u);
+    }
+
+    ASSERT_EQ(messages.size(), 1000u);
+    for (std::size_t i = 0; i < sequences.size(); ++i)
+    {
+        EXPECT_EQ(sequences[i], i);
+    }
+    for (std::size_t i = 0; i < messages.size(); ++i)
+    {
+        EXPECT_EQ(messages[i], std::to_string(i));
+    }
+}
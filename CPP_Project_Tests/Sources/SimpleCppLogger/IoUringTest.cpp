@@ -0,0 +1,111 @@
+#include "SimpleCppLogger/IoUringTest.h"
+
+#include <array>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <set>
+#include <span>
+#include <string>
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include "SimpleCppLogger/IoUring.h"
+
+using namespace SimpleCppLogger;
+
+/**
+ * @brief Chooses a file name that is unique to the test.
+ */
+void IoUringTest::SetUp()
+{
+    const auto* test_info = ::testing::UnitTest::GetInstance()->current_test_info();
+    m_path = (std::filesystem::temp_directory_path() /
+              ("SimpleCppLoggerIoUringTest_" + std::string(test_info->name()) + ".log"))
+                 .string();
+    std::filesystem::remove(m_path);
+}
+
+/**
+ * @brief Removes the file of the test.
+ */
+void IoUringTest::TearDown()
+{
+    std::filesystem::remove(m_path);
+}
+
+/**
+ * @brief Tests that positional writes from plain and registered buffers land at their offsets,
+ * and that the sync completes after them.
+ */
+TEST_F(IoUringTest, WritesAtOffsetsAndSyncs)
+{
+    IoUring ring(4);
+    if (!ring.is_open())
+    {
+        GTEST_SKIP() << "io_uring is not available";
+    }
+
+#ifdef __linux__
+    const int fd = ::open(m_path.c_str(), O_WRONLY | O_CREAT | O_CLOEXEC, 0644);
+    ASSERT_GE(fd, 0);
+
+    std::array<char, 6> first{'h', 'e', 'l', 'l', 'o', ' '};
+    std::array<char, 6> second{'w', 'o', 'r', 'l', 'd', '\n'};
+    const std::array<std::span<char>, 1> registered{std::span<char>(second)};
+    const int fixed = ring.register_buffers(registered) ? 0 : -1;
+
+    ASSERT_TRUE(ring.prepare_write(fd, second, first.size(), 2, fixed));
+    ASSERT_TRUE(ring.prepare_write(fd, first, 0, 1));
+    ASSERT_TRUE(ring.prepare_sync(fd, 3));
+    ASSERT_TRUE(ring.submit());
+
+    std::set<std::uint64_t> completed;
+    for (int i = 0; i < 3; ++i)
+    {
+        IoUringCompletion completion;
+        ASSERT_TRUE(ring.wait(completion));
+        EXPECT_GE(completion.result, 0);
+
+        if (completion.user_data == 3)
+        {
+            // The sync drains every earlier operation first.
+            EXPECT_EQ(completed.size(), 2u);
+        }
+        else
+        {
+            EXPECT_EQ(completion.result, 6);
+        }
+        completed.insert(completion.user_data);
+    }
+
+    EXPECT_EQ(completed, (std::set<std::uint64_t>{1, 2, 3}));
+    ::close(fd);
+
+    std::ifstream stream(m_path, std::ios::binary);
+    EXPECT_EQ(std::string(std::istreambuf_iterator<char>(stream), {}), "hello world\n");
+#endif
+}
+
+/**
+ * @brief Tests that a no-op completes with its user data.
+ */
+TEST_F(IoUringTest, NopCompletes)
+{
+    IoUring ring(2);
+    if (!ring.is_open())
+    {
+        GTEST_SKIP() << "io_uring is not available";
+    }
+
+    ASSERT_TRUE(ring.prepare_nop(42));
+    ASSERT_TRUE(ring.submit());
+
+    IoUringCompletion completion;
+    ASSERT_TRUE(ring.wait(completion));
+    EXPECT_EQ(completion.user_data, 42u);
+    EXPECT_EQ(completion.result, 0);
+}
@@ -0,0 +1,194 @@
+#include "SimpleCppLogger/JsonFormatterTest.h"
+
+#include <regex>
+#include <source_location>
+#include <string>
+
+#include "SimpleCppLogger/JsonFormatter.h"
+#include "SimpleCppLogger/LogLevel.h"
+#include "SimpleCppLogger/LogMessage.h"
+
+using namespace SimpleCppLogger;
+
+namespace
+{
+auto escape(std::string_view text) -> std::string
+{
+    std::string out;
+    JsonFormatter::append_escaped(out, text);
+    return out;
+}
+}  // namespace
+
+/**
+ * @brief Tests that the formatted output is a single JSON object with level and message.
+ */
+TEST_F(JsonFormatterTest, ContainsLevelAndMessage)
+{
+    JsonFormatter formatter;
+    LogMessage msg(LogLevel::Warning, "Disk almost full");
+    auto formatted = formatter.format(msg, std::source_location::current());
+
+    EXPECT_EQ(formatted.front(), '{');
+    EXPECT_EQ(formatted.back(), '}');
+    EXPECT_NE(formatted.find("\"level\":\"Warning\""), std::string::npos);
+    EXPECT_NE(formatted.find("\"message\":\"Disk almost full\""), std::string::npos);
+    EXPECT_EQ(formatted.find('\n'), std::string::npos);
+}
+
+/**
+ * @brief Tests that the timestamp is rendered as ISO 8601 UTC with milliseconds.
+ */
+TEST_F(JsonFormatterTest, ContainsIsoTimestamp)
+{
+    JsonFormatter formatter;
+    LogMessage msg(LogLevel::Info, "Time");
+    auto formatted = formatter.format(msg, std::source_location::current());
+
+    std::regex timestamp_regex(
+        R"("timestamp":"\d{4}-\d{2}-\d{2}T\d{2}:\d{2}:\d{2}\.\d{3}Z")");
+    EXPECT_TRUE(std::regex_search(formatted, timestamp_regex));
+}
+
+/**
+ * @brief Tests that file, line and function of the source location are included.
+ */
+TEST_F(JsonFormatterTest, ContainsFileLineFunction)
+{
+    JsonFormatter formatter;
+    LogMessage msg(LogLevel::Error, "Context");
+    auto location = std::source_location::current();
+    auto formatted = formatter.format(msg, location);
+
+    EXPECT_NE(formatted.find("\"file\":\"" + escape(location.file_name()) + "\""),
+              std::string::npos);
+    EXPECT_NE(formatted.find("\"line\":" + std::to_string(location.line())), std::string::npos);
+    EXPECT_NE(formatted.find("\"function\":\"" + escape(location.function_name()) + "\""),
+              std::string::npos);
+}
+
+/**
+ * @brief Tests that an empty source location omits the location fields.
+ */
+TEST_F(JsonFormatterTest, EmptyLocationOmitsFields)
+{
+    JsonFormatter formatter;
+    LogMessage msg(LogLevel::Info, "No location");
+    auto formatted = formatter.format(msg, std::source_location{});
+
+    EXPECT_EQ(formatted.find("\"file\""), std::string::npos);
+    EXPECT_EQ(formatted.find("\"line\""), std::string::npos);
+    EXPECT_EQ(formatted.find("\"function\""), std::string::npos);
+}
+
+/**
+ * @brief Tests that an out-of-range level is reported as Unknown.
+ */
+TEST_F(JsonFormatterTest, UnknownLogLevel)
+{
+    JsonFormatter formatter;
+    LogMessage msg(static_cast<LogLevel>(static_cast<int>(LogLevel::Count) + 1), "X");
+    auto formatted = formatter.format(msg, std::source_location{});
+
+    EXPECT_NE(formatted.find("\"level\":\"Unknown\""), std::string::npos);
+}
+
+/**
+ * @brief Tests the escape sequences for quotes, backslashes and control characters.
+ */
+TEST_F(JsonFormatterTest, EscapesSpecialCharacters)
+{
+    EXPECT_EQ(escape("a\"b"), "a\\\"b");
+    EXPECT_EQ(escape("a\\b"), "a\\\\b");
+    EXPECT_EQ(escape("a\nb\rc\td"), "a\\nb\\rc\\td");
+    EXPECT_EQ(escape("\b\f"), "\\b\\f");
+    EXPECT_EQ(escape(std::string_view("\x01\x1f\0", 3)), "\\u0001\\u001f\\u0000");
+}
+
+/**
+ * @brief Tests that clean ASCII and UTF-8 text is copied unchanged.
+ */
+TEST_F(JsonFormatterTest, CleanTextIsCopiedVerbatim)
+{
+    std::string clean(1000, 'x');
+    EXPECT_EQ(escape(clean), clean);
+    EXPECT_EQ(escape("Grüße 🌍 测试"), "Grüße 🌍 测试");
+    EXPECT_EQ(escape(""), "");
+}
+
+/**
+ * @brief Tests escaping at every position of texts longer than one vector block.
+ *
+ * Covers the vectorized block loop as well as the scalar tail for all offsets.
+ */
+TEST_F(JsonFormatterTest, EscapesAtEveryPosition)
+{
+    for (std::size_t length = 1; length <= 80; ++length)
+    {
+        for (std::size_t index = 0; index < length; ++index)
+        {
+            std::string text(length, 'a');
+            text[index] = '"';
+
+            std::string expected(index, 'a');
+            expected += "\\\"";
+            expected.append(length - index - 1, 'a');
+
+            ASSERT_EQ(escape(text), expected) << "length " << length << ", index " << index;
+        }
+    }
+}
+
+/**
+ * @brief Tests that bytes above 0x7F are not mistaken for control characters.
+ */
+TEST_F(JsonFormatterTest, HighBytesAreNotEscaped)
+{
+    std::string text;
+    for (int c = 0x80; c <= 0xFF; ++c)
+    {
+        text += static_cast<char>(c);
+    }
+
+    EXPECT_EQ(escape(text), text);
+}
+
+/**
+ * @brief Tests that the message is escaped inside the JSON object.
+ */
+TEST_F(JsonFormatterTest, MessageIsEscaped)
+{
+    JsonFormatter formatter;
+    LogMessage msg(LogLevel::Debug, "Line1\nLine2 \"quoted\"");
+    auto formatted = formatter.format(msg, std::source_location{});
+
+    EXPECT_NE(formatted.find("\"message\":\"Line1\\nLine2 \\\"quoted\\\"\""), std::string::npos);
+    EXPECT_EQ(formatted.find('\n'), std::string::npos);
+}
+
+/**
+ * @brief Tests that the category is emitted only for categorized messages.
+ */
+TEST_F(JsonFormatterTest, CategoryField)
+{
+    JsonFormatter formatter;
+
+    auto categorized = formatter.format(LogMessage(LogLevel::Info, "M", "Network"));
+    auto plain = formatter.format(LogMessage(LogLevel::Info, "M"));
+
+    EXPECT_NE(categorized.find("\"category\":\"Network\""), std::string::npos);
+    EXPECT_EQ(plain.find("\"category\""), std::string::npos);
+}
+
+/**
+ * @brief Tests that an explicit source context is emitted when the location is empty.
+ */
+TEST_F(JsonFormatterTest, ExplicitSourceContextFields)
+{
+    JsonFormatter formatter;
+    LogMessage msg(LogLevel::Info, "Bridged", "", "script.py", 7, "on_event");
+    auto formatted = formatter.format(msg, std::source_location{});
+
+    EXPECT_NE(formatted.find("\"file\":\"script.py\",\"line\":7,\"function\":\"on_event\""),
+              std::string::npos);
+}
@@ -0,0 +1,141 @@
+#include "SimpleCppLogger/LogCategoryRegistryTest.h"
+
+#include <string>
+
+#include "SimpleCppLogger/LogCategory.h"
+#include "SimpleCppLogger/LogCategoryRegistry.h"
+#include "SimpleCppLogger/LogLevel.h"
+
+using namespace SimpleCppLogger;
+
+/**
+ * @brief Tests that a default-constructed handle is invalid and does not filter.
+ */
+TEST_F(LogCategoryRegistryTest, DefaultHandleIsInvalid)
+{
+    LogCategory category;
+    EXPECT_FALSE(category.is_valid());
+    EXPECT_TRUE(category.get_name().empty());
+    EXPECT_TRUE(category.is_enabled(LogLevel::Trace));
+}
+
+/**
+ * @brief Tests that registering the same name twice returns the same id.
+ */
+TEST_F(LogCategoryRegistryTest, RegisterAssignsStableIds)
+{
+    LogCategoryRegistry registry;
+    auto net = registry.get_or_register("Network");
+    auto db = registry.get_or_register("Database");
+
+    EXPECT_TRUE(net.is_valid());
+    EXPECT_EQ(net.get_name(), "Network");
+    EXPECT_NE(net.get_id(), db.get_id());
+    EXPECT_NE(net.get_id(), 0u);
+    EXPECT_EQ(registry.get_or_register(std::string("Network")).get_id(), net.get_id());
+    EXPECT_EQ(registry.size(), 3u);
+}
+
+/**
+ * @brief Tests that find only returns registered categories.
+ */
+TEST_F(LogCategoryRegistryTest, FindRegisteredCategory)
+{
+    LogCategoryRegistry registry;
+    EXPECT_FALSE(registry.find("Network").has_value());
+
+    auto net = registry.get_or_register("Network");
+    auto found = registry.find("Network");
+    ASSERT_TRUE(found.has_value());
+    EXPECT_EQ(found->get_id(), net.get_id());
+}
+
+/**
+ * @brief Tests that categories follow the default level until overridden.
+ */
+TEST_F(LogCategoryRegistryTest, CategoriesFollowDefaultLevel)
+{
+    LogCategoryRegistry registry;
+    auto net = registry.get_or_register("Network");
+
+    registry.set_default_level(LogLevel::Warning);
+    EXPECT_EQ(registry.get_level(net), LogLevel::Warning);
+    EXPECT_FALSE(net.is_enabled(LogLevel::Info));
+    EXPECT_TRUE(net.is_enabled(LogLevel::Warning));
+
+    auto late = registry.get_or_register("Late");
+    EXPECT_EQ(registry.get_level(late), LogLevel::Warning);
+}
+
+/**
+ * @brief Tests that an explicit level overrides the default level and can be reset.
+ */
+TEST_F(LogCategoryRegistryTest, OverrideAndReset)
+{
+    LogCategoryRegistry registry;
+    auto net = registry.get_or_register("Network");
+    auto db = registry.get_or_register("Database");
+    registry.set_default_level(LogLevel::Warning);
+
+    registry.set_level(net, LogLevel::Debug);
+    EXPECT_TRUE(net.is_enabled(LogLevel::Debug));
+    EXPECT_FALSE(db.is_enabled(LogLevel::Debug));
+    EXPECT_EQ(registry.get_lowest_level(), LogLevel::Debug);
+
+    registry.set_default_level(LogLevel::Error);
+    EXPECT_EQ(registry.get_level(net), LogLevel::Debug);
+    EXPECT_EQ(registry.get_level(db), LogLevel::Error);
+
+    registry.reset_level(net);
+    EXPECT_EQ(registry.get_level(net), LogLevel::Error);
+    EXPECT_EQ(registry.get_lowest_level(), LogLevel::Error);
+}
+
+/**
+ * @brief Tests that handles from another registry are ignored.
+ */
+TEST_F(LogCategoryRegistryTest, ForeignHandlesAreIgnored)
+{
+    LogCategoryRegistry registry;
+    LogCategoryRegistry other;
+    auto foreign = other.get_or_register("Network");
+    registry.get_or_register("Network");
+
+    registry.set_level(foreign, LogLevel::Fatal);
+    EXPECT_EQ(other.get_level(foreign), LogLevel::Debug);
+    EXPECT_EQ(registry.get_lowest_level(), LogLevel::Debug);
+}
+
+/**
+ * @brief Tests that a full registry hands out the default category.
+ */
+TEST_F(LogCategoryRegistryTest, FullRegistryReturnsDefaultCategory)
+{
+    LogCategoryRegistry registry;
+
+    for (std::size_t i = 1; i < LogCategoryRegistry::MaxCategories; ++i)
+    {
+        EXPECT_EQ(registry.get_or_register("Category" + std::to_string(i)).get_id(), i);
+    }
+
+    auto overflow = registry.get_or_register("Overflow");
+    EXPECT_TRUE(overflow.is_valid());
+    EXPECT_EQ(overflow.get_id(), 0u);
+    EXPECT_TRUE(overflow.get_name().empty());
+    EXPECT_EQ(registry.size(), LogCategoryRegistry::MaxCategories);
+}
+
+/**
+ * @brief Tests that the default category cannot be overridden.
+ */
+TEST_F(LogCategoryRegistryTest, DefaultCategoryFollowsDefaultLevel)
+{
+    LogCategoryRegistry registry;
+    auto unnamed = registry.get_or_register("");
+
+    registry.set_level(unnamed, LogLevel::Trace);
+    registry.set_default_level(LogLevel::Error);
+
+    EXPECT_EQ(unnamed.get_id(), 0u);
+    EXPECT_EQ(registry.get_level(unnamed), LogLevel::Error);
+}
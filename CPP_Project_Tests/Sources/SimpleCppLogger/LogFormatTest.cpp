@@ -0,0 +1,101 @@
+#include "SimpleCppLogger/LogFormatTest.h"
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <string_view>
+
+#include "SimpleCppLogger/LogFormat.h"
+
+using namespace SimpleCppLogger;
+
+namespace
+{
+template <typename... Args>
+auto to_text(FormatString<Args...> format, const Args&... args) -> std::string
+{
+    std::string text;
+    append_format(text, format, args...);
+    return text;
+}
+}  // namespace
+
+/**
+ * @brief Tests that format strings are checked against the argument types at compile time.
+ */
+TEST_F(LogFormatTest, FormatStringsAreCheckedAtCompileTime)
+{
+    static_assert(detail::is_valid_format<>("plain {{text}}"));
+    static_assert(detail::is_valid_format<int, const char*>("{} {:>8}"));
+    static_assert(detail::is_valid_format<int, int>("{1} {0} {1}"));
+    static_assert(detail::is_valid_format<int, double>("{}"));
+
+    static_assert(!detail::is_valid_format<int>("{} {}"));
+    static_assert(!detail::is_valid_format<int>("{"));
+    static_assert(!detail::is_valid_format<int>("{}}"));
+    static_assert(!detail::is_valid_format<int, int>("{} {1}"));
+    static_assert(!detail::is_valid_format<int>("{:s}"));
+    static_assert(!detail::is_valid_format<int>("{:.2}"));
+    static_assert(!detail::is_valid_format<int>("{:{}}"));
+    static_assert(!detail::is_valid_format<std::string>("{:d}"));
+    static_assert(!detail::is_valid_format<double>("{:x}"));
+    static_assert(!detail::is_valid_format<double>("{:#g}"));
+    static_assert(!detail::is_valid_format<bool>("{:+}"));
+}
+
+/**
+ * @brief Tests literal text, escaped braces and automatic and manual argument indexing.
+ */
+TEST_F(LogFormatTest, ReplacesFieldsInOrder)
+{
+    EXPECT_EQ(to_text("x={} y={}", 7, "seven"), "x=7 y=seven");
+    EXPECT_EQ(to_text("{{}} {}", 1), "{} 1");
+    EXPECT_EQ(to_text("{1} {0} {1}", 'a', 'b'), "b a b");
+    EXPECT_EQ(to_text("no fields"), "no fields");
+
+    std::string text = "prefix ";
+    append_format(text, "{}", 1);
+    EXPECT_EQ(text, "prefix 1");
+}
+
+/**
+ * @brief Tests integer presentation types, signs, alignment and zero padding.
+ */
+TEST_F(LogFormatTest, FormatsIntegers)
+{
+    EXPECT_EQ(to_text("{:5}|{:<5}|{:^6}|{:*>6}", 42, 42, 42, 42), "   42|42   |  42  |****42");
+    EXPECT_EQ(to_text("{:+} {: } {:05}", 42, 42, -42), "+42  42 -0042");
+    EXPECT_EQ(to_text("{:#x} {:#X} {:b} {:#o} {:#010x}", 255, 255, 5, 8, 255),
+              "0xff 0XFF 101 010 0x000000ff");
+    EXPECT_EQ(to_text("{}", std::numeric_limits<std::int64_t>::min()), "-9223372036854775808");
+    EXPECT_EQ(to_text("{}", std::numeric_limits<std::uint64_t>::max()), "18446744073709551615");
+    EXPECT_EQ(to_text("{:c}", 65), "A");
+}
+
+/**
+ * @brief Tests the shortest round-trip default and the fixed, scientific and general notations.
+ */
+TEST_F(LogFormatTest, FormatsFloatingPointNumbers)
+{
+    EXPECT_EQ(to_text("{} {} {}", 1.25, 0.1, 1e20), "1.25 0.1 1e+20");
+    EXPECT_EQ(to_text("{:.3f} {:e} {:E}", 1.25, 1234.5, 1234.5), "1.250 1.234500e+03 1.234500E+03");
+    EXPECT_EQ(to_text("{:g} {:.2}", 0.0001, 3.14159), "0.0001 3.1");
+    EXPECT_EQ(to_text("{:08.2f} {:+.1f}", -3.14159, 2.0), "-0003.14 +2.0");
+    EXPECT_EQ(to_text("{} {:06}", std::numeric_limits<double>::infinity(),
+                      -std::numeric_limits<double>::infinity()),
+              "inf   -inf");
+}
+
+/**
+ * @brief Tests strings, bools, characters and pointers.
+ */
+TEST_F(LogFormatTest, FormatsTextAndPointers)
+{
+    const char* null_text = nullptr;
+    EXPECT_EQ(to_text("{:>6}|{:.2}|{:-^7}", "abc", std::string("abcdef"), std::string_view("abc")),
+              "   abc|ab|--abc--");
+    EXPECT_EQ(to_text("[{}]", null_text), "[]");
+    EXPECT_EQ(to_text("{} {:d} {:>6}", true, true, false), "true 1  false");
+    EXPECT_EQ(to_text("{} {:d} {:3}|", 'x', 'A', 'x'), "x 65 x  |");
+    EXPECT_EQ(to_text("{} {:p}", nullptr, reinterpret_cast<const void*>(0x10)), "0x0 0x10");
+}
@@ -0,0 +1,272 @@
+#include "SimpleCppLogger/LogIndexTest.h"
+
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "SimpleCppLogger/CompressionCodec.h"
+#include "SimpleCppLogger/FileAppender.h"
+#include "SimpleCppLogger/LogIndex.h"
+
+using namespace SimpleCppLogger;
+
+namespace
+{
+/**
+ * @brief Writes Info records with the numbers [first, last) and an Error record for each
+ * multiple of 1000 into the appender.
+ */
+auto write_records(FileAppender& appender, int first, int last) -> void
+{
+    for (int i = first; i < last; ++i)
+    {
+        if (i % 1000 == 999)
+        {
+            appender.append(LogMessage(LogLevel::Error, "disk failure code" + std::to_string(i)));
+        }
+        else
+        {
+            appender.append(LogMessage(LogLevel::Info, "request id" + std::to_string(i)));
+        }
+    }
+}
+}  // namespace
+
+/**
+ * @brief Chooses file names that are unique to the test.
+ */
+void LogIndexTest::SetUp()
+{
+    const auto* test_info = ::testing::UnitTest::GetInstance()->current_test_info();
+    m_path = (std::filesystem::temp_directory_path() /
+              ("SimpleCppLoggerLogIndexTest_" + std::string(test_info->name()) + ".log"))
+                 .string();
+    m_index_path = get_index_path(m_path);
+    std::filesystem::remove(m_path);
+    std::filesystem::remove(m_index_path);
+}
+
+/**
+ * @brief Removes the files of the test.
+ */
+void LogIndexTest::TearDown()
+{
+    std::filesystem::remove(m_path);
+    std::filesystem::remove(m_index_path);
+}
+
+/**
+ * @brief Tests that the Bloom filter reports added tokens and rejects absent ones.
+ */
+TEST_F(LogIndexTest, BloomFilterTokens)
+{
+    LogIndexBlock block;
+    block.bloom.resize(128);
+    block.add_tokens("[Info]: user=alice action=login\n");
+
+    EXPECT_TRUE(block.may_contain_tokens("alice"));
+    EXPECT_TRUE(block.may_contain_tokens("action login"));
+    EXPECT_TRUE(block.may_contain_tokens(""));
+    EXPECT_FALSE(block.may_contain_tokens("bob"));
+    EXPECT_FALSE(block.may_contain_tokens("alice logout"));
+}
+
+/**
+ * @brief Tests that entries survive a round trip and that a mismatching index is started over.
+ */
+TEST_F(LogIndexTest, WriterReaderRoundTrip)
+{
+    {
+        LogIndexWriter writer(m_index_path, true, 64, "zlib");
+        ASSERT_TRUE(writer.is_open());
+        EXPECT_EQ(writer.get_bloom_words(), 8u);
+
+        LogIndexBlock block;
+        block.file_offset = 100;
+        block.stored_size = 20;
+        block.text_size = 300;
+        block.first_timestamp = -5;
+        block.last_timestamp = 7;
+        block.record_count = 3;
+        block.level_mask = 0b10100;
+        block.bloom.resize(writer.get_bloom_words());
+        block.add_tokens("hello");
+        EXPECT_TRUE(writer.write(block));
+
+        block.bloom.resize(1);
+        EXPECT_FALSE(writer.write(block));
+    }
+    {
+        LogIndexWriter writer(m_index_path, true, 64, "zlib");
+        LogIndexBlock block;
+        block.file_offset = 120;
+        block.bloom.resize(writer.get_bloom_words());
+        EXPECT_TRUE(writer.write(block));
+    }
+
+    LogIndexReader reader(m_index_path);
+    ASSERT_TRUE(reader.is_open());
+    EXPECT_EQ(reader.get_codec_name(), "zlib");
+    ASSERT_EQ(reader.get_blocks().size(), 2u);
+
+    const LogIndexBlock& block = reader.get_blocks()[0];
+    EXPECT_EQ(block.file_offset, 100u);
+    EXPECT_EQ(block.stored_size, 20u);
+    EXPECT_EQ(block.text_size, 300u);
+    EXPECT_EQ(block.first_timestamp, -5);
+    EXPECT_EQ(block.last_timestamp, 7);
+    EXPECT_EQ(block.record_count, 3u);
+    EXPECT_TRUE(block.has_level_at_least(LogLevel::Error));
+    EXPECT_FALSE(block.has_level_at_least(LogLevel::Fatal));
+    EXPECT_TRUE(block.may_contain_tokens("hello"));
+    EXPECT_EQ(reader.get_blocks()[1].file_offset, 120u);
+
+    {
+        LogIndexWriter writer(m_index_path, true, 64, "");
+    }
+    LogIndexReader restarted(m_index_path);
+    ASSERT_TRUE(restarted.is_open());
+    EXPECT_EQ(restarted.get_codec_name(), "");
+    EXPECT_TRUE(restarted.get_blocks().empty());
+}
+
+/**
+ * @brief Tests that appending to an index whose last entry was torn by a crash cuts the partial
+ * entry off, so the new entries stay aligned.
+ */
+TEST_F(LogIndexTest, AppendAfterTornEntry)
+{
+    {
+        LogIndexWriter writer(m_index_path, true, 64, "");
+        LogIndexBlock block;
+        block.file_offset = 100;
+        block.bloom.resize(writer.get_bloom_words());
+        ASSERT_TRUE(writer.write(block));
+        block.file_offset = 200;
+        ASSERT_TRUE(writer.write(block));
+    }
+
+    const auto size = std::filesystem::file_size(m_index_path);
+    std::filesystem::resize_file(m_index_path, size - 10);
+    {
+        LogIndexWriter writer(m_index_path, true, 64, "");
+        LogIndexBlock block;
+        block.file_offset = 300;
+        block.bloom.resize(writer.get_bloom_words());
+        ASSERT_TRUE(writer.write(block));
+    }
+
+    LogIndexReader reader(m_index_path);
+    ASSERT_TRUE(reader.is_open());
+    ASSERT_EQ(reader.get_blocks().size(), 2u);
+    EXPECT_EQ(reader.get_blocks()[0].file_offset, 100u);
+    EXPECT_EQ(reader.get_blocks()[1].file_offset, 300u);
+    EXPECT_EQ(std::filesystem::file_size(m_index_path), size);
+}
+
+/**
+ * @brief Tests that a FileAppender indexes every frame and that queries skip the frames that
+ * cannot match.
+ */
+TEST_F(LogIndexTest, FileAppenderQueries)
+{
+    LogMessage::Clock::time_point middle;
+
+    {
+        FileAppenderOptions options;
+        options.write_index = true;
+        options.index_block_records = 250;
+        options.flush_level = LogLevel::Fatal;
+        options.flush_interval = std::chrono::hours(1);
+
+        FileAppender appender(m_path, options, nullptr);
+        ASSERT_TRUE(appender.is_index_open());
+
+        write_records(appender, 0, 2000);
+        while (appender.get_frame_count() < 8)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        middle = LogMessage::Clock::now();
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+
+        write_records(appender, 2000, 3000);
+    }
+
+    LogIndexReader reader(m_index_path);
+    ASSERT_TRUE(reader.is_open());
+    ASSERT_EQ(reader.get_blocks().size(), 12u);
+    EXPECT_EQ(reader.get_blocks().back().file_offset + reader.get_blocks().back().stored_size,
+              std::filesystem::file_size(m_path));
+
+    LogIndexQuery errors;
+    errors.min_level = LogLevel::Error;
+    EXPECT_EQ(reader.find(errors).size(), 3u);
+
+    LogIndexQuery later;
+    later.from = middle;
+    EXPECT_EQ(reader.find(later).size(), 4u);
+
+    LogIndexQuery token;
+    token.tokens = "id1234";
+    const auto blocks = reader.find(token);
+    ASSERT_EQ(blocks.size(), 1u);
+
+    std::FILE* log_file = std::fopen(m_path.c_str(), "rb");
+    ASSERT_NE(log_file, nullptr);
+    std::string text;
+    EXPECT_TRUE(LogIndexReader::read_block(log_file, blocks[0], nullptr, text));
+    std::fclose(log_file);
+
+    EXPECT_NE(text.find("request id1234\n"), std::string::npos);
+    EXPECT_EQ(text.size(), blocks[0].text_size);
+}
+
+/**
+ * @brief Tests that the frames of a compressed file can be located and decompressed on their
+ * own.
+ */
+TEST_F(LogIndexTest, CompressedFramesAreSeekable)
+{
+    if (!CompressionCodec::is_available(CompressionType::Zlib))
+    {
+        GTEST_SKIP() << "built without zlib";
+    }
+
+    {
+        FileAppenderOptions options;
+        options.write_index = true;
+        options.index_block_records = 500;
+        options.codec = CompressionCodec::create(CompressionType::Zlib);
+
+        FileAppender appender(m_path, options, nullptr);
+        write_records(appender, 0, 3000);
+    }
+
+    LogIndexReader reader(m_index_path);
+    ASSERT_TRUE(reader.is_open());
+    EXPECT_EQ(reader.get_codec_name(), "zlib");
+
+    LogIndexQuery query;
+    query.min_level = LogLevel::Error;
+    query.tokens = "disk failure";
+    const auto blocks = reader.find(query);
+    ASSERT_FALSE(blocks.empty());
+    EXPECT_LT(blocks.size(), reader.get_blocks().size());
+
+    auto codec = CompressionCodec::create(reader.get_codec_name());
+    ASSERT_NE(codec, nullptr);
+
+    std::FILE* log_file = std::fopen(m_path.c_str(), "rb");
+    ASSERT_NE(log_file, nullptr);
+    std::string text;
+    EXPECT_TRUE(LogIndexReader::read_block(log_file, blocks.back(), codec.get(), text));
+    std::fclose(log_file);
+
+    EXPECT_NE(text.find("disk failure code"), std::string::npos);
+}
@@ -1,6 +1,9 @@
 #include "SimpleCppLogger/LogMacrosTest.h"
 
+#include <string>
+
 #include "SimpleCppLogger/Logger.h"
+#include "SimpleCppLogger/LoggerContext.h"
 
 using namespace SimpleCppLogger;
 
@@ -197,3 +200,131 @@ TEST_F(LogMacrosTest, MacroLogVeryLongMessage)
 
     LOG_INFO << long_message;
 }
+
+/**
+ * @brief Tests that category macros log with the category, level and message.
+ */
+TEST_F(LogMacrosTest, CategoryMacroLogsWithCategory)
+{
+    auto category = Logger::get_instance().get_category("LogMacrosTest.Category");
+
+    EXPECT_CALL(*m_mock_appender, internal_append(::testing::_, ::testing::_))
+        .WillOnce([](const LogMessage& log_message, const std::source_location& location) {
+            EXPECT_EQ(log_message.get_level(), LogLevel::Warning);
+            EXPECT_EQ(log_message.get_category(), "LogMacrosTest.Category");
+            EXPECT_EQ(log_message.get_message(), "Value: 7");
+            EXPECT_STREQ(location.file_name(), __FILE__);
+        });
+
+    LOG_CAT_WARNING(category) << "Value: " << 7;
+}
+
+/**
+ * @brief Tests that disabled category macros do not evaluate the streamed expressions.
+ */
+TEST_F(LogMacrosTest, DisabledCategoryMacroSkipsEvaluation)
+{
+    auto& logger = Logger::get_instance();
+    auto category = logger.get_category("LogMacrosTest.Disabled");
+    logger.set_category_level(category, LogLevel::Error);
+
+    int evaluations = 0;
+    auto expensive = [&evaluations]() {
+        ++evaluations;
+        return 42;
+    };
+
+    EXPECT_CALL(*m_mock_appender, internal_append(::testing::_, ::testing::_)).Times(1);
+
+    LOG_CAT_DEBUG(category) << expensive();
+    LOG_CAT_ERROR(category) << expensive();
+
+    EXPECT_EQ(evaluations, 1);
+    logger.reset_category_level(category);
+}
+
+/**
+ * @brief Tests that category macros compose with if/else without a dangling else.
+ */
+TEST_F(LogMacrosTest, CategoryMacroInIfElse)
+{
+    auto category = Logger::get_instance().get_category("LogMacrosTest.IfElse");
+    bool else_taken = false;
+
+    EXPECT_CALL(*m_mock_appender, internal_append(::testing::_, ::testing::_)).Times(0);
+
+    if (else_taken)
+        LOG_CAT_INFO(category) << "Not logged";
+    else
+        else_taken = true;
+
+    EXPECT_TRUE(else_taken);
+}
+
+/**
+ * @brief Tests that LOG_INFOF formats its arguments into the message.
+ */
+TEST_F(LogMacrosTest, FormatMacroFormatsArguments)
+{
+    EXPECT_CALL(*m_mock_appender, internal_append(::testing::_, ::testing::_))
+        .WillOnce([](const LogMessage& log_message, const std::source_location& location) {
+            EXPECT_EQ(log_message.get_level(), LogLevel::Info);
+            EXPECT_EQ(log_message.get_message(), "x=7 y=1.250");
+            EXPECT_STREQ(location.file_name(), __FILE__);
+        });
+
+    LOG_INFOF("x={} y={:.3f}", 7, 1.25);
+}
+
+/**
+ * @brief Tests that the arguments of a disabled format macro are not evaluated.
+ */
+TEST_F(LogMacrosTest, DisabledFormatMacroSkipsEvaluation)
+{
+    Logger::get_instance().set_log_level(LogLevel::Error);
+    int evaluations = 0;
+    auto count = [&evaluations] { return ++evaluations; };
+
+    EXPECT_CALL(*m_mock_appender, internal_append(::testing::_, ::testing::_)).Times(0);
+    LOG_DEBUGF("{}", count());
+
+    EXPECT_EQ(evaluations, 0);
+}
+
+/**
+ * @brief Tests that category format macros log with the category and respect its threshold.
+ */
+TEST_F(LogMacrosTest, CategoryFormatMacroLogsWithCategory)
+{
+    auto& logger = Logger::get_instance();
+    auto category = logger.get_category("LogMacrosTest.Format");
+    logger.set_category_level(category, LogLevel::Warning);
+
+    EXPECT_CALL(*m_mock_appender, internal_append(::testing::_, ::testing::_))
+        .WillOnce([](const LogMessage& log_message, const std::source_location& /*location*/) {
+            EXPECT_EQ(log_message.get_level(), LogLevel::Warning);
+            EXPECT_EQ(log_message.get_category(), "LogMacrosTest.Format");
+            EXPECT_EQ(log_message.get_message(), "disk 93% full");
+        });
+
+    LOG_CAT_INFOF(category, "disk {}% full", 50);
+    LOG_CAT_WARNINGF(category, "disk {}% full", 93);
+    logger.reset_category_level(category);
+}
+
+/**
+ * @brief Tests that LOG_CTX_*F macros log into the given context.
+ */
+TEST_F(LogMacrosTest, ContextFormatMacroLogsIntoContext)
+{
+    LoggerContext context;
+    context.add_appender(m_mock_appender);
+
+    EXPECT_CALL(*m_mock_appender, internal_append(::testing::_, ::testing::_))
+        .WillOnce([](const LogMessage& log_message, const std::source_location& /*location*/) {
+            EXPECT_EQ(log_message.get_level(), LogLevel::Error);
+            EXPECT_EQ(log_message.get_message(), "request 12 failed: timeout");
+        });
+
+    LOG_CTX_ERRORF(context, "request {} failed: {}", 12, std::string("timeout"));
+}
@@ -1,5 +1,7 @@
 ﻿#include "SimpleCppLogger/LogMessageTest.h"
 
+#include <chrono>
+
 #include "SimpleCppLogger/LogLevel.h"
 #include "SimpleCppLogger/LogMessage.h"
 
@@ -125,3 +127,37 @@ TEST_F(LogMessageTest, AllLogLevels)
         EXPECT_EQ(msg.get_level(), level);
     }
 }
+
+/**
+ * @brief Tests that the creation timestamp is captured and preserved by copies.
+ */
+TEST_F(LogMessageTest, TimestampIsCaptured)
+{
+    const auto before = LogMessage::Clock::now();
+    LogMessage msg(LogLevel::Info, "Timed");
+    const auto after = LogMessage::Clock::now();
+
+    EXPECT_GE(msg.get_timestamp(), before);
+    EXPECT_LE(msg.get_timestamp(), after);
+
+    LogMessage copy = msg;
+    EXPECT_EQ(copy.get_timestamp(), msg.get_timestamp());
+}
+
+/**
+ * @brief Tests that an explicit source context is stored as structured data.
+ */
+TEST_F(LogMessageTest, ExplicitSourceContext)
+{
+    LogMessage plain(LogLevel::Info, "Plain");
+    EXPECT_FALSE(plain.has_source_context());
+    EXPECT_EQ(plain.get_line(), 0u);
+
+    LogMessage msg(LogLevel::Warning, "Bridged", "Script", "script.py", 12, "handler");
+    EXPECT_TRUE(msg.has_source_context());
+    EXPECT_EQ(msg.get_message(), "Bridged");
+    EXPECT_EQ(msg.get_category(), "Script");
+    EXPECT_EQ(msg.get_file(), "script.py");
+    EXPECT_EQ(msg.get_line(), 12u);
+    EXPECT_EQ(msg.get_function(), "handler");
+}
@@ -0,0 +1,508 @@
+#include "SimpleCppLogger/LoggerContextTest.h"
+
+#include <chrono>
+#include <future>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "SimpleCppLogger/AsyncAppender.h"
+#include "SimpleCppLogger/LogMacros.h"
+#include "SimpleCppLogger/Logger.h"
+
+using namespace SimpleCppLogger;
+
+/**
+ * @brief Sets up a fresh context and mock appenders for the context and the global Logger.
+ */
+void LoggerContextTest::SetUp()
+{
+    m_context = std::make_unique<LoggerContext>();
+    m_context_appender = std::make_shared<MockLogAppenderContext>();
+    m_global_appender = std::make_shared<MockLogAppenderContext>();
+
+    m_context->add_appender(m_context_appender);
+    m_context->set_log_level(LogLevel::Debug);
+
+    Logger::get_instance().clear_appenders();
+    Logger::get_instance().add_appender(m_global_appender);
+    Logger::get_instance().set_log_level(LogLevel::Debug);
+}
+
+/**
+ * @brief Tears down the fixture by destroying the context and clearing the global appenders.
+ */
+void LoggerContextTest::TearDown()
+{
+    m_context.reset();
+    Logger::get_instance().clear_appenders();
+    m_context_appender.reset();
+    m_global_appender.reset();
+}
+
+/**
+ * @brief Tests that the global Logger is a LoggerContext.
+ */
+TEST_F(LoggerContextTest, LoggerIsAContext)
+{
+    EXPECT_TRUE((std::is_base_of_v<LoggerContext, Logger>));
+    LoggerContext& context = Logger::get_instance();
+    EXPECT_EQ(&context, static_cast<LoggerContext*>(&Logger::get_instance()));
+}
+
+/**
+ * @brief Tests that a new context starts without appenders.
+ */
+TEST_F(LoggerContextTest, NewContextHasNoAppenders)
+{
+    LoggerContext empty;
+    EXPECT_EQ(empty.get_log_level(), LogLevel::Debug);
+    EXPECT_CALL(*m_global_appender, internal_append(::testing::_, ::testing::_)).Times(0);
+
+    empty.log(LogLevel::Error, "Nobody listens");
+}
+
+/**
+ * @brief Tests that messages of a context only reach its own appenders.
+ */
+TEST_F(LoggerContextTest, ContextsAreIsolated)
+{
+    EXPECT_CALL(*m_context_appender, internal_append(::testing::_, ::testing::_))
+        .WillOnce([](const LogMessage& msg, const std::source_location&) {
+            EXPECT_EQ(msg.get_message(), "Context message");
+        });
+    EXPECT_CALL(*m_global_appender, internal_append(::testing::_, ::testing::_))
+        .WillOnce([](const LogMessage& msg, const std::source_location&) {
+            EXPECT_EQ(msg.get_message(), "Global message");
+        });
+
+    m_context->log(LogLevel::Info, "Context message");
+    Logger::get_instance().log(LogLevel::Info, "Global message");
+}
+
+/**
+ * @brief Tests that levels are independent between contexts.
+ */
+TEST_F(LoggerContextTest, LevelsAreIndependent)
+{
+    m_context->set_log_level(LogLevel::Error);
+
+    EXPECT_EQ(m_context->get_log_level(), LogLevel::Error);
+    EXPECT_EQ(Logger::get_instance().get_log_level(), LogLevel::Debug);
+
+    EXPECT_CALL(*m_context_appender, internal_append(::testing::_, ::testing::_)).Times(0);
+    EXPECT_CALL(*m_global_appender, internal_append(::testing::_, ::testing::_)).Times(1);
+
+    m_context->log(LogLevel::Info, "Filtered in context");
+    Logger::get_instance().log(LogLevel::Info, "Delivered globally");
+}
+
+/**
+ * @brief Tests that categories and their thresholds are per context.
+ */
+TEST_F(LoggerContextTest, CategoriesArePerContext)
+{
+    auto local = m_context->get_category("LoggerContextTest.Shared");
+    auto global = Logger::get_instance().get_category("LoggerContextTest.Shared");
+
+    m_context->set_category_level(local, LogLevel::Fatal);
+
+    EXPECT_EQ(m_context->get_category_level(local), LogLevel::Fatal);
+    EXPECT_EQ(Logger::get_instance().get_category_level(global), LogLevel::Debug);
+}
+
+/**
+ * @brief Tests that the context macros send messages to the given context.
+ */
+TEST_F(LoggerContextTest, ContextMacrosTargetContext)
+{
+    auto category = m_context->get_category("LoggerContextTest.Macro");
+
+    EXPECT_CALL(*m_global_appender, internal_append(::testing::_, ::testing::_)).Times(0);
+    EXPECT_CALL(*m_context_appender, internal_append(::testing::_, ::testing::_))
+        .WillOnce([](const LogMessage& msg, const std::source_location& location) {
+            EXPECT_EQ(msg.get_level(), LogLevel::Warning);
+            EXPECT_EQ(msg.get_message(), "Value 3");
+            EXPECT_TRUE(msg.get_category().empty());
+            EXPECT_STREQ(location.file_name(), __FILE__);
+        })
+        .WillOnce([](const LogMessage& msg, const std::source_location&) {
+            EXPECT_EQ(msg.get_level(), LogLevel::Error);
+            EXPECT_EQ(msg.get_category(), "LoggerContextTest.Macro");
+        });
+
+    LOG_CTX_WARNING(*m_context) << "Value " << 3;
+    LOG_CTX_CAT_ERROR(*m_context, category) << "Categorized";
+}
+
+/**
+ * @brief Tests that disabled context category macros skip the message.
+ */
+TEST_F(LoggerContextTest, DisabledContextCategoryMacroIsSkipped)
+{
+    auto category = m_context->get_category("LoggerContextTest.Quiet");
+    m_context->set_category_level(category, LogLevel::Error);
+
+    EXPECT_CALL(*m_context_appender, internal_append(::testing::_, ::testing::_)).Times(0);
+
+    LOG_CTX_CAT_INFO(*m_context, category) << "Skipped";
+}
+
+/**
+ * @brief Tests that two contexts can be used concurrently from different threads.
+ */
+TEST_F(LoggerContextTest, ConcurrentContexts)
+{
+    constexpr int messages_per_thread = 200;
+    LoggerContext second;
+    auto second_appender = std::make_shared<MockLogAppenderContext>();
+    second.add_appender(second_appender);
+
+    EXPECT_CALL(*m_context_appender, internal_append(::testing::_, ::testing::_))
+        .Times(messages_per_thread);
+    EXPECT_CALL(*second_appender, internal_append(::testing::_, ::testing::_))
+        .Times(messages_per_thread);
+
+    std::vector<std::thread> threads;
+    threads.emplace_back([this]() {
+        for (int i = 0; i < messages_per_thread; ++i)
+        {
+            m_context->log(LogLevel::Info, "First");
+        }
+    });
+    threads.emplace_back([&second]() {
+        for (int i = 0; i < messages_per_thread; ++i)
+        {
+            second.log(LogLevel::Info, "Second");
+        }
+    });
+
+    for (auto& thread: threads)
+    {
+        thread.join();
+    }
+}
+
+/**
+ * @brief Tests that messages logged while the backend runs reach the appenders in order.
+ */
+TEST_F(LoggerContextTest, BackendDeliversStagedMessages)
+{
+    std::vector<std::string> received;
+    EXPECT_CALL(*m_context_appender, internal_append(::testing::_, ::testing::_))
+        .Times(3)
+        .WillRepeatedly([&received](const LogMessage& message, const std::source_location&) {
+            received.push_back(message.get_message());
+        });
+
+    m_context->start_backend();
+    EXPECT_TRUE(m_context->is_backend_running());
+
+    m_context->log(LogLevel::Info, "one");
+    m_context->log(LogLevel::Warning, "two");
+    m_context->log(m_context->get_category("Net"), LogLevel::Error, "three");
+
+    m_context->stop_backend();
+    EXPECT_FALSE(m_context->is_backend_running());
+    EXPECT_EQ(received, (std::vector<std::string>{"one", "two", "three"}));
+}
+
+/**
+ * @brief Tests that flush() delivers staged messages without waiting for the backend thread.
+ */
+TEST_F(LoggerContextTest, FlushDeliversStagedMessages)
+{
+    std::vector<std::string> received;
+    EXPECT_CALL(*m_context_appender, internal_append(::testing::_, ::testing::_))
+        .Times(2)
+        .WillRepeatedly([&received](const LogMessage& message, const std::source_location&) {
+            received.push_back(message.get_message());
+        });
+
+    BackendOptions options;
+    options.poll_interval = std::chrono::minutes(1);
+    m_context->start_backend(options);
+
+    m_context->log(LogLevel::Info, "one");
+    m_context->log(LogLevel::Info, "two");
+    EXPECT_TRUE(m_context->flush().get());
+    EXPECT_EQ(received, (std::vector<std::string>{"one", "two"}));
+
+    m_context->stop_backend();
+}
+
+/**
+ * @brief Tests that the flush callback is called once even without appenders.
+ */
+TEST_F(LoggerContextTest, FlushWithoutAppendersCallsBack)
+{
+    LoggerContext empty;
+    int calls = 0;
+    empty.flush([&calls](bool success) {
+        EXPECT_TRUE(success);
+        ++calls;
+    });
+    EXPECT_EQ(calls, 1);
+}
+
+/**
+ * @brief Tests that messages are delivered directly again after the backend is stopped.
+ */
+TEST_F(LoggerContextTest, StoppedBackendDeliversDirectly)
+{
+    m_context->start_backend();
+    m_context->stop_backend();
+
+    EXPECT_CALL(*m_context_appender, internal_append(::testing::_, ::testing::_)).Times(1);
+    m_context->log(LogLevel::Info, "direct");
+    ::testing::Mock::VerifyAndClearExpectations(m_context_appender.get());
+}
+
+/**
+ * @brief Tests that formatting workers keep the order of messages from one thread.
+ */
+TEST_F(LoggerContextTest, FormattingWorkersPreserveOrder)
+{
+    std::vector<std::string> received;
+    EXPECT_CALL(*m_context_appender, internal_append(::testing::_, ::testing::_))
+        .Times(1000)
+        .WillRepeatedly([&received](const LogMessage& message, const std::source_location&) {
+            received.push_back(message.get_message());
+        });
+
+    BackendOptions options;
+    options.formatting_threads = 3;
+    options.records_per_task = 16;
+    m_context->start_backend(options);
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        m_context->log(LogLevel::Info, std::to_string(i));
+    }
+
+    m_context->stop_backend();
+
+    ASSERT_EQ(received.size(), 1000u);
+    for (int i = 0; i < 1000; ++i)
+    {
+        EXPECT_EQ(received[i], std::to_string(i));
+    }
+}
+
+/**
+ * @brief Tests that an explicit source context survives staging in the backend.
+ */
+TEST_F(LoggerContextTest, BackendKeepsExplicitSourceContext)
+{
+    EXPECT_CALL(*m_context_appender, internal_append(::testing::_, ::testing::_))
+        .WillOnce([](const LogMessage& message, const std::source_location&) {
+            EXPECT_EQ(message.get_file(), "bridge.lua");
+            EXPECT_EQ(message.get_line(), 9u);
+            EXPECT_EQ(message.get_function(), "tick");
+            EXPECT_EQ(message.get_category(), "Bridge");
+        });
+
+    m_context->start_backend();
+    {
+        std::string file = "bridge.lua";
+        std::string function = "tick";
+        m_context->log(LogLevel::Info, "Scripted", file.c_str(), 9, function.c_str(), "Bridge");
+        file.assign(file.size(), 'x');
+        function.assign(function.size(), 'x');
+    }
+    m_context->stop_backend();
+}
+
+/**
+ * @brief Tests that an explicit source context survives an appender queue on the synchronous
+ * path, after the caller's buffers are gone.
+ */
+TEST_F(LoggerContextTest, QueuedMessageKeepsExplicitSourceContext)
+{
+    std::promise<void> release;
+    const std::shared_future<void> released = release.get_future().share();
+    auto sink = std::make_shared<MockLogAppenderContext>();
+    ::testing::InSequence sequence;
+
+    EXPECT_CALL(*sink, internal_append(::testing::_, ::testing::_))
+        .WillOnce([released](const LogMessage&, const std::source_location&) { released.wait(); });
+    EXPECT_CALL(*sink, internal_append(::testing::_, ::testing::_))
+        .WillOnce([](const LogMessage& message, const std::source_location&) {
+            EXPECT_EQ(message.get_file(), "bridge.lua");
+            EXPECT_EQ(message.get_function(), "tick");
+        });
+
+    m_context->clear_appenders();
+    m_context->add_appender(std::make_shared<AsyncAppender>(sink));
+    m_context->log(LogLevel::Info, "Blocker");
+    {
+        std::string file = "bridge.lua";
+        std::string function = "tick";
+        m_context->log(LogLevel::Info, "Scripted", file.c_str(), 9, function.c_str(), "");
+        file.assign(file.size(), 'x');
+        function.assign(function.size(), 'x');
+    }
+
+    release.set_value();
+    m_context->flush().wait();
+}
+
+/**
+ * @brief Tests that destroying a context lets an owned AsyncAppender deliver its queue while the
+ * category names are still alive.
+ */
+TEST_F(LoggerContextTest, DestructionDrainsQueuedAppender)
+{
+    std::promise<void> release;
+    const std::shared_future<void> released = release.get_future().share();
+    auto sink = std::make_shared<MockLogAppenderContext>();
+    ::testing::InSequence sequence;
+
+    EXPECT_CALL(*sink, internal_append(::testing::_, ::testing::_))
+        .WillOnce([released](const LogMessage&, const std::source_location&) { released.wait(); });
+    EXPECT_CALL(*sink, internal_append(::testing::_, ::testing::_))
+        .WillOnce([](const LogMessage& message, const std::source_location&) {
+            EXPECT_EQ(message.get_category(), "Bridge");
+            EXPECT_EQ(message.get_file(), "bridge.lua");
+            EXPECT_EQ(message.get_function(), "tick");
+        });
+
+    m_context->clear_appenders();
+    m_context->add_appender(std::make_shared<AsyncAppender>(sink));
+    m_context->log(LogLevel::Info, "Blocker");
+    m_context->log(LogLevel::Info, "Scripted", "bridge.lua", 9, "tick", "Bridge");
+
+    std::thread releaser([&release] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        release.set_value();
+    });
+    m_context.reset();
+    releaser.join();
+}
+
+/**
+ * @brief Tests that a string_view is copied exactly, without relying on null termination.
+ */
+TEST_F(LoggerContextTest, StringViewOverloadCopiesView)
+{
+    EXPECT_CALL(*m_context_appender, internal_append(::testing::_, ::testing::_))
+        .WillOnce([](const LogMessage& message, const std::source_location&) {
+            EXPECT_EQ(message.get_message(), "middle");
+        });
+
+    const std::string_view text = "left middle right";
+    m_context->log(LogLevel::Info, text.substr(5, 6));
+}
+
+/**
+ * @brief Tests that an rvalue string reaches the appenders without being copied.
+ */
+TEST_F(LoggerContextTest, RvalueOverloadMovesText)
+{
+    std::string text(256, 'm');
+    const char* buffer = text.data();
+
+    EXPECT_CALL(*m_context_appender, internal_append(::testing::_, ::testing::_))
+        .WillOnce([buffer](const LogMessage& message, const std::source_location&) {
+            EXPECT_EQ(message.get_message().data(), buffer);
+        });
+
+    m_context->log(LogLevel::Info, std::move(text));
+}
+
+/**
+ * @brief Tests that the text built by a LogStream is moved into the message.
+ */
+TEST_F(LoggerContextTest, LogStreamMovesBufferIntoMessage)
+{
+    EXPECT_CALL(*m_context_appender, internal_append(::testing::_, ::testing::_))
+        .WillOnce([](const LogMessage& message, const std::source_location&) {
+            EXPECT_EQ(message.get_message(), "value=" + std::to_string(42));
+        });
+
+    LOG_CTX_INFO(*m_context) << "value=" << 42;
+}
+
+/**
+ * @brief Tests that messages below the level are buffered and delivered ahead of an error.
+ */
+TEST_F(LoggerContextTest, BacktraceIsDumpedBeforeError)
+{
+    m_context->set_log_level(LogLevel::Info);
+    m_context->enable_backtrace(2, LogLevel::Debug);
+
+    EXPECT_TRUE(m_context->is_backtrace_enabled());
+    EXPECT_TRUE(m_context->is_enabled(LogLevel::Debug));
+    EXPECT_FALSE(m_context->is_enabled(LogLevel::Trace));
+    EXPECT_EQ(m_context_appender->get_log_level(), LogLevel::Debug);
+
+    std::vector<std::string> received;
+    EXPECT_CALL(*m_context_appender, internal_append(::testing::_, ::testing::_))
+        .Times(4)
+        .WillRepeatedly([&received](const LogMessage& message, const std::source_location&) {
+            received.push_back(message.get_message());
+        });
+
+    m_context->log(LogLevel::Debug, "dropped by the ring");
+    m_context->log(LogLevel::Trace, "below the backtrace level");
+    m_context->log(LogLevel::Debug, "first");
+    LOG_CTX_DEBUG(*m_context) << "second";
+    m_context->log(LogLevel::Info, "info");
+    m_context->log(LogLevel::Error, "failure");
+
+    EXPECT_EQ(received, (std::vector<std::string>{"info", "first", "second", "failure"}));
+}
+
+/**
+ * @brief Tests that the buffer is emptied by a dump and discarded when backtrace is disabled.
+ */
+TEST_F(LoggerContextTest, BacktraceDumpAndDisable)
+{
+    m_context->set_log_level(LogLevel::Warning);
+    m_context->enable_backtrace(8);
+
+    std::vector<std::string> received;
+    EXPECT_CALL(*m_context_appender, internal_append(::testing::_, ::testing::_))
+        .Times(3)
+        .WillRepeatedly([&received](const LogMessage& message, const std::source_location&) {
+            received.push_back(message.get_message());
+        });
+
+    m_context->log(LogLevel::Trace, "kept");
+    m_context->dump_backtrace();
+    m_context->log(LogLevel::Fatal, "fatal");
+
+    m_context->log(LogLevel::Info, "discarded");
+    m_context->disable_backtrace();
+    EXPECT_FALSE(m_context->is_backtrace_enabled());
+    EXPECT_EQ(m_context_appender->get_log_level(), LogLevel::Warning);
+    m_context->log(LogLevel::Error, "error");
+
+    EXPECT_EQ(received, (std::vector<std::string>{"kept", "fatal", "error"}));
+}
+
+/**
+ * @brief Tests that buffered messages are staged ahead of the error while a backend runs.
+ */
+TEST_F(LoggerContextTest, BacktraceWithBackend)
+{
+    m_context->set_log_level(LogLevel::Info);
+    m_context->enable_backtrace(4);
+
+    std::vector<std::string> received;
+    EXPECT_CALL(*m_context_appender, internal_append(::testing::_, ::testing::_))
+        .Times(3)
+        .WillRepeatedly([&received](const LogMessage& message, const std::source_location&) {
+            received.push_back(message.get_message());
+        });
+
+    m_context->start_backend();
+    m_context->log(LogLevel::Debug, "context", "job.cpp", 5, "run");
+    m_context->log(LogLevel::Trace, "detail");
+    m_context->log(LogLevel::Error, "failure");
+    m_context->stop_backend();
+
+    EXPECT_EQ(received, (std::vector<std::string>{"context", "detail", "failure"}));
+}
@@ -255,9 +255,10 @@ TEST_F(LoggerTest, SourceLocationFromDifferentFunction)
 }
 
 /**
- * @brief Tests the explicit-context overload composes message and does not stamp caller location.
+ * @brief Tests that the explicit-context overload passes file, line, function and category as
+ * structured data and suppresses the caller's source location.
  */
-TEST_F(LoggerTest, LogWithExplicitContext_ComposesAndSuppressesSourceLocation)
+TEST_F(LoggerTest, LogWithExplicitContext_KeepsContextStructured)
 {
     const char* file = "C:/path/to/file.cpp";
     const int line = 42;
@@ -265,13 +266,15 @@ TEST_F(LoggerTest, LogWithExplicitContext_ComposesAndSuppressesSourceLocation)
     const char* category = "NET";
     const std::string base_message = "Base";
 
-    const std::string expected = std::string("Base - ") + "[" + category + "] " + file + ":" +
-                                 std::to_string(line) + ", " + function;
-
     EXPECT_CALL(*m_mock_appender, internal_append(::testing::_, ::testing::_))
         .WillOnce([&](const LogMessage& msg, const std::source_location& loc) {
             EXPECT_EQ(msg.get_level(), LogLevel::Info);
-            EXPECT_EQ(msg.get_message(), expected);
+            EXPECT_EQ(msg.get_message(), base_message);
+            EXPECT_EQ(msg.get_category(), category);
+            EXPECT_EQ(msg.get_file(), file);
+            EXPECT_EQ(msg.get_line(), 42u);
+            EXPECT_EQ(msg.get_function(), function);
+            EXPECT_TRUE(msg.has_source_context());
 
             // Forwarded location should be default-constructed (no caller information).
             EXPECT_EQ(loc.line(), 0u);
@@ -287,11 +290,11 @@ TEST_F(LoggerTest, LogWithExplicitContext_ComposesAndSuppressesSourceLocation)
  */
 TEST_F(LoggerTest, LogWithExplicitContext_CategoryOnly)
 {
-    const std::string expected = "Msg - [Subsystem] ";
-
     EXPECT_CALL(*m_mock_appender, internal_append(::testing::_, ::testing::_))
         .WillOnce([&](const LogMessage& msg, const std::source_location& loc) {
-            EXPECT_EQ(msg.get_message(), expected);
+            EXPECT_EQ(msg.get_message(), "Msg");
+            EXPECT_EQ(msg.get_category(), "Subsystem");
+            EXPECT_FALSE(msg.has_source_context());
             EXPECT_EQ(loc.line(), 0u);
         });
 
@@ -303,17 +306,34 @@ TEST_F(LoggerTest, LogWithExplicitContext_CategoryOnly)
  */
 TEST_F(LoggerTest, LogWithExplicitContext_FunctionOnly)
 {
-    const std::string expected = "Msg - myFunc";
-
     EXPECT_CALL(*m_mock_appender, internal_append(::testing::_, ::testing::_))
         .WillOnce([&](const LogMessage& msg, const std::source_location& loc) {
-            EXPECT_EQ(msg.get_message(), expected);
+            EXPECT_EQ(msg.get_message(), "Msg");
+            EXPECT_TRUE(msg.get_category().empty());
+            EXPECT_EQ(msg.get_function(), "myFunc");
+            EXPECT_TRUE(msg.get_file().empty());
             EXPECT_EQ(loc.line(), 0u);
         });
 
     Logger::get_instance().log(LogLevel::Info, "Msg", nullptr, 0, "myFunc", nullptr);
 }
 
+/**
+ * @brief Tests that the explicit-context category is registered and its threshold applies.
+ */
+TEST_F(LoggerTest, LogWithExplicitContext_CategoryThresholdApplies)
+{
+    auto category = Logger::get_instance().get_category("LoggerTest.Bridge");
+    Logger::get_instance().set_category_level(category, LogLevel::Error);
+
+    EXPECT_CALL(*m_mock_appender, internal_append(::testing::_, ::testing::_)).Times(1);
+
+    Logger::get_instance().log(LogLevel::Info, "Filtered", "f.py", 3, "fn", "LoggerTest.Bridge");
+    Logger::get_instance().log(LogLevel::Error, "Passes", "f.py", 4, "fn", "LoggerTest.Bridge");
+
+    Logger::get_instance().reset_category_level(category);
+}
+
 /**
  * @brief Tests that invalid level with explicit context is ignored.
  */
@@ -323,3 +343,64 @@ TEST_F(LoggerTest, LogWithExplicitContext_InvalidLevelFiltered)
 
     Logger::get_instance().log(static_cast<LogLevel>(-1), "X", "f.cpp", 1, "fn", "cat");
 }
+
+/**
+ * @brief Tests that a category message carries the category name.
+ */
+TEST_F(LoggerTest, CategoryMessageCarriesCategoryName)
+{
+    auto category = Logger::get_instance().get_category("LoggerTest.Name");
+
+    EXPECT_CALL(*m_mock_appender, internal_append(::testing::_, ::testing::_))
+        .WillOnce([](const LogMessage& msg, const std::source_location&) {
+            EXPECT_EQ(msg.get_category(), "LoggerTest.Name");
+            EXPECT_EQ(msg.get_message(), "Categorized");
+        });
+
+    Logger::get_instance().log(category, LogLevel::Info, "Categorized");
+}
+
+/**
+ * @brief Tests that a category can be more verbose than the logger level.
+ */
+TEST_F(LoggerTest, CategoryLevelOverridesLoggerLevel)
+{
+    auto& logger = Logger::get_instance();
+    auto network = logger.get_category("LoggerTest.Network");
+    auto storage = logger.get_category("LoggerTest.Storage");
+
+    logger.set_log_level(LogLevel::Warning);
+    logger.set_category_level(network, LogLevel::Debug);
+
+    EXPECT_EQ(logger.get_category_level(network), LogLevel::Debug);
+    EXPECT_EQ(logger.get_category_level(storage), LogLevel::Warning);
+    EXPECT_EQ(m_mock_appender->get_log_level(), LogLevel::Debug);
+
+    EXPECT_CALL(*m_mock_appender, internal_append(::testing::_, ::testing::_)).Times(2);
+
+    logger.log(network, LogLevel::Debug, "Network debug is delivered");
+    logger.log(storage, LogLevel::Debug, "Storage debug is dropped");
+    logger.log(LogLevel::Info, "Uncategorized info is dropped");
+    logger.log(storage, LogLevel::Warning, "Storage warning is delivered");
+
+    logger.reset_category_level(network);
+    EXPECT_EQ(logger.get_category_level(network), LogLevel::Warning);
+    EXPECT_EQ(m_mock_appender->get_log_level(), LogLevel::Warning);
+}
+
+/**
+ * @brief Tests that a category can be quieter than the logger level.
+ */
+TEST_F(LoggerTest, CategoryLevelCanSilenceCategory)
+{
+    auto& logger = Logger::get_instance();
+    auto chatty = logger.get_category("LoggerTest.Chatty");
+    logger.set_category_level(chatty, LogLevel::Error);
+
+    EXPECT_CALL(*m_mock_appender, internal_append(::testing::_, ::testing::_)).Times(1);
+
+    logger.log(chatty, LogLevel::Warning, "Dropped");
+    logger.log(LogLevel::Info, "Delivered");
+
+    logger.reset_category_level(chatty);
+}
@@ -0,0 +1,158 @@
+#include "SimpleCppLogger/MemoryAppenderTest.h"
+
+#include <atomic>
+#include <memory>
+#include <source_location>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "SimpleCppLogger/LoggerContext.h"
+#include "SimpleCppLogger/MemoryAppender.h"
+#include "SimpleCppLogger/SimpleFormatter.h"
+
+using namespace SimpleCppLogger;
+
+/**
+ * @brief Tests that records are kept in order with their level and timestamp.
+ */
+TEST_F(MemoryAppenderTest, StoresRecordsInOrder)
+{
+    MemoryAppender appender(8);
+    LogMessage first(LogLevel::Info, "first");
+    appender.append(first);
+    appender.append(LogMessage(LogLevel::Error, "second"));
+
+    const auto records = appender.snapshot();
+    ASSERT_EQ(records.size(), 2u);
+    EXPECT_EQ(records[0].sequence, 0u);
+    EXPECT_EQ(records[0].level, LogLevel::Info);
+    EXPECT_EQ(records[0].timestamp, first.get_timestamp());
+    EXPECT_EQ(records[0].text, "first");
+    EXPECT_EQ(records[1].level, LogLevel::Error);
+    EXPECT_EQ(records[1].text, "second");
+    EXPECT_EQ(appender.get_total_count(), 2u);
+}
+
+/**
+ * @brief Tests that the ring keeps only the most recent records.
+ */
+TEST_F(MemoryAppenderTest, KeepsMostRecentRecords)
+{
+    MemoryAppender appender(3);
+    EXPECT_EQ(appender.get_capacity(), 4u);
+
+    for (int i = 0; i < 10; ++i)
+    {
+        appender.append(LogMessage(LogLevel::Info, std::to_string(i)));
+    }
+
+    EXPECT_EQ(appender.get_texts(), (std::vector<std::string>{"6", "7", "8", "9"}));
+    EXPECT_EQ(appender.get_dropped_count(), 0u);
+}
+
+/**
+ * @brief Tests that long texts are truncated to the record size.
+ */
+TEST_F(MemoryAppenderTest, TruncatesLongRecords)
+{
+    MemoryAppender appender(2, 10);
+    appender.append(LogMessage(LogLevel::Info, "0123456789abcdef"));
+    appender.append(LogMessage(LogLevel::Info, "short"));
+
+    EXPECT_EQ(appender.get_texts(), (std::vector<std::string>{"0123456789", "short"}));
+}
+
+/**
+ * @brief Tests that a formatter is applied and the level filter of the appender is honored.
+ */
+TEST_F(MemoryAppenderTest, UsesFormatterAndLevel)
+{
+    MemoryAppender appender(4, 512, std::make_shared<SimpleFormatter>(false));
+    appender.set_log_level(LogLevel::Warning);
+
+    appender.append(LogMessage(LogLevel::Info, "ignored"));
+    appender.append(LogMessage(LogLevel::Warning, "formatted"), std::source_location{});
+
+    const auto texts = appender.get_texts();
+    ASSERT_EQ(texts.size(), 1u);
+    EXPECT_EQ(texts[0].rfind("[Warning  ]: ", 0), 0u);
+    EXPECT_NE(texts[0].find("formatted"), std::string::npos);
+}
+
+/**
+ * @brief Tests that the appender can replace a mock appender in a LoggerContext.
+ */
+TEST_F(MemoryAppenderTest, CollectsMessagesOfAContext)
+{
+    auto appender = std::make_shared<MemoryAppender>(16);
+    LoggerContext context;
+    context.add_appender(appender);
+    context.set_log_level(LogLevel::Info);
+
+    context.log(LogLevel::Debug, "hidden");
+    context.log(LogLevel::Info, "visible");
+
+    EXPECT_EQ(appender->get_texts(), (std::vector<std::string>{"visible"}));
+}
+
+/**
+ * @brief Tests that snapshots taken while several threads append only contain complete
+ * records.
+ */
+TEST_F(MemoryAppenderTest, SnapshotsDuringConcurrentWrites)
+{
+    constexpr int ThreadCount = 4;
+    constexpr int MessagesPerThread = 5000;
+
+    MemoryAppender appender(64, 64);
+    std::atomic<bool> done{false};
+    std::atomic<int> inconsistent{0};
+
+    std::thread reader([&]() {
+        while (!done.load())
+        {
+            for (const auto& record: appender.snapshot())
+            {
+                const auto separator = record.text.find(':');
+                if (separator == std::string::npos ||
+                    record.text.substr(separator + 1) != std::string(40, record.text[0]))
+                {
+                    inconsistent.fetch_add(1);
+                }
+            }
+        }
+    });
+
+    std::vector<std::thread> writers;
+    for (int t = 0; t < ThreadCount; ++t)
+    {
+        writers.emplace_back([&appender, t]() {
+            const std::string text =
+                std::string(1, static_cast<char>('a' + t)) + ":" +
+                std::string(40, static_cast<char>('a' + t));
+            for (int i = 0; i < MessagesPerThread; ++i)
+            {
+                appender.append(LogMessage(LogLevel::Info, text));
+            }
+        });
+    }
+
+    for (auto& writer: writers)
+    {
+        writer.join();
+    }
+    done = true;
+    reader.join();
+
+    EXPECT_EQ(inconsistent.load(), 0);
+    EXPECT_EQ(appender.get_total_count(),
+              static_cast<std::uint64_t>(ThreadCount * MessagesPerThread));
+
+    const auto records = appender.snapshot();
+    EXPECT_LE(records.size(), appender.get_capacity());
+    for (std::size_t i = 1; i < records.size(); ++i)
+    {
+        EXPECT_LT(records[i - 1].sequence, records[i].sequence);
+    }
+}
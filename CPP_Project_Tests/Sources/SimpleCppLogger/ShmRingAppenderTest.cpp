@@ -0,0 +1,313 @@
+#include "SimpleCppLogger/ShmRingAppenderTest.h"
+
+#ifndef _WIN32
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "SimpleCppLogger/LoggerContext.h"
+#include "SimpleCppLogger/ShmRing.h"
+#include "SimpleCppLogger/ShmRingAppender.h"
+#include "SimpleCppLogger/ShmRingReader.h"
+
+using namespace SimpleCppLogger;
+
+/**
+ * @brief Chooses a shared-memory name that is unique to the process and the test.
+ */
+void ShmRingAppenderTest::SetUp()
+{
+    m_name = "/SimpleCppLoggerTest_" + std::to_string(::getpid()) + "_" +
+             ::testing::UnitTest::GetInstance()->current_test_info()->name();
+    ShmRing::remove(m_name);
+}
+
+/**
+ * @brief Removes the shared-memory object of the test.
+ */
+void ShmRingAppenderTest::TearDown()
+{
+    ShmRing::remove(m_name);
+}
+
+/**
+ * @brief Reads the whole content of a file descriptor from the start.
+ */
+auto ShmRingAppenderTest::read_all(int fd) -> std::string
+{
+    std::string content;
+    char buffer[4096];
+
+    ::lseek(fd, 0, SEEK_SET);
+    while (true)
+    {
+        const ssize_t read = ::read(fd, buffer, sizeof(buffer));
+        if (read <= 0)
+        {
+            break;
+        }
+        content.append(buffer, static_cast<std::size_t>(read));
+    }
+
+    return content;
+}
+
+/**
+ * @brief Tests that records written by the producer are read in order with their metadata.
+ */
+TEST_F(ShmRingAppenderTest, RingRoundTrip)
+{
+    ShmRing producer(m_name, 4096);
+    ASSERT_TRUE(producer.is_open());
+    EXPECT_EQ(producer.get_capacity(), 4096u);
+
+    const auto timestamp = LogMessage::Clock::now();
+    EXPECT_TRUE(producer.write(LogLevel::Warning, timestamp, "first"));
+    EXPECT_TRUE(producer.write(LogLevel::Info, timestamp, "second"));
+
+    ShmRing consumer(m_name, 0);
+    ASSERT_TRUE(consumer.is_open());
+
+    std::vector<std::string> texts;
+    const std::size_t count = consumer.read([&](std::span<const ShmRecordView> records) {
+        for (const auto& record: records)
+        {
+            texts.emplace_back(record.text);
+        }
+        EXPECT_EQ(records[0].level, LogLevel::Warning);
+        EXPECT_EQ(records[0].timestamp, timestamp);
+        return true;
+    });
+
+    EXPECT_EQ(count, 2u);
+    EXPECT_EQ(texts, (std::vector<std::string>{"first", "second"}));
+    EXPECT_EQ(producer.get_pending_bytes(), 0u);
+}
+
+/**
+ * @brief Tests that attaching to a missing ring fails without throwing.
+ */
+TEST_F(ShmRingAppenderTest, AttachToMissingRingFails)
+{
+    ShmRing ring(m_name, 0);
+    EXPECT_FALSE(ring.is_open());
+    EXPECT_FALSE(ring.write(LogLevel::Info, LogMessage::Clock::now(), "ignored"));
+
+    ShmRingReader reader(m_name);
+    EXPECT_FALSE(reader.is_open());
+}
+
+/**
+ * @brief Tests that records are dropped and counted when the reader falls behind, and that
+ * records wrap around the end of the data area.
+ */
+TEST_F(ShmRingAppenderTest, FullRingDropsAndWraps)
+{
+    ShmRing ring(m_name, 4096);
+    const std::string text(1000, 'x');
+    const auto timestamp = LogMessage::Clock::now();
+
+    int written = 0;
+    while (ring.write(LogLevel::Info, timestamp, text))
+    {
+        ++written;
+    }
+    EXPECT_EQ(written, 4);
+    EXPECT_EQ(ring.get_dropped_count(), 1u);
+
+    std::size_t read = ring.read([](std::span<const ShmRecordView>) { return true; });
+    EXPECT_EQ(read, 4u);
+
+    for (int round = 0; round < 20; ++round)
+    {
+        ASSERT_TRUE(ring.write(LogLevel::Info, timestamp, text + std::to_string(round)));
+        ASSERT_TRUE(ring.write(LogLevel::Info, timestamp, "short"));
+
+        std::vector<std::string> texts;
+        ring.read([&](std::span<const ShmRecordView> records) {
+            for (const auto& record: records)
+            {
+                texts.emplace_back(record.text);
+            }
+            return true;
+        });
+        EXPECT_EQ(texts, (std::vector<std::string>{text + std::to_string(round), "short"}));
+    }
+}
+
+/**
+ * @brief Tests the path from a context through the appender and the reader into a file.
+ */
+TEST_F(ShmRingAppenderTest, ReaderWritesRecordsToFile)
+{
+    auto appender = std::make_shared<ShmRingAppender>(m_name);
+    ASSERT_TRUE(appender->is_open());
+
+    LoggerContext context;
+    context.add_appender(appender);
+    context.set_log_level(LogLevel::Info);
+    context.log(LogLevel::Info, "hello from the producer");
+    context.log(LogLevel::Error, "something failed");
+
+    std::FILE* file = std::tmpfile();
+    ASSERT_NE(file, nullptr);
+
+    ShmRingReader reader(m_name);
+    ASSERT_TRUE(reader.is_open());
+    EXPECT_EQ(reader.poll(fileno(file)), 2u);
+    EXPECT_EQ(reader.poll(fileno(file)), 0u);
+
+    const std::string content = read_all(fileno(file));
+    std::fclose(file);
+
+    const auto first = content.find("hello from the producer");
+    const auto second = content.find("something failed");
+    ASSERT_NE(first, std::string::npos);
+    ASSERT_NE(second, std::string::npos);
+    EXPECT_LT(first, second);
+    EXPECT_EQ(content.find('\033'), std::string::npos);
+    EXPECT_EQ(content.back(), '\n');
+}
+
+/**
+ * @brief Tests that the reader reports records the producer had to drop.
+ */
+TEST_F(ShmRingAppenderTest, ReaderReportsDrops)
+{
+    ShmRingAppenderOptions options;
+    options.capacity = 4096;
+    ShmRingAppender appender(m_name, options, nullptr);
+
+    for (int i = 0; i < 10; ++i)
+    {
+        appender.append(LogMessage(LogLevel::Info, std::string(1000, 'y')));
+    }
+    EXPECT_EQ(appender.get_dropped_count(), 6u);
+
+    std::FILE* file = std::tmpfile();
+    ASSERT_NE(file, nullptr);
+
+    ShmRingReader reader(m_name);
+    EXPECT_EQ(reader.poll(fileno(file)), 4u);
+    const std::string content = read_all(fileno(file));
+    std::fclose(file);
+
+    EXPECT_EQ(content.rfind("[ShmRingReader]: 6 records dropped", 0), 0u);
+}
+
+/**
+ * @brief Tests that the reader keeps the records and the drop notice when writing fails, and
+ * writes them with the next poll.
+ */
+TEST_F(ShmRingAppenderTest, ReaderKeepsRecordsOnWriteFailure)
+{
+    ShmRingAppenderOptions options;
+    options.capacity = 4096;
+    ShmRingAppender appender(m_name, options, nullptr);
+
+    for (int i = 0; i < 5; ++i)
+    {
+        appender.append(LogMessage(LogLevel::Info, std::string(1000, 'z')));
+    }
+
+    ShmRingReader reader(m_name);
+    ASSERT_TRUE(reader.is_open());
+    EXPECT_EQ(reader.poll(-1), 0u);
+    EXPECT_GT(ShmRing(m_name, 0).get_pending_bytes(), 0u);
+
+    std::FILE* file = std::tmpfile();
+    ASSERT_NE(file, nullptr);
+    EXPECT_EQ(reader.poll(fileno(file)), 4u);
+    const std::string content = read_all(fileno(file));
+    std::fclose(file);
+
+    EXPECT_EQ(content.rfind("[ShmRingReader]: 1 records dropped", 0), 0u);
+}
+
+/**
+ * @brief Tests that reading stops at a record header whose size points past the published data,
+ * as a corrupt or hostile producer could write.
+ */
+TEST_F(ShmRingAppenderTest, CorruptRecordSizeStopsReading)
+{
+    ShmRing ring(m_name, 4096);
+    const auto timestamp = LogMessage::Clock::now();
+    ASSERT_TRUE(ring.write(LogLevel::Info, timestamp, "first"));
+    ASSERT_TRUE(ring.write(LogLevel::Info, timestamp, "second"));
+
+    // The data area follows a 256-byte ring header; "first" takes one 32-byte record.
+    const int fd = ::shm_open(m_name.c_str(), O_RDWR, 0);
+    ASSERT_GE(fd, 0);
+    void* mapping = ::mmap(nullptr, 256 + 4096, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    ASSERT_NE(mapping, MAP_FAILED);
+    const std::uint32_t size = 0xFFFFFFF0;
+    std::memcpy(static_cast<char*>(mapping) + 256 + 32, &size, sizeof(size));
+    ::munmap(mapping, 256 + 4096);
+
+    std::vector<std::string> texts;
+    const std::size_t count = ring.read([&](std::span<const ShmRecordView> records) {
+        for (const auto& record: records)
+        {
+            texts.emplace_back(record.text);
+        }
+        return true;
+    });
+
+    EXPECT_EQ(count, 1u);
+    EXPECT_EQ(texts, (std::vector<std::string>{"first"}));
+    EXPECT_EQ(ring.read([](std::span<const ShmRecordView>) { return true; }), 0u);
+}
+
+/**
+ * @brief Tests that a reader on another thread receives every record with the Block policy.
+ */
+TEST_F(ShmRingAppenderTest, BlockPolicyWaitsForReader)
+{
+    ShmRingAppenderOptions options;
+    options.capacity = 4096;
+    options.overflow_policy = ShmOverflowPolicy::Block;
+    options.block_timeout = std::chrono::milliseconds(5000);
+    ShmRingAppender appender(m_name, options, nullptr);
+
+    constexpr int MessageCount = 2000;
+    std::vector<std::string> received;
+
+    std::thread consumer([this, &received]() {
+        ShmRing ring(m_name, 0);
+        while (received.size() < MessageCount)
+        {
+            ring.read([&received](std::span<const ShmRecordView> records) {
+                for (const auto& record: records)
+                {
+                    received.emplace_back(record.text);
+                }
+                return true;
+            });
+        }
+    });
+
+    for (int i = 0; i < MessageCount; ++i)
+    {
+        appender.append(LogMessage(LogLevel::Info, "message " + std::to_string(i)));
+    }
+    consumer.join();
+
+    EXPECT_EQ(appender.get_dropped_count(), 0u);
+    ASSERT_EQ(received.size(), static_cast<std::size_t>(MessageCount));
+    for (int i = 0; i < MessageCount; ++i)
+    {
+        EXPECT_EQ(received[i], "message " + std::to_string(i));
+    }
+}
+
+#endif
@@ -180,3 +180,50 @@ TEST_F(SimpleFormatterTest, NonAsciiMessageContent)
     EXPECT_NE(formatted.find("üñîçødë"), std::string::npos);
     EXPECT_NE(formatted.find("测试"), std::string::npos);
 }
+
+/**
+ * @brief Tests that a formatter with colors disabled emits no ANSI escape sequences.
+ */
+TEST_F(SimpleFormatterTest, ColorsDisabledEmitsNoEscapeSequences)
+{
+    SimpleFormatter formatter(false);
+    EXPECT_FALSE(formatter.uses_colors());
+    EXPECT_TRUE(SimpleFormatter().uses_colors());
+
+    for (std::size_t i = 0; i < LogLevelCount; ++i)
+    {
+        LogMessage msg(static_cast<LogLevel>(i), "Plain");
+        auto location = std::source_location::current();
+        auto formatted = formatter.format(msg, location);
+
+        EXPECT_EQ(formatted.find("\033["), std::string::npos);
+        EXPECT_NE(formatted.find("Plain"), std::string::npos);
+        EXPECT_NE(formatted.find(std::string(location.file_name()) + ":" +
+                                 std::to_string(location.line())),
+                  std::string::npos);
+    }
+}
+
+/**
+ * @brief Tests that the category is printed in front of the message.
+ */
+TEST_F(SimpleFormatterTest, CategoryPrecedesMessage)
+{
+    SimpleFormatter formatter;
+    LogMessage msg(LogLevel::Info, "Connected", "Network");
+    auto formatted = formatter.format(msg, std::source_location::current());
+
+    EXPECT_NE(formatted.find("[Network] Connected"), std::string::npos);
+}
+
+/**
+ * @brief Tests that an explicit source context is printed when the location is empty.
+ */
+TEST_F(SimpleFormatterTest, ExplicitSourceContextUsedForEmptyLocation)
+{
+    SimpleFormatter formatter(false);
+    LogMessage msg(LogLevel::Info, "Bridged", "", "script.py", 7, "on_event");
+    auto formatted = formatter.format(msg, std::source_location{});
+
+    EXPECT_NE(formatted.find("Bridged - script.py:7, on_event"), std::string::npos);
+}
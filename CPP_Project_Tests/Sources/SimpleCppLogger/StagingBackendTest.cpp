@@ -0,0 +1,347 @@
+#include "SimpleCppLogger/StagingBackendTest.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "SimpleCppLogger/LogLevel.h"
+#include "SimpleCppLogger/LogMessage.h"
+#include "SimpleCppLogger/StagingBackend.h"
+#include "SimpleCppLogger/StagingBuffer.h"
+
+using namespace SimpleCppLogger;
+
+/**
+ * @brief Tests that records are popped in push order with increasing sequence numbers.
+ */
+TEST_F(StagingBackendTest, BufferKeepsPushOrder)
+{
+    StagingBuffer buffer(4);
+    EXPECT_TRUE(buffer.is_empty());
+
+    EXPECT_TRUE(buffer.push(LogMessage(LogLevel::Info, "first"), std::source_location::current(),
+                            StagingFullPolicy::Drop));
+    EXPECT_TRUE(buffer.push(LogMessage(LogLevel::Info, "second"), std::source_location::current(),
+                            StagingFullPolicy::Drop));
+    EXPECT_FALSE(buffer.is_empty());
+
+    std::vector<StagedRecord> records;
+    EXPECT_EQ(buffer.pop_all(records), 2u);
+    ASSERT_EQ(records.size(), 2u);
+    EXPECT_EQ(records[0].message.get_message(), "first");
+    EXPECT_EQ(records[1].message.get_message(), "second");
+    EXPECT_LT(records[0].sequence, records[1].sequence);
+    EXPECT_TRUE(buffer.is_empty());
+}
+
+/**
+ * @brief Tests that a full buffer drops and counts records with the Drop policy.
+ */
+TEST_F(StagingBackendTest, BufferDropsWhenFull)
+{
+    StagingBuffer buffer(3);
+    ASSERT_EQ(buffer.get_capacity(), 4u);
+
+    for (int i = 0; i < 6; ++i)
+    {
+        buffer.push(LogMessage(LogLevel::Info, std::to_string(i)), std::source_location::current(),
+                    StagingFullPolicy::Drop);
+    }
+
+    std::vector<StagedRecord> records;
+    EXPECT_EQ(buffer.pop_all(records), 4u);
+    EXPECT_EQ(buffer.get_dropped_count(), 2u);
+    EXPECT_EQ(records.back().message.get_message(), "3");
+}
+
+/**
+ * @brief Tests that drain() delivers records submitted without a running backend thread.
+ */
+TEST_F(StagingBackendTest, DrainDeliversSubmittedRecords)
+{
+    std::vector<std::string> delivered;
+    StagingBackend backend({}, [&delivered](std::vector<StagedRecord>& records) {
+        for (const auto& record: records)
+        {
+            delivered.push_back(record.message.get_message());
+        }
+    });
+
+    backend.submit(LogMessage(LogLevel::Info, "a"), std::source_location::current());
+    backend.submit(LogMessage(LogLevel::Info, "b"), std::source_location::current());
+
+    EXPECT_EQ(backend.get_buffer_count(), 1u);
+    EXPECT_EQ(backend.drain(), 2u);
+    EXPECT_EQ(delivered, (std::vector<std::string>{"a", "b"}));
+    EXPECT_EQ(backend.drain(), 0u);
+}
+
+/**
+ * @brief Tests that records of several threads are merged in timestamp order while the order
+ * within each thread is preserved.
+ */
+TEST_F(StagingBackendTest, MergesThreadsInTimestampOrder)
+{
+    constexpr int thread_count = 4;
+    constexpr int messages_per_thread = 500;
+
+    std::vector<LogMessage::Clock::time_point> timestamps;
+    std::map<char, std::vector<int>> per_thread;
+
+    StagingBackend backend({}, [&](std::vector<StagedRecord>& records) {
+        for (const auto& record: records)
+        {
+            timestamps.push_back(record.message.get_timestamp());
+            const std::string& text = record.message.get_message();
+            per_thread[text[0]].push_back(std::stoi(text.substr(1)));
+        }
+    });
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < thread_count; ++t)
+    {
+        threads.emplace_back([&backend, t] {
+            for (int i = 0; i < messages_per_thread; ++i)
+            {
+                std::string text(1, static_cast<char>('a' + t));
+                text += std::to_string(i);
+                backend.submit(LogMessage(LogLevel::Info, std::move(text)),
+                               std::source_location::current());
+            }
+        });
+    }
+
+    for (auto& thread: threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(backend.drain(), static_cast<std::size_t>(thread_count * messages_per_thread));
+
+    for (std::size_t i = 1; i < timestamps.size(); ++i)
+    {
+        EXPECT_LE(timestamps[i - 1], timestamps[i]);
+    }
+
+    ASSERT_EQ(per_thread.size(), static_cast<std::size_t>(thread_count));
+    for (const auto& [thread, indices]: per_thread)
+    {
+        ASSERT_EQ(indices.size(), static_cast<std::size_t>(messages_per_thread));
+        for (int i = 0; i < messages_per_thread; ++i)
+        {
+            EXPECT_EQ(indices[i], i);
+        }
+    }
+}
+
+/**
+ * @brief Tests that buffers of exited threads are released once they are drained.
+ */
+TEST_F(StagingBackendTest, RetiresBuffersOfExitedThreads)
+{
+    std::size_t delivered = 0;
+    StagingBackend backend({}, [&delivered](std::vector<StagedRecord>& records) {
+        delivered += records.size();
+    });
+
+    std::thread producer([&backend] {
+        backend.submit(LogMessage(LogLevel::Info, "last words"), std::source_location::current());
+    });
+    producer.join();
+
+    EXPECT_EQ(backend.get_buffer_count(), 1u);
+    EXPECT_EQ(backend.drain(), 1u);
+    EXPECT_EQ(delivered, 1u);
+    EXPECT_EQ(backend.get_buffer_count(), 0u);
+}
+
+/**
+ * @brief Tests that the backend thread delivers records and stop() flushes the rest.
+ */
+TEST_F(StagingBackendTest, BackendThreadDeliversRecords)
+{
+    std::mutex mutex;
+    std::size_t delivered = 0;
+    BackendOptions options;
+    options.poll_interval = std::chrono::microseconds(100);
+
+    StagingBackend backend(options, [&](std::vector<StagedRecord>& records) {
+        std::lock_guard<std::mutex> lock(mutex);
+        delivered += records.size();
+    });
+
+    backend.start();
+    EXPECT_TRUE(backend.is_running());
+
+    for (int i = 0; i < 100; ++i)
+    {
+        backend.submit(LogMessage(LogLevel::Info, "tick"), std::source_location::current());
+    }
+
+    backend.stop();
+    EXPECT_FALSE(backend.is_running());
+
+    std::lock_guard<std::mutex> lock(mutex);
+    EXPECT_EQ(delivered, 100u);
+}
+
+/**
+ * @brief Tests that a sharded backend keeps the order within each thread while its shard drain
+ * threads run.
+ */
+TEST_F(StagingBackendTest, ShardedBackendKeepsOrder)
+{
+    constexpr int thread_count = 4;
+    constexpr int messages_per_thread = 500;
+
+    std::mutex mutex;
+    std::map<char, std::vector<int>> per_thread;
+
+    BackendOptions options;
+    options.sharding = BackendSharding::CoreGroup;
+    options.cores_per_group = 1;
+    options.poll_interval = std::chrono::microseconds(100);
+
+    StagingBackend backend(options, [&](std::vector<StagedRecord>& records) {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (const auto& record: records)
+        {
+            const std::string& text = record.message.get_message();
+            per_thread[text[0]].push_back(std::stoi(text.substr(1)));
+        }
+    });
+    ASSERT_GE(backend.get_shard_count(), 1u);
+
+    backend.start();
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < thread_count; ++t)
+    {
+        threads.emplace_back([&backend, t] {
+            // Spread the producers over the shards regardless of the CPU they run on.
+            EXPECT_TRUE(backend.bind_current_thread(t % backend.get_shard_count()));
+            EXPECT_FALSE(backend.bind_current_thread(0));
+
+            for (int i = 0; i < messages_per_thread; ++i)
+            {
+                std::string text(1, static_cast<char>('a' + t));
+                text += std::to_string(i);
+                backend.submit(LogMessage(LogLevel::Info, std::move(text)),
+                               std::source_location::current());
+            }
+        });
+    }
+
+    for (auto& thread: threads)
+    {
+        thread.join();
+    }
+
+    backend.stop();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    ASSERT_EQ(per_thread.size(), static_cast<std::size_t>(thread_count));
+    for (const auto& [thread, indices]: per_thread)
+    {
+        ASSERT_EQ(indices.size(), static_cast<std::size_t>(messages_per_thread));
+        for (int i = 0; i < messages_per_thread; ++i)
+        {
+            EXPECT_EQ(indices[i], i);
+        }
+    }
+
+    EXPECT_EQ(backend.get_buffer_count(), 0u);
+}
+
+/**
+ * @brief Tests that a thread cannot be bound to a shard that does not exist.
+ */
+TEST_F(StagingBackendTest, BindRejectsUnknownShard)
+{
+    BackendOptions options;
+    options.sharding = BackendSharding::NumaNode;
+    StagingBackend backend(options, {});
+
+    EXPECT_FALSE(backend.bind_current_thread(backend.get_shard_count()));
+    EXPECT_EQ(backend.get_buffer_count(), 0u);
+}
+
+/**
+ * @brief Tests that every wait strategy picks up records while running, not only when stop()
+ * drains them. poll_interval is long enough that Block and Hybrid must be woken by submit().
+ */
+TEST_F(StagingBackendTest, WaitStrategiesDeliverRecords)
+{
+    for (const auto strategy: {BackendWaitStrategy::Spin, BackendWaitStrategy::Yield,
+                               BackendWaitStrategy::Block, BackendWaitStrategy::Hybrid})
+    {
+        std::mutex mutex;
+        std::condition_variable delivered_cv;
+        std::size_t delivered = 0;
+        BackendOptions options;
+        options.wait_strategy = strategy;
+        options.poll_interval = std::chrono::minutes(1);
+        options.spin_polls = 16;
+        options.yield_polls = 4;
+
+        StagingBackend backend(options, [&](std::vector<StagedRecord>& records) {
+            std::lock_guard<std::mutex> lock(mutex);
+            delivered += records.size();
+            delivered_cv.notify_all();
+        });
+
+        backend.start();
+        // Let the backend run out of spin and yield polls before the records arrive.
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+        for (int i = 0; i < 100; ++i)
+        {
+            backend.submit(LogMessage(LogLevel::Info, "tick"), std::source_location::current());
+        }
+
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            EXPECT_TRUE(delivered_cv.wait_for(lock, std::chrono::seconds(10),
+                                              [&delivered] { return delivered == 100; }))
+                << "strategy " << static_cast<int>(strategy);
+        }
+
+        backend.stop();
+    }
+}
+
+/**
+ * @brief Tests that a submit wakes a sleeping Block backend long before poll_interval expires.
+ */
+TEST_F(StagingBackendTest, SubmitWakesSleepingBackend)
+{
+    std::mutex mutex;
+    std::condition_variable delivered_cv;
+    std::size_t delivered = 0;
+    BackendOptions options;
+    options.wait_strategy = BackendWaitStrategy::Block;
+    options.poll_interval = std::chrono::minutes(1);
+
+    StagingBackend backend(options, [&](std::vector<StagedRecord>& records) {
+        std::lock_guard<std::mutex> lock(mutex);
+        delivered += records.size();
+        delivered_cv.notify_all();
+    });
+
+    backend.start();
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    backend.submit(LogMessage(LogLevel::Info, "wake up"), std::source_location::current());
+
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        EXPECT_TRUE(delivered_cv.wait_for(lock, std::chrono::seconds(10),
+                                          [&delivered] { return delivered == 1; }));
+    }
+
+    backend.stop();
+}
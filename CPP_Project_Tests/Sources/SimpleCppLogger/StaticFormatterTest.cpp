@@ -0,0 +1,133 @@
+#include "SimpleCppLogger/StaticFormatterTest.h"
+
+#include <chrono>
+#include <regex>
+#include <source_location>
+#include <string>
+
+#include "SimpleCppLogger/LogMessage.h"
+#include "SimpleCppLogger/SimpleFormatter.h"
+#include "SimpleCppLogger/StaticFormatter.h"
+
+using namespace SimpleCppLogger;
+
+namespace
+{
+using BareFormatter = StaticFormatter<FormatterOptions{
+    .colors = false, .location = true, .function = true, .timestamp = TimestampStyle::None}>;
+using ColoredBareFormatter = StaticFormatter<FormatterOptions{
+    .colors = true, .location = true, .function = true, .timestamp = TimestampStyle::None}>;
+using MessageOnlyFormatter = StaticFormatter<FormatterOptions{
+    .colors = false, .location = false, .function = false, .timestamp = TimestampStyle::None}>;
+using UtcFormatter = StaticFormatter<FormatterOptions{
+    .colors = false, .location = false, .function = false,
+    .timestamp = TimestampStyle::Iso8601Utc}>;
+
+static_assert(BareFormatter::level_prefix(LogLevel::Info) == "[Info     ]: ");
+static_assert(BareFormatter::level_prefix(LogLevel::Warning) == "[Warning  ]: ");
+static_assert(BareFormatter::level_prefix(LogLevel::Count) == "[Unknown  ]: ");
+static_assert(ColoredBareFormatter::level_prefix(LogLevel::Error) ==
+              "\033[91m[Error    ]:\033[0m ");
+}  // namespace
+
+/**
+ * @brief Tests the level prefixes for all levels.
+ */
+TEST_F(StaticFormatterTest, LevelPrefixes)
+{
+    EXPECT_EQ(BareFormatter::level_prefix(LogLevel::Trace), "[Trace    ]: ");
+    EXPECT_EQ(BareFormatter::level_prefix(LogLevel::Debug), "[Debug    ]: ");
+    EXPECT_EQ(BareFormatter::level_prefix(LogLevel::Fatal), "[Fatal    ]: ");
+    EXPECT_EQ(BareFormatter::level_prefix(static_cast<LogLevel>(42)), "[Unknown  ]: ");
+    EXPECT_EQ(ColoredBareFormatter::level_prefix(LogLevel::Debug), "\033[92m[Debug    ]:\033[0m ");
+}
+
+/**
+ * @brief Tests the output with file, line and function.
+ */
+TEST_F(StaticFormatterTest, FormatWithLocation)
+{
+    BareFormatter formatter;
+    const auto location = std::source_location::current();
+    const std::string output = formatter.format(LogMessage(LogLevel::Info, "Hello"), location);
+
+    const std::string expected = std::string("[Info     ]: Hello - ") + location.file_name() +
+                                 ":" + std::to_string(location.line()) + ", " +
+                                 location.function_name();
+    EXPECT_EQ(output, expected);
+}
+
+/**
+ * @brief Tests that colors wrap the level tag and the context.
+ */
+TEST_F(StaticFormatterTest, FormatWithColors)
+{
+    ColoredBareFormatter formatter;
+    LogMessage message(LogLevel::Warning, "Careful", "", "main.cpp", 7, "run");
+    const std::string output = formatter.format(message, std::source_location{});
+
+    EXPECT_EQ(output, "\033[93m[Warning  ]:\033[0m Careful - \033[95mmain.cpp\033[0m:"
+                      "\033[95m7\033[0m, \033[95mrun\033[0m");
+}
+
+/**
+ * @brief Tests the category and the explicit source context of a message.
+ */
+TEST_F(StaticFormatterTest, FormatWithCategoryAndExplicitContext)
+{
+    BareFormatter formatter;
+    LogMessage message(LogLevel::Error, "Failed", "Net", "socket.cpp", 42, "connect");
+    EXPECT_EQ(formatter.format(message, std::source_location{}),
+              "[Error    ]: [Net] Failed - socket.cpp:42, connect");
+}
+
+/**
+ * @brief Tests that disabled parts are omitted.
+ */
+TEST_F(StaticFormatterTest, DisabledParts)
+{
+    MessageOnlyFormatter formatter;
+    EXPECT_EQ(formatter.format(LogMessage(LogLevel::Debug, "Plain")), "[Debug    ]: Plain");
+
+    PlainFormatter plain;
+    LogMessage message(LogLevel::Info, "Text", "", "file.cpp", 3, "function");
+    const std::string output = plain.format(message, std::source_location{});
+
+    EXPECT_EQ(output.find('\033'), std::string::npos);
+    EXPECT_NE(output.find(" - file.cpp:3"), std::string::npos);
+    EXPECT_EQ(output.find("function"), std::string::npos);
+}
+
+/**
+ * @brief Tests that the local timestamp matches the layout of SimpleFormatter.
+ */
+TEST_F(StaticFormatterTest, LocalTimestampMatchesSimpleFormatter)
+{
+    using LocalFormatter = StaticFormatter<FormatterOptions{.colors = false,
+                                                            .location = false,
+                                                            .function = false,
+                                                            .timestamp = TimestampStyle::Local}>;
+    LocalFormatter formatter;
+    const std::string output = formatter.format(LogMessage(LogLevel::Info, "Now"));
+
+    const std::regex pattern(R"(\[Info     \]: \d{4}-\d{2}-\d{2} \d{2}:\d{2}:\d{2} Now)");
+    EXPECT_TRUE(std::regex_match(output, pattern)) << output;
+
+    SimpleFormatter simple(false);
+    const std::string simple_output =
+        simple.format(LogMessage(LogLevel::Info, "Now"), std::source_location{});
+    EXPECT_TRUE(std::regex_match(simple_output, pattern)) << simple_output;
+}
+
+/**
+ * @brief Tests the ISO 8601 UTC timestamp style.
+ */
+TEST_F(StaticFormatterTest, Iso8601UtcTimestamp)
+{
+    UtcFormatter formatter;
+    const std::string output = formatter.format(LogMessage(LogLevel::Info, "Utc"));
+
+    const std::regex pattern(
+        R"(\[Info     \]: \d{4}-\d{2}-\d{2}T\d{2}:\d{2}:\d{2}\.\d{3}Z Utc)");
+    EXPECT_TRUE(std::regex_match(output, pattern)) << output;
+}
@@ -0,0 +1,209 @@
+#include "SimpleCppLogger/SyslogAppenderTest.h"
+
+#ifndef _WIN32
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <regex>
+#include <source_location>
+#include <string>
+#include <vector>
+
+#include "SimpleCppLogger/SimpleFormatter.h"
+#include "SimpleCppLogger/SyslogAppender.h"
+
+using namespace SimpleCppLogger;
+
+/**
+ * @brief Binds a non-blocking datagram socket to a path that is unique to the process and the
+ * test.
+ */
+void SyslogAppenderTest::SetUp()
+{
+    m_path = "/tmp/SimpleCppLoggerSyslog_" + std::to_string(::getpid()) + "_" +
+             ::testing::UnitTest::GetInstance()->current_test_info()->name();
+    ::unlink(m_path.c_str());
+
+    m_listener = ::socket(AF_UNIX, SOCK_DGRAM | SOCK_NONBLOCK, 0);
+    ASSERT_GE(m_listener, 0);
+
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    ASSERT_LT(m_path.size(), sizeof(address.sun_path));
+    std::memcpy(address.sun_path, m_path.c_str(), m_path.size());
+    ASSERT_EQ(::bind(m_listener, reinterpret_cast<const sockaddr*>(&address), sizeof(address)),
+              0);
+}
+
+/**
+ * @brief Closes and removes the listening socket.
+ */
+void SyslogAppenderTest::TearDown()
+{
+    if (m_listener >= 0)
+    {
+        ::close(m_listener);
+    }
+    ::unlink(m_path.c_str());
+}
+
+/**
+ * @brief Receives all datagrams that are currently queued on the listening socket.
+ */
+auto SyslogAppenderTest::receive_all() const -> std::vector<std::string>
+{
+    std::vector<std::string> datagrams;
+    char buffer[16384];
+
+    while (true)
+    {
+        const ssize_t received = ::recv(m_listener, buffer, sizeof(buffer), 0);
+        if (received < 0)
+        {
+            break;
+        }
+        datagrams.emplace_back(buffer, static_cast<std::size_t>(received));
+    }
+
+    return datagrams;
+}
+
+/**
+ * @brief Tests that a record is sent as an RFC 5424 message with the configured header fields.
+ */
+TEST_F(SyslogAppenderTest, SendsRfc5424Message)
+{
+    SyslogAppenderOptions options;
+    options.socket_path = m_path;
+    options.facility = 16;
+    options.app_name = "my app";
+    options.hostname = "host";
+
+    SyslogAppender appender(options);
+    ASSERT_TRUE(appender.is_connected());
+
+    appender.append(LogMessage(LogLevel::Warning, "disk almost full", "Storage"));
+    appender.append(LogMessage(LogLevel::Info, "no category"));
+
+    const auto datagrams = receive_all();
+    ASSERT_EQ(datagrams.size(), 2u);
+
+    // PRI = 16 * 8 + 4; the space in the app name is not allowed in a header field.
+    const std::regex pattern(
+        R"(<132>1 \d{4}-\d{2}-\d{2}T\d{2}:\d{2}:\d{2}\.\d{6}Z host myapp \d+ Storage - )"
+        R"(disk almost full)");
+    EXPECT_TRUE(std::regex_match(datagrams[0], pattern)) << datagrams[0];
+    EXPECT_TRUE(datagrams[1].starts_with("<134>1 ")) << datagrams[1];
+    EXPECT_TRUE(datagrams[1].ends_with(" - - no category")) << datagrams[1];
+
+    EXPECT_EQ(appender.get_sent_count(), 2u);
+    EXPECT_EQ(appender.get_dropped_count(), 0u);
+}
+
+/**
+ * @brief Tests the mapping from log levels to syslog severities.
+ */
+TEST_F(SyslogAppenderTest, SeverityMapping)
+{
+    EXPECT_EQ(SyslogAppender::to_severity(LogLevel::Trace), 7);
+    EXPECT_EQ(SyslogAppender::to_severity(LogLevel::Debug), 7);
+    EXPECT_EQ(SyslogAppender::to_severity(LogLevel::Info), 6);
+    EXPECT_EQ(SyslogAppender::to_severity(LogLevel::Warning), 4);
+    EXPECT_EQ(SyslogAppender::to_severity(LogLevel::Error), 3);
+    EXPECT_EQ(SyslogAppender::to_severity(LogLevel::Fatal), 2);
+}
+
+/**
+ * @brief Tests that the formatter output becomes the MSG part and long messages are truncated.
+ */
+TEST_F(SyslogAppenderTest, FormatterAndTruncation)
+{
+    SyslogAppenderOptions options;
+    options.socket_path = m_path;
+    options.max_message_size = 100;
+
+    SyslogAppender appender(options, std::make_shared<SimpleFormatter>(false));
+    appender.append(LogMessage(LogLevel::Error, std::string(500, 'x')));
+
+    const auto datagrams = receive_all();
+    ASSERT_EQ(datagrams.size(), 1u);
+    EXPECT_EQ(datagrams[0].size(), 100u);
+    EXPECT_TRUE(datagrams[0].starts_with("<11>1 ")) << datagrams[0];
+    EXPECT_NE(datagrams[0].find("[Error"), std::string::npos) << datagrams[0];
+}
+
+/**
+ * @brief Tests that a batch is level-filtered and arrives in order.
+ */
+TEST_F(SyslogAppenderTest, BatchArrivesInOrder)
+{
+    SyslogAppenderOptions options;
+    options.socket_path = m_path;
+
+    SyslogAppender appender(options);
+    appender.set_log_level(LogLevel::Info);
+
+    std::vector<StagedRecord> records;
+    for (int i = 0; i < 20; ++i)
+    {
+        const LogLevel level = i % 2 == 0 ? LogLevel::Info : LogLevel::Debug;
+        records.push_back({LogMessage(level, std::to_string(i)), std::source_location{}});
+    }
+    appender.append_batch(records);
+
+    const auto datagrams = receive_all();
+    ASSERT_EQ(datagrams.size(), 10u);
+    for (std::size_t i = 0; i < datagrams.size(); ++i)
+    {
+        EXPECT_TRUE(datagrams[i].ends_with(" - - " + std::to_string(i * 2))) << datagrams[i];
+    }
+    EXPECT_EQ(appender.get_sent_count(), 10u);
+}
+
+/**
+ * @brief Tests that records are dropped instead of blocking when nobody reads the socket.
+ */
+TEST_F(SyslogAppenderTest, DropsWhenBufferIsFull)
+{
+    SyslogAppenderOptions options;
+    options.socket_path = m_path;
+
+    SyslogAppender appender(options);
+
+    const std::string text(1024, 'y');
+    for (int i = 0; i < 10000; ++i)
+    {
+        appender.append(LogMessage(LogLevel::Info, text));
+    }
+
+    EXPECT_GT(appender.get_dropped_count(), 0u);
+    EXPECT_EQ(appender.get_sent_count() + appender.get_dropped_count(), 10000u);
+    EXPECT_EQ(receive_all().size(), appender.get_sent_count());
+}
+
+/**
+ * @brief Tests that records are dropped and counted while no daemon is listening.
+ */
+TEST_F(SyslogAppenderTest, DropsWithoutListener)
+{
+    ::close(m_listener);
+    m_listener = -1;
+    ::unlink(m_path.c_str());
+
+    SyslogAppenderOptions options;
+    options.socket_path = m_path;
+
+    SyslogAppender appender(options);
+    EXPECT_FALSE(appender.is_connected());
+
+    appender.append(LogMessage(LogLevel::Error, "lost"));
+    appender.append(LogMessage(LogLevel::Error, "lost too"));
+
+    EXPECT_EQ(appender.get_sent_count(), 0u);
+    EXPECT_EQ(appender.get_dropped_count(), 2u);
+}
+
+#endif
@@ -0,0 +1,56 @@
+﻿#include "SimpleCppLogger/Utf8ConversionTest.h"
+
+#include <string>
+
+#include "SimpleCppLogger/Utf8Conversion.h"
+
+using namespace SimpleCppLogger;
+
+/**
+ * @brief Tests that ASCII text is copied unchanged.
+ */
+TEST_F(Utf8ConversionTest, AsciiIsCopied)
+{
+    EXPECT_EQ(to_utf8(L"Hello, World!"), "Hello, World!");
+    EXPECT_EQ(to_utf8(L""), "");
+}
+
+/**
+ * @brief Tests two- and three-byte sequences.
+ */
+TEST_F(Utf8ConversionTest, BasicMultilingualPlane)
+{
+    EXPECT_EQ(to_utf8(L"Grüße"), "Gr\xC3\xBC\xC3\x9F" "e");
+    EXPECT_EQ(to_utf8(L"€ 5"), "\xE2\x82\xAC 5");
+    EXPECT_EQ(to_utf8(L"日本"), "\xE6\x97\xA5\xE6\x9C\xAC");
+}
+
+/**
+ * @brief Tests characters outside the Basic Multilingual Plane (surrogate pairs on Windows).
+ */
+TEST_F(Utf8ConversionTest, SupplementaryPlanes)
+{
+    EXPECT_EQ(to_utf8(L"a\U0001F600b"), "a\xF0\x9F\x98\x80" "b");
+}
+
+/**
+ * @brief Tests that invalid code units are replaced with U+FFFD.
+ */
+TEST_F(Utf8ConversionTest, InvalidUnitsAreReplaced)
+{
+    std::wstring lone_surrogate = L"x";
+    lone_surrogate += static_cast<wchar_t>(0xD800);
+    lone_surrogate += L"y";
+
+    EXPECT_EQ(to_utf8(lone_surrogate), "x\xEF\xBF\xBDy");
+}
+
+/**
+ * @brief Tests that append_utf8 appends to existing content.
+ */
+TEST_F(Utf8ConversionTest, AppendKeepsExistingContent)
+{
+    std::string out = "prefix:";
+    append_utf8(out, L"été");
+    EXPECT_EQ(out, "prefix:\xC3\xA9t\xC3\xA9");
+}
@@ -0,0 +1,125 @@
+﻿#include "SimpleCppLogger/WLogStreamTest.h"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "SimpleCppLogger/LogMacros.h"
+#include "SimpleCppLogger/LogMessage.h"
+#include "SimpleCppLogger/Logger.h"
+
+using namespace SimpleCppLogger;
+
+/**
+ * @brief Sets up the test fixture by clearing appenders and adding a mock appender.
+ */
+void WLogStreamTest::SetUp()
+{
+    m_mock_appender = std::make_shared<MockLogAppenderWStream>();
+    Logger::get_instance().clear_appenders();
+    Logger::get_instance().add_appender(m_mock_appender);
+    Logger::get_instance().set_log_level(LogLevel::Debug);
+}
+
+/**
+ * @brief Tears down the test fixture by clearing appenders.
+ */
+void WLogStreamTest::TearDown()
+{
+    Logger::get_instance().clear_appenders();
+    m_mock_appender.reset();
+}
+
+/**
+ * @brief Tests that a wide message keeps its payload and converts it on demand.
+ */
+TEST_F(WLogStreamTest, WideMessageConvertsLazily)
+{
+    LogMessage msg(LogLevel::Info, std::wstring(L"Café"));
+
+    EXPECT_TRUE(msg.is_wide());
+    EXPECT_EQ(msg.get_wide_message(), L"Café");
+    EXPECT_EQ(msg.get_message(), "Caf\xC3\xA9");
+
+    LogMessage narrow(LogLevel::Info, "plain");
+    EXPECT_FALSE(narrow.is_wide());
+    EXPECT_TRUE(narrow.get_wide_message().empty());
+}
+
+/**
+ * @brief Tests that copies share the conversion and that it is safe from several threads.
+ */
+TEST_F(WLogStreamTest, ConversionIsSharedAndThreadSafe)
+{
+    LogMessage msg(LogLevel::Info, std::wstring(1000, L'é'));
+    LogMessage copy = msg;
+
+    std::vector<const std::string*> results(4);
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i < results.size(); ++i)
+    {
+        threads.emplace_back([&, i] { results[i] = &(i % 2 == 0 ? msg : copy).get_message(); });
+    }
+    for (auto& thread: threads)
+    {
+        thread.join();
+    }
+
+    for (const auto* result: results)
+    {
+        EXPECT_EQ(result, results[0]);
+    }
+    EXPECT_EQ(results[0]->size(), 2000u);
+}
+
+/**
+ * @brief Tests that WLogStream sends a wide message to the logger.
+ */
+TEST_F(WLogStreamTest, StreamsWideValues)
+{
+    EXPECT_CALL(*m_mock_appender, internal_append(::testing::_, ::testing::_))
+        .WillOnce([](const LogMessage& message, const std::source_location& location) {
+            EXPECT_TRUE(message.is_wide());
+            EXPECT_EQ(message.get_wide_message(), L"Übung 3");
+            EXPECT_EQ(message.get_message(), "\xC3\x9C" "bung 3");
+            EXPECT_STREQ(location.file_name(), __FILE__);
+        });
+
+    WLogStream(LogLevel::Info, std::source_location::current()) << L"Übung " << 3;
+}
+
+/**
+ * @brief Tests that the WLOG macros skip disabled levels without building the message.
+ */
+TEST_F(WLogStreamTest, DisabledMacroSkipsEvaluation)
+{
+    Logger::get_instance().set_log_level(LogLevel::Warning);
+    int evaluations = 0;
+    auto count = [&evaluations] { return ++evaluations; };
+
+    EXPECT_CALL(*m_mock_appender, internal_append(::testing::_, ::testing::_)).Times(1);
+    WLOG_INFO << L"skipped " << count();
+    WLOG_ERROR << L"kept " << count();
+
+    EXPECT_EQ(evaluations, 1);
+}
+
+/**
+ * @brief Tests the wide log() overloads of the logger.
+ */
+TEST_F(WLogStreamTest, LoggerAcceptsWideText)
+{
+    std::vector<std::string> received;
+    EXPECT_CALL(*m_mock_appender, internal_append(::testing::_, ::testing::_))
+        .Times(3)
+        .WillRepeatedly([&received](const LogMessage& message, const std::source_location&) {
+            received.push_back(message.get_message());
+        });
+
+    const std::wstring text = L"view";
+    Logger::get_instance().log(LogLevel::Info, L"literal");
+    Logger::get_instance().log(LogLevel::Info, text);
+    Logger::get_instance().log(LogLevel::Info, std::wstring(L"moved"));
+
+    EXPECT_EQ(received, (std::vector<std::string>{"literal", "view", "moved"}));
+}